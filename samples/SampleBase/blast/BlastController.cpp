@@ -123,6 +123,7 @@ void BlastController::onSampleStart()
 	TkGroupDesc gdesc;
 	gdesc.workerCount = m_taskManager->getCpuDispatcher()->getWorkerCount();
 	m_tkGroup = m_tkFramework->createGroup(gdesc);
+	m_tkGroup->setPhaseTimers(true);
 
 	m_extPxManager = ExtPxManager::create(getPhysXController().getPhysics(), *m_tkFramework, createPxJointCallback);
 	m_extPxManager->setActorCountLimit(m_rigidBodyLimitEnabled ? m_rigidBodyLimit : 0);
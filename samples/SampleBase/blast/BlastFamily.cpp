@@ -550,7 +550,7 @@ public:
 			PxRigidDynamic* rigidDynamic = buffer[i].actor->is<PxRigidDynamic>();
 			if (rigidDynamic)
 			{
-				ExtPxActor* actor = m_pxManager.getActorFromPhysXActor(*rigidDynamic);
+				ExtPxActor* actor = m_pxManager.getActorFromPhysXShape(*rigidDynamic, *buffer[i].shape);
 				if (actor != nullptr)
 				{
 					m_actorBuffer.insert(actor);
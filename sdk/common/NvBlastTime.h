@@ -42,6 +42,11 @@ class Time
 public:
 	Time() : m_lastTickCount(getTimeTicks()) {}
 
+	/**
+	Only reads the clock if start is true, so that optional timing can be skipped without cost.
+	*/
+	explicit Time(bool start) : m_lastTickCount(start ? getTimeTicks() : 0) {}
+
 	int64_t			getElapsedTicks()
 	{
 		const int64_t lastTickCount = m_lastTickCount;
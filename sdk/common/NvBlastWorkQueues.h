@@ -0,0 +1,120 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+
+#ifndef NVBLASTWORKQUEUES_H
+#define NVBLASTWORKQUEUES_H
+
+#include "NvBlastArray.h"
+#include "NvBlastAtomic.h"
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+Work-stealing queues splitting a set of items among a fixed number of tasks.
+
+The items are dealt round robin in order of decreasing cost, so that every queue starts with an expensive item and the
+queues end up with similar costs.  Every task then claims the items of its own queue first and steals from the others
+when it runs dry, see process().
+*/
+class WorkQueues
+{
+public:
+	/**
+	Deal itemCount items round robin to queueCount queues: queue q gets sortedItems[q], sortedItems[q + queueCount], ...
+
+	\param[in]	queueCount	The number of queues, one per task.
+	\param[in]	itemCount	The number of items.
+	\param[in]	sortedItems	The items sorted by decreasing cost, or nullptr if items 0 to itemCount-1 are already sorted.
+	*/
+	void deal(uint32_t queueCount, uint32_t itemCount, const uint32_t* sortedItems = nullptr)
+	{
+		m_queues.resize(queueCount);
+		m_order.resize(itemCount);
+		uint32_t begin = 0;
+		for (uint32_t q = 0; q < queueCount; ++q)
+		{
+			const uint32_t count = itemCount / queueCount + (q < itemCount % queueCount ? 1 : 0);
+			m_queues[q].next = (int32_t)begin;
+			m_queues[q].end = begin + count;
+			for (uint32_t k = 0; k < count; ++k)
+			{
+				const uint32_t sortedIndex = q + k * queueCount;
+				m_order[begin + k] = sortedItems != nullptr ? sortedItems[sortedIndex] : sortedIndex;
+			}
+			begin += count;
+		}
+	}
+
+	/**
+	Call process(item) for every item claimed by the task taskIndex, from its own queue first, then from the others.
+	Tasks can call this concurrently, every item dealt is processed exactly once.
+	*/
+	template<typename ProcessFn>
+	void process(uint32_t taskIndex, ProcessFn processItem)
+	{
+		const uint32_t queueCount = m_queues.size();
+		for (uint32_t i = 0; i < queueCount; ++i)
+		{
+			Queue& queue = m_queues[(taskIndex + i) % queueCount];
+			for (;;)
+			{
+				const uint32_t orderIndex = (uint32_t)(atomicIncrement(&queue.next) - 1);
+				if (orderIndex >= queue.end)
+				{
+					break;
+				}
+				processItem(m_order[orderIndex]);
+			}
+		}
+	}
+
+private:
+	/**
+	Range of m_order owned by one task.  The owner and thieves claim items from the front by incrementing next,
+	padded to keep queues on separate cache lines.
+	*/
+	struct Queue
+	{
+		volatile int32_t	next;
+		uint32_t			end;
+		uint32_t			padding[14];
+	};
+
+	Array<Queue>::type		m_queues;	//!< one queue per task
+	Array<uint32_t>::type	m_order;	//!< items grouped by queue
+};
+
+} // namespace Blast
+} // namespace Nv
+
+
+#endif // ifndef NVBLASTWORKQUEUES_H
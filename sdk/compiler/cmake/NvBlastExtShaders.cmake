@@ -26,6 +26,10 @@ SET(EXT_SOURCE_FILES
 	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorInternal.h
 	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorAABBTree.h
 	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorAABBTree.cpp
+	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorBVH4.h
+	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorBVH4.cpp
+	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorGrid.h
+	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAcceleratorGrid.cpp
 	${SHADERS_EXT_SOURCE_DIR}/NvBlastExtDamageAccelerators.cpp
 )
 
@@ -21,14 +21,22 @@ SET(COMMON_FILES
 	
 	${COMMON_SOURCE_DIR}/NvBlastAssert.cpp
 	${COMMON_SOURCE_DIR}/NvBlastAssert.h
+	${COMMON_SOURCE_DIR}/NvBlastAtomic.cpp
+	${COMMON_SOURCE_DIR}/NvBlastAtomic.h
+	${COMMON_SOURCE_DIR}/NvBlastWorkQueues.h
 )
 
 SET(STRESS_SOURCE_FILES
 	${STRESS_SOURCE_DIR}/NvBlastExtStressSolver.cpp
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernels.cpp
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernels.h
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernelsAVX2.cpp
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverManager.cpp
 )
 
 SET(STRESS_PUBLIC_FILES
 	${STRESS_INCLUDE_DIR}/NvBlastExtStressSolver.h
+	${STRESS_INCLUDE_DIR}/NvBlastExtStressSolverManager.h
 )
 
 ADD_LIBRARY(NvBlastExtStress SHARED 
@@ -41,6 +49,9 @@ SOURCE_GROUP("common" FILES ${COMMON_FILES})
 SOURCE_GROUP("public" FILES ${STRESS_PUBLIC_FILES}) 
 SOURCE_GROUP("src" FILES ${STRESS_SOURCE_FILES})
 
+# The AVX2 kernel is only called after checking the CPU supports it
+SET_SOURCE_FILES_PROPERTIES(${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernelsAVX2.cpp PROPERTIES COMPILE_FLAGS "${BLASTEXTSTRESS_AVX2_COMPILE_FLAGS}")
+
 # Target specific compile options
 
 TARGET_INCLUDE_DIRECTORIES(NvBlastExtStress 
@@ -35,6 +35,7 @@ SET(COMMON_FILES
 	${COMMON_SOURCE_DIR}/NvBlastArray.h
 	${COMMON_SOURCE_DIR}/NvBlastHashMap.h
 	${COMMON_SOURCE_DIR}/NvBlastHashSet.h
+	${COMMON_SOURCE_DIR}/NvBlastWorkQueues.h
 )
 
 SET(PUBLIC_FILES
@@ -9,3 +9,5 @@ IF ("${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang")
 ELSE()
 	SET(BLASTEXTSTRESS_PLATFORM_COMPILE_OPTIONS "-pedantic")
 ENDIF()
+
+SET(BLASTEXTSTRESS_AVX2_COMPILE_FLAGS "-mavx2")
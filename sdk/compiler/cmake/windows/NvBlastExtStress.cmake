@@ -0,0 +1,5 @@
+#
+# Build NvBlastExtStress Windows
+#
+
+SET(BLASTEXTSTRESS_AVX2_COMPILE_FLAGS "/arch:AVX2")
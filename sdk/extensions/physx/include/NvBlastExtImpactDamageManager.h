@@ -68,6 +68,7 @@ struct ExtImpactSettings
 	float					damageThresholdMin;			//!<	minimum damage fraction threshold to be applied. Range [0, 1]. For example 0.1 filters all damage below 10% of health.
 	float					damageThresholdMax;			//!<	maximum damage fraction threshold to be applied. Range [0, 1]. For example 0.8 won't allow more then 80% of health damage to be applied.
 	float					damageFalloffRadiusFactor;	//!<	damage attenuation radius factor. Given a radius R for full damage, for [R, R * damageFalloffRadiusFactor] radius interval damage attenuates down to zero at the outer radius.
+	float					impactMergeRadius;			//!<	impacts on the same actor whose positions fall in the same cell of a grid with this spacing (in actor space) are merged into one before damage is applied. 0 disables merging.
 	ExtImpactDamageFunction damageFunction;				//!<	custom damage function, can be nullptr, default internal one will be used in that case.
 	void*					damageFunctionData;			//!<	data to be passed in custom damage function.
 
@@ -80,6 +81,7 @@ struct ExtImpactSettings
 		damageThresholdMin(0.1f), // to filter small damage events
 		damageThresholdMax(1.0f),
 		damageFalloffRadiusFactor(2.0f),
+		impactMergeRadius(0.0f),
 		damageFunction(nullptr),
 		damageFunctionData(nullptr)
 	{}
@@ -90,7 +92,7 @@ struct ExtImpactSettings
 Impact Damage Manager.
 
 Requires ExtPxManager.
-Call onContact from PxSimulationEventCallback onContact to accumulate damage.
+Call onContact from PxSimulationEventCallback onContact to accumulate damage, it can be called concurrently from the contact report threads.
 Call applyDamage to apply accumulated damage.
 */
 class NV_DLL_EXPORT ExtImpactDamageManager
@@ -128,7 +130,7 @@ public:
 
 	User should implement own PxSimulationEventCallback onContact and call this method in order ExtImpactDamageManager to work correctly.
 	
-	Contacts will be processed and impact damage will be accumulated.
+	Contacts will be processed and impact damage will be accumulated.  Safe to call concurrently with itself, but not with applyDamage.
 
 	\param[in] pairHeader Information on the two actors whose shapes triggered a contact report.
 	\param[in] pairs The contact pairs of two actors for which contact reports have been requested. @see PxContactPair.
@@ -141,6 +143,9 @@ public:
 
 	/**
 	Apply accumulated impact damage.
+
+	The impacts are grouped per actor and, depending on ExtImpactSettings::impactMergeRadius, merged.  The fracture commands of all the impacts
+	on an actor are applied at once.
 	*/
 	virtual void					applyDamage() = 0;
 
@@ -52,7 +52,7 @@ class TkActor;
 /**
 Actor.
 
-Corresponds one to one to PxRigidDynamic and ExtActor.
+Corresponds one to one to PxRigidDynamic and ExtActor, except for the debris actors of ExtPxActorBudgetMode::Merge, which share a PxRigidDynamic.
 */
 class ExtPxActor
 {
@@ -72,7 +72,7 @@ public:
 	virtual const uint32_t*			getChunkIndices() const = 0;
 
 	/**
-	Every actor has corresponding PxActor.
+	Every actor has corresponding PxActor.  Debris actors share theirs, see ExtPxActorBudgetMode::Merge.
 
 	/return a pointer to PxRigidDynamic actor.
 	*/
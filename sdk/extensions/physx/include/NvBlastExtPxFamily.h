@@ -160,6 +160,22 @@ public:
 	*/
 	virtual const physx::PxShape* const*	getSubchunkShapes() const = 0;
 
+	/**
+	The shapes of subchunks which are no longer part of a PhysX actor are kept by the family, and attached again when their
+	subchunk is part of a new actor.  This way splits move shapes between rigid bodies rather than creating them.
+	The family keeps at most one shape per subchunk.  Kept shapes are released with the family, or with releasePooledShapes().
+
+	\return the number of shapes kept for reuse, which are not attached to an actor.
+	*/
+	virtual uint32_t						getPooledShapeCount() const = 0;
+
+	/**
+	Release the shapes kept for reuse, see getPooledShapeCount().
+
+	\return the number of shapes released.
+	*/
+	virtual uint32_t						releasePooledShapes() = 0;
+
 	/**
 	Every family has an associated asset.
 
@@ -40,6 +40,7 @@ namespace physx
 {
 class PxPhysics;
 class PxRigidDynamic;
+class PxShape;
 class PxJoint;
 
 namespace general_PxIOStream2
@@ -63,6 +64,8 @@ class TkFamily;
 class TkFramework;
 class TkGroup;
 class TkJoint;
+class TkActor;
+class TkGroupTaskRunner;
 
 
 /**
@@ -78,6 +81,53 @@ struct ExtPxFamilyDesc
 };
 
 
+/**
+Counters of the rigid body pool of ExtPxManager, see ExtPxManager::setRigidBodyPoolLimit().
+The counters other than pooledCount accumulate since the manager's creation.
+*/
+struct ExtPxRigidBodyPoolStats
+{
+	uint32_t	pooledCount;	//!< Rigid bodies currently kept in the pool
+	uint32_t	reusedCount;	//!< Rigid bodies taken from the pool for new actors
+	uint32_t	createdCount;	//!< Rigid bodies created for new actors because the pool was empty
+	uint32_t	releasedCount;	//!< Rigid bodies of destroyed actors released because the pool was full or they were constrained
+};
+
+
+/**
+What ExtPxFamily does with the new actors of a split which exceed the actor count limit, see ExtPxManager::setActorCountLimit().
+The new actors are ranked by priority first, see ExtPxActorPriorityCallback, and the most important ones get their own PxRigidDynamic.
+*/
+struct ExtPxActorBudgetMode
+{
+	enum Enum
+	{
+		Cull,	//!< The excess actors are released in ExtPxFamily::postSplitUpdate(), they have no PxActor
+		Sleep,	//!< The excess actors get their own PxRigidDynamic like the others, put to sleep immediately.  The limit is exceeded.
+		Merge,	//!< The excess single leaf chunk actors of a split share one PxRigidDynamic per parent actor, other excess actors are culled.  getActorFromPhysXActor() returns one of them, getActorFromPhysXShape() the one owning a shape.
+	};
+};
+
+
+/**
+Ranks the new actors of a split when they exceed the actor count limit, see ExtPxManager::setActorPriorityCallback().
+*/
+class ExtPxActorPriorityCallback
+{
+public:
+	/**
+	Interface to be implemented by the user.  Will be called for every new actor of a split exceeding the actor count limit.
+
+	\param[in]	family	The ExtPxFamily the actor belongs to.
+	\param[in]	actor	The new TkActor, which has no ExtPxActor yet.
+	\param[in]	pose	The pose the actor's PxRigidDynamic would be created with (its parent's pose).
+
+	\return the actor's priority, the actors with higher priorities are kept first.
+	*/
+	virtual float	getActorPriority(ExtPxFamily& family, TkActor& actor, const physx::PxTransform& pose) = 0;
+};
+
+
 /**
 Function pointer for PxJoint creation.
 
@@ -198,6 +248,17 @@ public:
 	*/
 	virtual ExtPxActor*			getActorFromPhysXActor(const physx::PxRigidDynamic& pxActor) const = 0;
 
+	/**
+	Look up the ExtPxActor owning a shape of a PxRigidDynamic.  Unlike getActorFromPhysXActor(), it tells apart the actors
+	sharing a debris PxRigidDynamic, see ExtPxActorBudgetMode::Merge.
+
+	\param[in]	pxActor			The PxRigidDynamic pointer to look up.
+	\param[in]	shape			A shape attached to pxActor.
+
+	\return pointer to the ExtPxActor object if it exists, NULL otherwise.
+	*/
+	virtual ExtPxActor*			getActorFromPhysXShape(const physx::PxRigidDynamic& pxActor, const physx::PxShape& shape) const = 0;
+
 	/**
 	Get a PxPhysics object pointer used upon manager creation.
 
@@ -221,6 +282,7 @@ public:
 
 	/**
 	Limits the total number of actors that can exist at a given time.  A value of zero disables this (gives no limit).
+	New actors exceeding the limit are handled according to setActorBudgetMode(), the most important first, see setActorPriorityCallback().
 
 	\param[in]	limit			If not zero, the maximum number of actors that will be allowed to exist.
 	*/
@@ -233,6 +295,31 @@ public:
 	*/
 	virtual uint32_t			getActorCountLimit() = 0;
 
+	/**
+	Set what happens to the new actors exceeding the actor count limit, ExtPxActorBudgetMode::Cull by default.
+
+	\param[in]	mode			The budget mode, see ExtPxActorBudgetMode.
+	*/
+	virtual void				setActorBudgetMode(ExtPxActorBudgetMode::Enum mode) = 0;
+
+	/**
+	\return the budget mode of the actor count limit, see setActorBudgetMode().
+	*/
+	virtual ExtPxActorBudgetMode::Enum	getActorBudgetMode() const = 0;
+
+	/**
+	Set the callback ranking the new actors when they exceed the actor count limit.
+	Without a callback, actors are ranked by the total volume of their visible chunks.
+
+	\param[in]	callback		The priority callback, can be nullptr.
+	*/
+	virtual void				setActorPriorityCallback(ExtPxActorPriorityCallback* callback) = 0;
+
+	/**
+	\return the callback ranking the new actors, see setActorPriorityCallback().
+	*/
+	virtual ExtPxActorPriorityCallback*	getActorPriorityCallback() const = 0;
+
 	/**
 	The total number of PxActors generated by Blast.
 
@@ -240,6 +327,49 @@ public:
 	*/
 	virtual uint32_t			getPxActorCount() const = 0;
 
+	/**
+	Limits the number of PxRigidDynamic kept for reuse.  A value of zero, the default, disables the pool.
+
+	With a pool, the rigid body of a destroyed actor is detached from its shapes and kept, then reused by the next actor
+	created by any family of this manager, rather than released and created through PxPhysics.  Before reuse these are reset
+	to the PhysX defaults: pose, velocities, actor, rigid body (including CCD) and lock flags, dominance group, owner client,
+	name, damping, max angular velocity, max depenetration velocity, max contact impulse, contact report threshold, sleep and
+	stabilization thresholds, solver iteration counts, wake counter and userData.  Mass is computed from the new shapes.
+	Anything else set on the rigid body, e.g. in ExtPxListener::onActorCreated, carries over.
+	Rigid bodies still referenced by constraints are not pooled.  Lowering the limit releases the excess.
+
+	\param[in]	limit			The maximum number of rigid bodies kept for reuse.
+	*/
+	virtual void				setRigidBodyPoolLimit(uint32_t limit) = 0;
+
+	/**
+	\return the maximum number of rigid bodies kept for reuse, see setRigidBodyPoolLimit().
+	*/
+	virtual uint32_t			getRigidBodyPoolLimit() const = 0;
+
+	/**
+	Get the counters of the rigid body pool, see setRigidBodyPoolLimit().
+
+	\param[out]	stats			The struct to be filled in.
+	*/
+	virtual void				getRigidBodyPoolStats(ExtPxRigidBodyPoolStats& stats) const = 0;
+
+	/**
+	Set a task runner to prepare the new actors of large splits concurrently: gathering their chunks, finding static chunks and
+	summing their mass properties from the chunks'.  Creating the rigid bodies and adding them to the scene stays on the calling thread.
+
+	Families create their new actors when receiving split events in TkGroup::endProcess(), so this can be the task runner the group
+	is processed with in TkGroup::process(TkGroupTaskRunner&).
+
+	\param[in]	taskRunner		The task runner to use, nullptr prepares the actors on the calling thread.
+	*/
+	virtual void				setTaskRunner(TkGroupTaskRunner* taskRunner) = 0;
+
+	/**
+	\return the task runner preparing new actors, see setTaskRunner().
+	*/
+	virtual TkGroupTaskRunner*	getTaskRunner() const = 0;
+
 	/**
 	Add a user implementation of ExtPxListener to this family's list of listeners.
 
@@ -54,6 +54,7 @@ struct ExtSyncEventType
 		Fracture = 0, //!< Contains Fracture commands
 		FamilySync,	  //!< Contains full family Family blob
 		Physics,	  //!< Contains actor's physical info, like transforms
+		BondHealths,  //!< Contains bond healths, all of them or only the ones changed since the previous sync
 
 		Count
 	};
@@ -137,6 +138,36 @@ struct ExtSyncEventPhysicsSync : public ExtSyncEventInstance<ExtSyncEventPhysics
 };
 
 
+/**
+Bond Healths Sync Event
+*/
+struct ExtSyncEventBondHealths : public ExtSyncEventInstance<ExtSyncEventBondHealths, ExtSyncEventType::BondHealths>
+{
+	struct BondData
+	{
+		uint32_t	bondIndex;	//!< bond index in asset
+		float		health;		//!< bond health
+	};
+
+	bool					keyframe;	//!< true if data contains all bonds of the family, false if only the ones changed since the previous sync
+	std::vector<BondData>	data;		//!< bonds data
+};
+
+
+/**
+Compact sync stream settings, see ExtSync::setSyncStream.
+*/
+struct ExtSyncStreamDesc
+{
+	ExtSyncStreamDesc() : stream(nullptr), capacity(0), healthBits(8), maxBondHealth(1.0f) {}
+
+	void*		stream;			//!< Preallocated memory to write sync events to, nullptr to use the sync buffer of ExtSyncEvent objects
+	uint32_t	capacity;		//!< The size of stream in bytes
+	uint32_t	healthBits;		//!< The bits per quantized bond health in ExtSyncEventBondHealths, 8 or 16
+	float		maxBondHealth;	//!< Bond healths are quantized in [0, maxBondHealth], a record with larger healths is quantized in [0, its largest health]
+};
+
+
 /**
 Sync Manager.
 
@@ -187,6 +218,17 @@ public:
 	*/
 	virtual void		syncFamily(const ExtPxFamily& family) = 0;
 
+	/**
+	Sync family bond healths. Writes to internal sync buffer.
+
+	The first call for a family and every keyframeInterval-th call after it write the healths of all bonds (keyframe), the other
+	calls only write the bonds whose health changed since the previous call (delta). Nothing is written for a delta without changes.
+
+	\param[in]	family				The TkFamily to sync
+	\param[in]	keyframeInterval	The number of calls from one keyframe to the next for this family
+	*/
+	virtual void		syncBondHealths(const TkFamily& family, uint32_t keyframeInterval = 30) = 0;
+
 	/**
 	The size of internal sync buffer (events count).
 
@@ -204,9 +246,29 @@ public:
 
 	/**
 	Clear internal sync buffer.
+	In stream mode, writing restarts at the beginning of the stream.
 	*/
 	virtual void		releaseSyncBuffer() = 0;
 
+	/**
+	Write the sync events to a preallocated byte stream instead of the internal sync buffer (stream mode), which avoids allocating
+	an ExtSyncEvent per event. Graph node, chunk, bond and actor indices are varint encoded, and bond healths of
+	ExtSyncEventBondHealths are quantized to desc.healthBits. Fracture command damage is kept exact, without userdata.
+
+	Events which don't fit in the remaining capacity are dropped with a warning. The stream is decoded with readSyncStream.
+	Releases the internal sync buffer.
+
+	\param[in]	desc		The stream settings, desc.stream set to nullptr ends stream mode.
+	*/
+	virtual void		setSyncStream(const ExtSyncStreamDesc& desc) = 0;
+
+	/**
+	The size of the sync stream written so far.
+
+	\return the number of bytes written to the sync stream since setSyncStream or releaseSyncBuffer, 0 when not in stream mode.
+	*/
+	virtual uint32_t	getSyncStreamSize() const = 0;
+
 
 	//////// client-side interface ////////
 
@@ -222,6 +284,17 @@ public:
 	*/
 	virtual void		applySyncBuffer(TkFramework& framework, const ExtSyncEvent** buffer, uint32_t size, TkGroup* groupForNewActors, ExtPxManager* manager = nullptr) = 0;
 
+	/**
+	Decode a sync stream written in stream mode (see setSyncStream) into the internal sync buffer, which then can be acquired
+	with acquireSyncBuffer and applied with applySyncBuffer.
+
+	\param[in]	stream		The sync stream.
+	\param[in]	size		The size of the stream in bytes, as given by getSyncStreamSize.
+
+	\return true if the whole stream was decoded, false if it is malformed. Events decoded before the error are kept.
+	*/
+	virtual bool		readSyncStream(const void* stream, uint32_t size) = 0;
+
 };
 
 } // namespace Blast
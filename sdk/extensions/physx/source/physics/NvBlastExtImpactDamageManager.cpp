@@ -37,6 +37,8 @@
 
 #include "NvBlastExtDamageShaders.h"
 #include "NvBlastArray.h"
+#include "NvBlastHashMap.h"
+#include "NvBlastIndexFns.h"
 
 #include "PxRigidDynamic.h"
 #include "PxSimulationEventCallback.h"
@@ -47,6 +49,10 @@
 #include "NvBlastTkFamily.h"
 #include "NvBlastTkAsset.h"
 
+#include <algorithm>
+#include <atomic>
+#include <new>
+
 
 namespace Nv
 {
@@ -67,12 +73,24 @@ public:
 		NVBLAST_ASSERT_WITH_MESSAGE(pxManager != nullptr, "ExtImpactDamageManager creation: input ExtPxManager is nullptr.");
 		m_pxManager->subscribe(m_listener);
 
+		m_impactInbox.store(nullptr, std::memory_order_relaxed);
+		m_impactPoolBlockCount = 0;
+		m_impactFreeList.store(invalidIndex<uint32_t>(), std::memory_order_relaxed);
+		m_impactPoolMisses.store(0, std::memory_order_relaxed);
 		m_impactDamageBuffer.reserve(32);
 	}
 
 	~ExtImpactDamageManagerImpl()
 	{
 		m_pxManager->unsubscribe(m_listener);
+
+		// returns the queued impacts to the pool
+		collectQueuedImpacts();
+
+		for (uint32_t b = 0; b < m_impactPoolBlockCount; b++)
+		{
+			NVBLAST_FREE(m_impactPoolBlocks[b]);
+		}
 	}
 
 	virtual void					release() override
@@ -93,15 +111,6 @@ public:
 	virtual void					applyDamage() override;
 
 
-	//////// public methods ////////
-
-	void							queueImpactDamage(ExtPxActor* actor, PxVec3 force, PxVec3 position, PxShape* shape)
-	{
-		ImpactDamageData data = { actor, force, position, shape };
-		m_impactDamageBuffer.pushBack(data);
-	}
-
-
 private:
 	//////// physics manager listener ////////
 
@@ -116,6 +125,7 @@ private:
 			NV_UNUSED(family);
 
 			// filter out actor from queued buffer
+			m_manager->collectQueuedImpacts();
 			auto& buffer = m_manager->m_impactDamageBuffer;
 			for (int32_t i = 0; i < (int32_t)buffer.size(); ++i)
 			{
@@ -131,10 +141,42 @@ private:
 	};
 
 
+	struct ImpactDamageData
+	{
+		ExtPxActor*	actor;
+		PxVec3				force;
+		PxVec3				position;
+		PxShape*			shape;
+	};
+
+	static const uint32_t	IMPACTS_PER_NODE = 16;	//!< the most impacts in a QueuedImpacts node, onContact uses as many nodes as it needs
+
+	/**
+	Impacts found by an onContact call, queued for the next applyDamage.
+	*/
+	struct QueuedImpacts
+	{
+		QueuedImpacts*			next;
+		uint32_t				count;
+		uint32_t				poolIndex;	//!< index in the impact pool, invalid if allocated because the pool was empty
+		std::atomic<uint32_t>	nextFree;	//!< next node in the impact pool's free list
+		ImpactDamageData		impacts[IMPACTS_PER_NODE];
+	};
+
+	static const uint32_t	IMPACT_POOL_BLOCK_SIZE = 64;		//!< QueuedImpacts nodes in each block of the impact pool
+	static const uint32_t	IMPACT_POOL_MAX_BLOCK_COUNT = 64;	//!< the impact pool's most blocks, nodes beyond are allocated
+
+
 	//////// private methods ////////
 
-	void ensureBuffersSize(ExtPxActor* actor);
-	void damageActor(ExtPxActor* actor, PxShape* shape, PxVec3 position, PxVec3 force);
+	void queueImpactDamage(const ImpactDamageData* impacts, uint32_t count);
+	void collectQueuedImpacts();
+	QueuedImpacts* acquireQueuedImpacts();
+	void releaseQueuedImpacts(QueuedImpacts* queued);
+	void growImpactPool();
+	uint32_t mergeImpacts(ImpactDamageData* impacts, uint32_t count);
+	void generateDamage(ExtPxActor* actor, PxShape* shape, PxVec3 position, PxVec3 force);
+	void applyGeneratedDamage(ExtPxActor* actor);
 
 
 	//////// data ////////
@@ -142,21 +184,25 @@ private:
 	ExtPxManager*						m_pxManager;
 	ExtImpactSettings					m_settings;
 	PxManagerListener					m_listener;
-	Array<PxContactPairPoint>::type		m_pairPointBuffer;
 	bool								m_usePxUserData;
 
-	struct ImpactDamageData
-	{
-		ExtPxActor*	actor;
-		PxVec3				force;
-		PxVec3				position;
-		PxShape*			shape;
-	};
-
-	Array<ImpactDamageData>::type		m_impactDamageBuffer;
-
-	NvBlastFractureBuffers				m_fractureBuffers;
-	Array<uint8_t>::type				m_fractureData;
+	std::atomic<QueuedImpacts*>			m_impactInbox;			//!<	impacts queued by onContact, possibly from several threads
+	QueuedImpacts*						m_impactPoolBlocks[IMPACT_POOL_MAX_BLOCK_COUNT];	//!<	the impact pool's blocks, never moved or freed until destruction
+	uint32_t							m_impactPoolBlockCount;
+	std::atomic<uint64_t>				m_impactFreeList;		//!<	index of the impact pool's first free node, tagged in the high 32 bits against ABA
+	std::atomic<uint32_t>				m_impactPoolMisses;		//!<	nodes allocated because the impact pool was empty, since the last growImpactPool
+	Array<ImpactDamageData>::type		m_impactDamageBuffer;	//!<	impacts collected from the inbox
+
+	// applyDamage scratch
+	HashMap<ExtPxActor*, uint32_t>::type	m_damagedActorIndices;
+	Array<ExtPxActor*>::type				m_damagedActors;
+	Array<uint32_t>::type					m_actorImpactOffsets;
+	Array<uint32_t>::type					m_impactActorIndices;
+	Array<ImpactDamageData>::type			m_actorImpacts;
+	HashMap<uint64_t, uint32_t>::type		m_mergeCells;
+	Array<float>::type						m_mergeWeights;
+	Array<NvBlastBondFractureData>::type	m_bondFractures;
+	Array<NvBlastChunkFractureData>::type	m_chunkFractures;
 };
 
 
@@ -216,6 +262,10 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 			return;
 	}
 
+	// this can run on several contact report threads at once, only touch local buffers until the impacts are queued
+	InlineArray<PxContactPairPoint, 32>::type pairPointBuffer;
+	InlineArray<ImpactDamageData, 16>::type impacts;
+
 	for (uint32_t pairIdx = 0; pairIdx < nbPairs; pairIdx++)
 	{
 		const PxContactPair& currentPair = pairs[pairIdx];
@@ -228,6 +278,13 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 			continue;
 		}
 
+		// the actors sharing a debris body are told apart by the shape in contact
+		ExtPxActor* pairActors[2];
+		for (int i = 0; i < 2; ++i)
+		{
+			pairActors[i] = actors[i] != nullptr ? m_pxManager->getActorFromPhysXShape(actors[i]->getPhysXActor(), *currentPair.shapes[i]) : nullptr;
+		}
+
 		float masses[2] = { 0, 0 };
 		{
 			for (int i = 0; i < 2; ++i)
@@ -263,12 +320,12 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 		PxVec3 avgContactNormal = PxVec3(0.0f);
 		uint32_t  numContacts = 0;
 
-		m_pairPointBuffer.resize(currentPair.contactCount);
-		uint32_t numContactsInStream = currentPair.contactCount > 0 ? currentPair.extractContacts(m_pairPointBuffer.begin(), currentPair.contactCount) : 0;
+		pairPointBuffer.resizeUninitialized(currentPair.contactCount);
+		uint32_t numContactsInStream = currentPair.contactCount > 0 ? currentPair.extractContacts(pairPointBuffer.begin(), currentPair.contactCount) : 0;
 
 		for (uint32_t contactIdx = 0; contactIdx < numContactsInStream; contactIdx++)
 		{
-			PxContactPairPoint& currentPoint = m_pairPointBuffer[contactIdx];
+			PxContactPairPoint& currentPoint = pairPointBuffer[contactIdx];
 
 			const PxVec3& patchNormal = currentPoint.normal;
 			const PxVec3& position = currentPoint.position;
@@ -287,7 +344,7 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 			{
 				for (int i = 0; i < 2; ++i)
 				{
-					if (actors[i])
+					if (pairActors[i])
 					{
 						// this is not really physically correct, but at least its deterministic...
 						destructibleForces[i] += (patchNormal * patchNormal.dot(velocityDelta)) * reducedMass * (i ? 1.0f : -1.0f);
@@ -306,12 +363,13 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 			for (uint32_t i = 0; i < 2; i++)
 			{
 				const PxVec3 force = destructibleForces[i] / (float)numContacts;
-				ExtPxActor* actor = actors[i];
+				ExtPxActor* actor = pairActors[i];
 				if (actor != nullptr)
 				{
 					if (!force.isZero())
 					{
-						queueImpactDamage(actor, force, avgContactPosition, currentPair.shapes[i]);
+						ImpactDamageData data = { actor, force, avgContactPosition, currentPair.shapes[i] };
+						impacts.pushBack(data);
 					}
 					else if (reducedMass == 0.0f)	// Handle kinematic vs. kinematic
 					{
@@ -321,6 +379,131 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 			}
 		}
 	}
+
+	if (impacts.size() > 0)
+	{
+		queueImpactDamage(impacts.begin(), impacts.size());
+	}
+}
+
+
+void ExtImpactDamageManagerImpl::queueImpactDamage(const ImpactDamageData* impacts, uint32_t count)
+{
+	for (uint32_t offset = 0; offset < count; offset += IMPACTS_PER_NODE)
+	{
+		QueuedImpacts* queued = acquireQueuedImpacts();
+		queued->count = std::min(count - offset, IMPACTS_PER_NODE);
+		memcpy(queued->impacts, impacts + offset, queued->count * sizeof(ImpactDamageData));
+
+		// the inbox is only ever emptied as a whole, so a plain compare-and-swap push is safe from ABA
+		QueuedImpacts* head = m_impactInbox.load(std::memory_order_relaxed);
+		do
+		{
+			queued->next = head;
+		} while (!m_impactInbox.compare_exchange_weak(head, queued, std::memory_order_release, std::memory_order_relaxed));
+	}
+}
+
+
+void ExtImpactDamageManagerImpl::collectQueuedImpacts()
+{
+	QueuedImpacts* queued = m_impactInbox.exchange(nullptr, std::memory_order_acquire);
+	if (queued == nullptr)
+	{
+		growImpactPool();
+		return;
+	}
+
+	// the inbox is last in first out, reverse it
+	QueuedImpacts* first = nullptr;
+	while (queued != nullptr)
+	{
+		QueuedImpacts* next = queued->next;
+		queued->next = first;
+		first = queued;
+		queued = next;
+	}
+
+	while (first != nullptr)
+	{
+		for (uint32_t i = 0; i < first->count; ++i)
+		{
+			m_impactDamageBuffer.pushBack(first->impacts[i]);
+		}
+
+		QueuedImpacts* next = first->next;
+		releaseQueuedImpacts(first);
+		first = next;
+	}
+
+	growImpactPool();
+}
+
+
+ExtImpactDamageManagerImpl::QueuedImpacts* ExtImpactDamageManagerImpl::acquireQueuedImpacts()
+{
+	// the tag is bumped by every pop, a pop based on a stale head fails even if the same node is on top again
+	uint64_t head = m_impactFreeList.load(std::memory_order_acquire);
+	for (;;)
+	{
+		const uint32_t index = (uint32_t)head;
+		if (isInvalidIndex(index))
+		{
+			m_impactPoolMisses.fetch_add(1, std::memory_order_relaxed);
+			QueuedImpacts* queued = new (NVBLAST_ALLOC_NAMED(sizeof(QueuedImpacts), "ExtImpactDamageManagerImpl::queueImpactDamage")) QueuedImpacts;
+			queued->poolIndex = invalidIndex<uint32_t>();
+			return queued;
+		}
+
+		// blocks are never freed while the manager lives, a stale node is still safe to read
+		QueuedImpacts* queued = m_impactPoolBlocks[index / IMPACT_POOL_BLOCK_SIZE] + index % IMPACT_POOL_BLOCK_SIZE;
+		const uint64_t next = ((head >> 32) + 1) << 32 | queued->nextFree.load(std::memory_order_relaxed);
+		if (m_impactFreeList.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+		{
+			return queued;
+		}
+	}
+}
+
+
+void ExtImpactDamageManagerImpl::releaseQueuedImpacts(QueuedImpacts* queued)
+{
+	if (isInvalidIndex(queued->poolIndex))
+	{
+		NVBLAST_FREE(queued);
+		return;
+	}
+
+	uint64_t head = m_impactFreeList.load(std::memory_order_relaxed);
+	uint64_t next;
+	do
+	{
+		queued->nextFree.store((uint32_t)head, std::memory_order_relaxed);
+		next = (head & 0xFFFFFFFF00000000ULL) | queued->poolIndex;
+	} while (!m_impactFreeList.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+void ExtImpactDamageManagerImpl::growImpactPool()
+{
+	const uint32_t misses = m_impactPoolMisses.exchange(0, std::memory_order_relaxed);
+	uint32_t blockCount = (misses + IMPACT_POOL_BLOCK_SIZE - 1) / IMPACT_POOL_BLOCK_SIZE;
+	blockCount = std::min(blockCount, IMPACT_POOL_MAX_BLOCK_COUNT - m_impactPoolBlockCount);
+
+	for (uint32_t b = 0; b < blockCount; b++)
+	{
+		QueuedImpacts* block = reinterpret_cast<QueuedImpacts*>(NVBLAST_ALLOC_NAMED(IMPACT_POOL_BLOCK_SIZE * sizeof(QueuedImpacts), "ExtImpactDamageManagerImpl::growImpactPool"));
+		const uint32_t firstIndex = m_impactPoolBlockCount * IMPACT_POOL_BLOCK_SIZE;
+		m_impactPoolBlocks[m_impactPoolBlockCount++] = block;
+
+		// the block's pointer is published with the release push of its nodes
+		for (uint32_t i = 0; i < IMPACT_POOL_BLOCK_SIZE; i++)
+		{
+			QueuedImpacts* queued = new (block + i) QueuedImpacts;
+			queued->poolIndex = firstIndex + i;
+			releaseQueuedImpacts(queued);
+		}
+	}
 }
 
 
@@ -330,40 +513,142 @@ void ExtImpactDamageManagerImpl::onContact(const PxContactPairHeader& pairHeader
 
 void ExtImpactDamageManagerImpl::applyDamage()
 {
+	collectQueuedImpacts();
+
+	const uint32_t impactCount = m_impactDamageBuffer.size();
+	if (impactCount == 0)
+	{
+		return;
+	}
+
+	// group the impacts per actor, the actors in the order they were first hit
+	m_damagedActorIndices.clear();
+	m_damagedActors.clear();
+	m_actorImpactOffsets.clear();
+	m_impactActorIndices.resizeUninitialized(impactCount);
+	for (uint32_t i = 0; i < impactCount; ++i)
+	{
+		ExtPxActor* actor = m_impactDamageBuffer[i].actor;
+		const auto entry = m_damagedActorIndices.find(actor);
+		uint32_t actorIndex;
+		if (entry != nullptr)
+		{
+			actorIndex = entry->second;
+		}
+		else
+		{
+			actorIndex = m_damagedActors.size();
+			m_damagedActorIndices[actor] = actorIndex;
+			m_damagedActors.pushBack(actor);
+			m_actorImpactOffsets.pushBack(0);
+		}
+		m_impactActorIndices[i] = actorIndex;
+		m_actorImpactOffsets[actorIndex]++;
+	}
+
+	const uint32_t actorCount = m_damagedActors.size();
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < actorCount; ++i)
+	{
+		const uint32_t count = m_actorImpactOffsets[i];
+		m_actorImpactOffsets[i] = offset;
+		offset += count;
+	}
+	m_actorImpactOffsets.pushBack(offset);
+
+	m_actorImpacts.resizeUninitialized(impactCount);
+	for (uint32_t i = 0; i < impactCount; ++i)
+	{
+		m_actorImpacts[m_actorImpactOffsets[m_impactActorIndices[i]]++] = m_impactDamageBuffer[i];
+	}
+	m_impactDamageBuffer.clear();
+
 	const auto damageFn = m_settings.damageFunction;
 	const auto damageFnData = m_settings.damageFunctionData;
 
-	for (const ImpactDamageData& data : m_impactDamageBuffer)
+	// the scatter above moved each offset to the end of its range, which is the start of the next one
+	uint32_t actorImpactsStart = 0;
+	for (uint32_t actorIndex = 0; actorIndex < actorCount; ++actorIndex)
 	{
-		PxTransform t(data.actor->getPhysXActor().getGlobalPose().getInverse());
-		PxVec3 force = t.rotate(data.force);
-		PxVec3 position = t.transform(data.position);
+		ExtPxActor* actor = m_damagedActors[actorIndex];
+		ImpactDamageData* impacts = m_actorImpacts.begin() + actorImpactsStart;
+		uint32_t count = m_actorImpactOffsets[actorIndex] - actorImpactsStart;
+		actorImpactsStart = m_actorImpactOffsets[actorIndex];
 
-		if (!damageFn || !damageFn(damageFnData, data.actor, data.shape, position, force))
+		PxTransform t(actor->getPhysXActor().getGlobalPose().getInverse());
+		for (uint32_t i = 0; i < count; ++i)
 		{
-			damageActor(data.actor, data.shape, position, force);
+			impacts[i].force = t.rotate(impacts[i].force);
+			impacts[i].position = t.transform(impacts[i].position);
 		}
+
+		count = mergeImpacts(impacts, count);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const ImpactDamageData& data = impacts[i];
+			if (!damageFn || !damageFn(damageFnData, actor, data.shape, data.position, data.force))
+			{
+				generateDamage(actor, data.shape, data.position, data.force);
+			}
+		}
+
+		applyGeneratedDamage(actor);
 	}
-	m_impactDamageBuffer.clear();
 }
 
-void ExtImpactDamageManagerImpl::ensureBuffersSize(ExtPxActor* actor)
+uint32_t ExtImpactDamageManagerImpl::mergeImpacts(ImpactDamageData* impacts, uint32_t count)
 {
-	const TkAsset* tkAsset = actor->getTkActor().getAsset();
-	const uint32_t chunkCount = tkAsset->getChunkCount();
-	const uint32_t bondCount = tkAsset->getBondCount();
-
-	m_fractureBuffers.bondFractureCount = bondCount;
-	m_fractureBuffers.chunkFractureCount = chunkCount;
-	m_fractureData.resize((uint32_t)(m_fractureBuffers.bondFractureCount*sizeof(NvBlastBondFractureData) + m_fractureBuffers.chunkFractureCount*sizeof(NvBlastChunkFractureData))); // chunk count + bond count
-	m_fractureBuffers.chunkFractures = reinterpret_cast<NvBlastChunkFractureData*>(m_fractureData.begin());
-	m_fractureBuffers.bondFractures = reinterpret_cast<NvBlastBondFractureData*>(&m_fractureData.begin()[m_fractureBuffers.chunkFractureCount*sizeof(NvBlastChunkFractureData)]);
+	const float cellSize = m_settings.impactMergeRadius;
+	if (cellSize <= 0.0f || count < 2)
+	{
+		return count;
+	}
+
+	// the forces of the impacts in a cell are added, the merged position is their average weighted by force magnitude
+	const float invCellSize = 1.0f / cellSize;
+	m_mergeCells.clear();
+	m_mergeWeights.resizeUninitialized(count);
+	uint32_t mergedCount = 0;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const ImpactDamageData data = impacts[i];
+		const float weight = data.force.magnitude();
+
+		// cell coordinates wrap at 2^21, merging impacts that many cells apart is harmless
+		const uint64_t cellX = (uint64_t)(int64_t)PxFloor(data.position.x * invCellSize) & 0x1FFFFF;
+		const uint64_t cellY = (uint64_t)(int64_t)PxFloor(data.position.y * invCellSize) & 0x1FFFFF;
+		const uint64_t cellZ = (uint64_t)(int64_t)PxFloor(data.position.z * invCellSize) & 0x1FFFFF;
+		const uint64_t cell = cellX << 42 | cellY << 21 | cellZ;
+
+		const auto entry = m_mergeCells.find(cell);
+		if (entry == nullptr)
+		{
+			m_mergeCells[cell] = mergedCount;
+			impacts[mergedCount] = data;
+			impacts[mergedCount].position = data.position * weight;
+			m_mergeWeights[mergedCount] = weight;
+			mergedCount++;
+		}
+		else
+		{
+			ImpactDamageData& merged = impacts[entry->second];
+			merged.force += data.force;
+			merged.position += data.position * weight;
+			m_mergeWeights[entry->second] += weight;
+		}
+	}
+
+	for (uint32_t i = 0; i < mergedCount; ++i)
+	{
+		impacts[i].position /= m_mergeWeights[i];
+	}
+
+	return mergedCount;
 }
 
-void ExtImpactDamageManagerImpl::damageActor(ExtPxActor* actor, PxShape* /*shape*/, PxVec3 position, PxVec3 force)
+void ExtImpactDamageManagerImpl::generateDamage(ExtPxActor* actor, PxShape* /*shape*/, PxVec3 position, PxVec3 force)
 {
-	ensureBuffersSize(actor);
-
 	const float damage = m_settings.hardness > 0.f ? force.magnitude() / m_settings.hardness : 0.f;
 
 	const NvBlastExtMaterial* material = actor->getFamily().getMaterial();
@@ -388,6 +673,19 @@ void ExtImpactDamageManagerImpl::damageActor(ExtPxActor* actor, PxShape* /*shape
 	programParams.accelerator = actor->getFamily().getPxAsset().getAccelerator();
 	NvBlastDamageProgram program;
 
+	// the commands are appended to the ones of the actor's previous impacts, room is made for the worst case
+	const TkAsset* tkAsset = actor->getTkActor().getAsset();
+	const uint32_t bondFractureStart = m_bondFractures.size();
+	const uint32_t chunkFractureStart = m_chunkFractures.size();
+	m_bondFractures.resizeUninitialized(bondFractureStart + tkAsset->getBondCount());
+	m_chunkFractures.resizeUninitialized(chunkFractureStart + tkAsset->getChunkCount());
+
+	NvBlastFractureBuffers fractureEvents;
+	fractureEvents.bondFractureCount = tkAsset->getBondCount();
+	fractureEvents.chunkFractureCount = tkAsset->getChunkCount();
+	fractureEvents.bondFractures = m_bondFractures.begin() + bondFractureStart;
+	fractureEvents.chunkFractures = m_chunkFractures.begin() + chunkFractureStart;
+
 	if (m_settings.shearDamage)
 	{
 		NvBlastExtShearDamageDesc desc = {
@@ -403,9 +701,7 @@ void ExtImpactDamageManagerImpl::damageActor(ExtPxActor* actor, PxShape* /*shape
 		program.graphShaderFunction = NvBlastExtShearGraphShader;
 		program.subgraphShaderFunction = NvBlastExtShearSubgraphShader;
 
-		NvBlastFractureBuffers fractureEvents = m_fractureBuffers;
 		actor->getTkActor().generateFracture(&fractureEvents, program, &programParams);
-		actor->getTkActor().applyFracture(nullptr, &fractureEvents);
 	}
 	else
 	{
@@ -421,10 +717,29 @@ void ExtImpactDamageManagerImpl::damageActor(ExtPxActor* actor, PxShape* /*shape
 		program.graphShaderFunction = NvBlastExtImpactSpreadGraphShader;
 		program.subgraphShaderFunction = NvBlastExtImpactSpreadSubgraphShader;
 
-		NvBlastFractureBuffers fractureEvents = m_fractureBuffers;
 		actor->getTkActor().generateFracture(&fractureEvents, program, &programParams);
-		actor->getTkActor().applyFracture(nullptr, &fractureEvents);
 	}
+
+	m_bondFractures.resizeUninitialized(bondFractureStart + fractureEvents.bondFractureCount);
+	m_chunkFractures.resizeUninitialized(chunkFractureStart + fractureEvents.chunkFractureCount);
+}
+
+void ExtImpactDamageManagerImpl::applyGeneratedDamage(ExtPxActor* actor)
+{
+	if (m_bondFractures.size() == 0 && m_chunkFractures.size() == 0)
+	{
+		return;
+	}
+
+	NvBlastFractureBuffers commands;
+	commands.bondFractureCount = m_bondFractures.size();
+	commands.chunkFractureCount = m_chunkFractures.size();
+	commands.bondFractures = m_bondFractures.begin();
+	commands.chunkFractures = m_chunkFractures.begin();
+	actor->getTkActor().applyFracture(nullptr, &commands);
+
+	m_bondFractures.clear();
+	m_chunkFractures.clear();
 }
 
 
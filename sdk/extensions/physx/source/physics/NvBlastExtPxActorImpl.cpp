@@ -48,57 +48,75 @@ namespace Blast
 {
 
 
-ExtPxActorImpl::ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const PxActorCreateInfo& pxActorInfo)
-	: m_family(family), m_tkActor(tkActor)
+ExtPxActorImpl::ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const PxActorCreateInfo& pxActorInfo, PxRigidDynamic* debrisBody)
+	: m_family(family), m_tkActor(tkActor), m_isDebris(debrisBody != nullptr)
 {
-	const ExtPxChunk* pxChunks = m_family->m_pxAsset.getChunks();
-	const ExtPxSubchunk* pxSubchunks = m_family->m_pxAsset.getSubchunks();
-	const NvBlastChunk* chunks = m_tkActor->getAsset()->getChunks();
-	uint32_t nodeCount = m_tkActor->getGraphNodeCount();
-
 	PxFilterData simulationFilterData;	// Default constructor = {0,0,0,0}
 
-	// get visible chunk indices list
+	// the visible chunks with subchunks were gathered by the family's prepareActors()
+	const uint32_t* chunkIndices = m_family->m_newActorChunkIndices.begin() + pxActorInfo.m_firstChunkIndex;
+	m_chunkIndices.reserve(pxActorInfo.m_chunkCount);
+	for (uint32_t i = 0; i < pxActorInfo.m_chunkCount; ++i)
 	{
-		auto& chunkIndices = m_family->m_indicesScratch;
-		chunkIndices.resize(m_tkActor->getVisibleChunkCount());
-		m_tkActor->getVisibleChunkIndices(chunkIndices.begin(), static_cast<uint32_t>(chunkIndices.size()));
+		m_chunkIndices.pushBack(chunkIndices[i]);
+	}
 
-		// fill visible chunk indices list with mapped to our asset indices
-		m_chunkIndices.reserve(chunkIndices.size());
-		for (const uint32_t chunkIndex : chunkIndices)
-		{
-			const ExtPxChunk& chunk = pxChunks[chunkIndex];
-			if (chunk.subchunkCount == 0)
-				continue;
-			m_chunkIndices.pushBack(chunkIndex);
-		}
+	// disable contact callbacks for leaf actors
+	if (pxActorInfo.m_isLeaf)
+	{
+		simulationFilterData.word3 = ExtPxManager::LEAF_CHUNK;	// mark as leaf chunk if chunk has no children
+	}
 
-		// Single lower-support chunk actors might be leaf actors, check for this and disable contact callbacks if so
-		if (nodeCount <= 1)
-		{
-			NVBLAST_ASSERT(chunkIndices.size() == 1);
-			if (chunkIndices.size() > 0)
-			{
-				const NvBlastChunk& chunk = chunks[chunkIndices[0]];
-				if (chunk.firstChildIndex == chunk.childIndexStop)
-				{
-					simulationFilterData.word3 = ExtPxManager::LEAF_CHUNK;	// mark as leaf chunk if chunk has no children
-				}
-			}
-		}
+	// store pointer to actor in blast userData
+	m_tkActor->userData = this;
+
+	// a debris actor only adds its shapes to the shared body, the family sets the body up once all its actors are created
+	if (m_isDebris)
+	{
+		m_rigidDynamic = debrisBody;
+		attachShapes(simulationFilterData);
+		return;
 	}
 
-	// create rigidDynamic and setup
-	PxPhysics& physics = m_family->m_manager.m_physics;
-	m_rigidDynamic = physics.createRigidDynamic(pxActorInfo.m_transform);
+	// create rigidDynamic, or reuse one from the manager's pool, and setup
+	m_rigidDynamic = m_family->m_manager.acquireRigidDynamic(pxActorInfo.m_transform);
 	if (m_family->m_pxActorDescTemplate != nullptr)
 	{
 		m_rigidDynamic->setActorFlags(static_cast<physx::PxActorFlags>(m_family->m_pxActorDescTemplate->flags));
 	}
 
-	// fill rigidDynamic with shapes
-	PxMaterial* material = m_family->m_spawnSettings.material;
+	// fill rigidDynamic with shapes, reusing the shapes the family kept from previous actors
+	attachShapes(simulationFilterData);
+
+	// make actor static if it contains static chunk
+	m_rigidDynamic->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, pxActorInfo.m_isStatic);
+
+	// store pointer to actor in px userData
+	m_family->m_manager.registerActor(m_rigidDynamic, this);
+
+	// update mass properties, from the sum prepared by the family unless some shapes do not count for mass
+	const ExtPxShapeDescTemplate* pxShapeDesc = m_family->m_pxShapeDescTemplate;
+	const bool simulationShapes = pxShapeDesc == nullptr || (pxShapeDesc->flags & PxShapeFlag::eSIMULATION_SHAPE) != 0;
+	if (pxActorInfo.m_chunkCount > 0 && simulationShapes)
+	{
+		const PxMassProperties massProperties = pxActorInfo.m_massProperties * m_family->m_spawnSettings.density;
+		PxQuat massFrame;
+		const PxVec3 massSpaceInertia = PxMassProperties::getMassSpaceInertia(massProperties.inertiaTensor, massFrame);
+		m_rigidDynamic->setMass(massProperties.mass);
+		m_rigidDynamic->setMassSpaceInertiaTensor(massSpaceInertia);
+		m_rigidDynamic->setCMassLocalPose(PxTransform(massProperties.centerOfMass, massFrame));
+	}
+	else
+	{
+		PxRigidBodyExt::updateMassAndInertia(*m_rigidDynamic, m_family->m_spawnSettings.density);
+	}
+
+	initVelocity(*m_rigidDynamic, pxActorInfo);
+}
+
+void ExtPxActorImpl::attachShapes(const PxFilterData& simulationFilterData)
+{
+	const ExtPxChunk* pxChunks = m_family->m_pxAsset.getChunks();
 	for (uint32_t i = 0; i < m_chunkIndices.size(); ++i)
 	{
 		uint32_t chunkID = m_chunkIndices[i];
@@ -106,9 +124,7 @@ ExtPxActorImpl::ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const
 		for (uint32_t c = 0; c < chunk.subchunkCount; c++)
 		{
 			const uint32_t subchunkIndex = chunk.firstSubchunkIndex + c;
-			auto& subchunk = pxSubchunks[subchunkIndex];
-			PxShape* shape = physics.createShape(subchunk.geometry, *material);
-			shape->setLocalPose(subchunk.transform);
+			PxShape* shape = m_family->acquireSubchunkShape(subchunkIndex);
 
 			const ExtPxShapeDescTemplate* pxShapeDesc = m_family->m_pxShapeDescTemplate;
 			if (pxShapeDesc != nullptr)
@@ -121,7 +137,12 @@ ExtPxActorImpl::ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const
 			}
 			else
 			{
+				// a pooled shape may have been set up by a template, reset it to the defaults of a new shape
+				shape->setFlags(PxShapeFlag::eVISUALIZATION | PxShapeFlag::eSCENE_QUERY_SHAPE | PxShapeFlag::eSIMULATION_SHAPE);
 				shape->setSimulationFilterData(simulationFilterData);
+				shape->setQueryFilterData(PxFilterData());
+				shape->setRestOffset(0.0f);
+				shape->setContactOffset(0.02f * m_family->m_manager.getPhysics().getTolerancesScale().length);
 			}
 
 			m_rigidDynamic->attachShape(*shape);
@@ -130,42 +151,32 @@ ExtPxActorImpl::ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const
 			m_family->m_subchunkShapes[subchunkIndex] = shape;
 		}
 	}
+}
 
-	// search for static chunk in actor's graph (make actor static if it contains static chunk)
-	bool staticFound = m_tkActor->isBoundToWorld();
-	if (nodeCount > 0)
+void ExtPxActorImpl::detachShapes()
+{
+	const ExtPxChunk* pxChunks = m_family->m_pxAsset.getChunks();
+	for (uint32_t chunkID : m_chunkIndices)
 	{
-		auto& graphNodeIndices = m_family->m_indicesScratch;
-		graphNodeIndices.resize(nodeCount);
-		m_tkActor->getGraphNodeIndices(graphNodeIndices.begin(), static_cast<uint32_t>(graphNodeIndices.size()));
-		const NvBlastSupportGraph graph = m_tkActor->getAsset()->getGraph();
-
-		for (uint32_t i = 0; !staticFound && i < graphNodeIndices.size(); ++i)
+		const ExtPxChunk& chunk = pxChunks[chunkID];
+		for (uint32_t c = 0; c < chunk.subchunkCount; c++)
 		{
-			const uint32_t chunkIndex = graph.chunkIndices[graphNodeIndices[i]];
-			const ExtPxChunk& chunk = pxChunks[chunkIndex];
-			staticFound = chunk.isStatic;
+			const uint32_t subchunkIndex = chunk.firstSubchunkIndex + c;
+			m_rigidDynamic->detachShape(*m_family->m_subchunkShapes[subchunkIndex]);
 		}
 	}
-	m_rigidDynamic->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, staticFound);
-
-	// store pointer to actor in px userData
-	m_family->m_manager.registerActor(m_rigidDynamic, this);
-
-	// store pointer to actor in blast userData
-	m_tkActor->userData = this;
-
-	// update mass properties
-	PxRigidBodyExt::updateMassAndInertia(*m_rigidDynamic, m_family->m_spawnSettings.density);
+}
 
+void ExtPxActorImpl::initVelocity(PxRigidDynamic& rigidDynamic, const PxActorCreateInfo& pxActorInfo)
+{
 	// set initial velocities
-	if (!(m_rigidDynamic->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC))
+	if (!(rigidDynamic.getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC))
 	{
-		const PxVec3 COM = m_rigidDynamic->getGlobalPose().transform(m_rigidDynamic->getCMassLocalPose().p);
+		const PxVec3 COM = rigidDynamic.getGlobalPose().transform(rigidDynamic.getCMassLocalPose().p);
 		const PxVec3 linearVelocity = pxActorInfo.m_parentLinearVelocity + pxActorInfo.m_parentAngularVelocity.cross(COM - pxActorInfo.m_parentCOM);
 		const PxVec3 angularVelocity = pxActorInfo.m_parentAngularVelocity;
-		m_rigidDynamic->setLinearVelocity(linearVelocity);
-		m_rigidDynamic->setAngularVelocity(angularVelocity);
+		rigidDynamic.setLinearVelocity(linearVelocity);
+		rigidDynamic.setAngularVelocity(angularVelocity);
 	}
 }
 
@@ -173,11 +184,16 @@ void ExtPxActorImpl::release()
 {
 	if (m_rigidDynamic != nullptr)
 	{
-		m_family->m_manager.unregisterActor(m_rigidDynamic);
-		m_rigidDynamic->release();
+		// a debris body is only released with the last of its actors, the others just take their shapes off it
+		if (!m_isDebris || !m_family->releaseDebrisActor(*this))
+		{
+			m_family->m_manager.unregisterActor(m_rigidDynamic);
+			m_family->m_manager.releaseRigidDynamic(*m_rigidDynamic);
+		}
 		m_rigidDynamic = nullptr;
 	}
 
+	// the shapes detached by the rigidDynamic's release stay alive in the family's pool for the next actors
 	const ExtPxChunk* pxChunks = m_family->m_pxAsset.getChunks();
 	for (uint32_t chunkID : m_chunkIndices)
 	{
@@ -186,6 +202,7 @@ void ExtPxActorImpl::release()
 		{
 			const uint32_t subchunkIndex = chunk.firstSubchunkIndex + c;
 			m_family->m_subchunkShapes[subchunkIndex] = nullptr;
+			m_family->m_pooledShapeCount++;
 		}
 	}
 	m_chunkIndices.clear();
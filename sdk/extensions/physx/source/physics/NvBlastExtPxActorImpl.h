@@ -32,6 +32,14 @@
 #include "NvBlastExtPxActor.h"
 #include "NvBlastArray.h"
 #include "PxTransform.h"
+#include "PxMassProperties.h"
+
+
+// Forward declarations
+namespace physx
+{
+struct PxFilterData;
+}
 
 
 using namespace physx;
@@ -52,15 +60,28 @@ struct PxActorCreateInfo
 	PxVec3		m_parentLinearVelocity;
 	PxVec3		m_parentAngularVelocity;
 	PxVec3		m_parentCOM;
+
+	// filled by ExtPxFamilyImpl::prepareActors()
+	uint32_t			m_firstChunkIndex;		//!< first of the actor's chunks with subchunks in ExtPxFamilyImpl::m_newActorChunkIndices
+	uint32_t			m_chunkCount;			//!< number of the actor's chunks with subchunks
+	uint32_t			m_firstGraphNodeIndex;	//!< first of the actor's graph nodes in ExtPxFamilyImpl::m_newActorGraphNodeIndices
+	bool				m_isLeaf;				//!< the actor is a single chunk without children
+	bool				m_isStatic;				//!< the actor is bound to the world or has a static chunk
+	PxMassProperties	m_massProperties;		//!< mass properties of the actor's subchunks for a unit density, if m_chunkCount > 0
 };
 
 
 class ExtPxActorImpl final : public ExtPxActor
 {
 public:
+	friend ExtPxFamilyImpl;
+
 	//////// ctor ////////
 
-	ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const PxActorCreateInfo& pxActorInfo);
+	/**
+	Create the actor and its rigidDynamic.  If debrisBody is given the actor's shapes are attached to it instead, the family sets up the shared body.
+	*/
+	ExtPxActorImpl(ExtPxFamilyImpl* family, TkActor* tkActor, const PxActorCreateInfo& pxActorInfo, PxRigidDynamic* debrisBody = nullptr);
 
 	~ExtPxActorImpl()
 	{
@@ -95,13 +116,32 @@ public:
 	virtual ExtPxFamily&				getFamily() const override;
 
 
+	//////// internal public methods ////////
+
+	bool								isDebris() const
+	{
+		return m_isDebris;
+	}
+
+	/**
+	Give a rigidDynamic with mass the velocity it had as part of its parent actor.
+	*/
+	static void							initVelocity(PxRigidDynamic& rigidDynamic, const PxActorCreateInfo& pxActorInfo);
+
+
 private:
+	//////// private methods ////////
+
+	void								attachShapes(const PxFilterData& simulationFilterData);
+	void								detachShapes();
+
 	//////// data ////////
 
 	ExtPxFamilyImpl*					m_family;
 	TkActor*							m_tkActor;
 	PxRigidDynamic*						m_rigidDynamic;
 	InlineArray<uint32_t, 4>::type		m_chunkIndices;
+	bool								m_isDebris;		//!< m_rigidDynamic is a debris body shared with other actors of the family
 };
 
 
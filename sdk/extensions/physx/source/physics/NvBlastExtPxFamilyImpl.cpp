@@ -35,11 +35,15 @@
 #include "NvBlastTkFamily.h"
 #include "NvBlastTkActor.h"
 #include "NvBlastTkJoint.h"
+#include "NvBlastTkAsset.h"
 
 #include "NvBlastAssert.h"
 
 #include "PxRigidDynamic.h"
 #include "PxScene.h"
+#include "PxPhysics.h"
+#include "PxShape.h"
+#include "PxRigidBodyExt.h"
 
 #include <algorithm>
 
@@ -49,6 +53,20 @@ namespace Nv
 namespace Blast
 {
 
+/**
+What ExtPxFamilyImpl::applyActorBudget() does with a new actor.
+*/
+struct BudgetAction
+{
+	enum Enum
+	{
+		OwnBody,
+		Sleep,
+		Debris,
+		Cull
+	};
+};
+
 
 ExtPxFamilyImpl::ExtPxFamilyImpl(ExtPxManagerImpl& manager, TkFamily& tkFamily, ExtPxAsset& pxAsset)
 	: m_manager(manager)
@@ -58,8 +76,10 @@ ExtPxFamilyImpl::ExtPxFamilyImpl(ExtPxManagerImpl& manager, TkFamily& tkFamily,
 	, m_pxActorDescTemplate(nullptr)
 	, m_material(nullptr)
 	, m_isSpawned(false)
+	, m_pooledShapeCount(0)
 {
 	m_subchunkShapes.resize(static_cast<uint32_t>(m_pxAsset.getSubchunkCount()));
+	m_shapePool.resize(static_cast<uint32_t>(m_pxAsset.getSubchunkCount()));
 
 	userData = nullptr;
 
@@ -84,6 +104,8 @@ ExtPxFamilyImpl::~ExtPxFamilyImpl()
 		destroyActors(actors.begin(), actors.size());
 	}
 
+	releasePooledShapes();
+
 	m_tkFamily.release();
 }
 
@@ -116,6 +138,7 @@ bool ExtPxFamilyImpl::spawn(const physx::PxTransform& pose, const physx::PxVec3&
 	// preallocate memory
 	m_newActorsBuffer.resize(splitMaxActorCount);
 	m_newActorCreateInfo.resize(splitMaxActorCount);
+	m_newActorSplitIndices.resize(splitMaxActorCount);
 	m_physXActorsBuffer.resize(splitMaxActorCount);
 	m_physXActorsBuffer.resize(splitMaxActorCount);
 	m_indicesScratch.reserve(splitMaxActorCount);
@@ -131,10 +154,11 @@ bool ExtPxFamilyImpl::spawn(const physx::PxTransform& pose, const physx::PxVec3&
 	}
 
 	// create first actors in family
+	computeChunkMassProperties();
 	createActors(m_newActorsBuffer.begin(), m_newActorCreateInfo.begin(), actorCount);
 
-	// listen family for new actors
-	m_tkFamily.addListener(*this);
+	// listen family for new actors and joint updates
+	m_tkFamily.addListener(*this, TkEvent::SplitBit | TkEvent::JointUpdateBit | TkEvent::JointUpdateBatchBit);
 
 	m_isSpawned = true;
 
@@ -162,6 +186,7 @@ void ExtPxFamilyImpl::receive(const TkEvent* events, uint32_t eventCount)
 	auto& actorsToDelete = m_actorsBuffer;
 	actorsToDelete.clear();
 	uint32_t totalNewActorsCount = 0;
+	uint32_t splitCount = 0;
 
 	for (uint32_t i = 0; i < eventCount; ++i)
 	{
@@ -193,9 +218,11 @@ void ExtPxFamilyImpl::receive(const TkEvent* events, uint32_t eventCount)
 				m_newActorCreateInfo[j].m_parentAngularVelocity = parentPxActor ? parentPxActor->getAngularVelocity() : PxVec3(PxZero);
 
 				m_newActorsBuffer[j] = splitEvent->children[j - totalNewActorsCount];
+				m_newActorSplitIndices[j] = splitCount;
 			}
 
 			totalNewActorsCount += newActorsCount;
+			splitCount++;
 
 			if (parentActor)
 			{
@@ -207,20 +234,16 @@ void ExtPxFamilyImpl::receive(const TkEvent* events, uint32_t eventCount)
 	destroyActors(actorsToDelete.begin(), actorsToDelete.size());
 	if (totalNewActorsCount > 0)
 	{
-		uint32_t cappedNewActorsCount = totalNewActorsCount;
 		const uint32_t actorCountLimit = m_manager.getActorCountLimit();
 		const uint32_t totalActorCount = m_manager.getPxActorCount();
-		if (actorCountLimit > 0 && cappedNewActorsCount + totalActorCount > actorCountLimit)
+		if (actorCountLimit > 0 && totalNewActorsCount + totalActorCount > actorCountLimit)
 		{
-			cappedNewActorsCount = actorCountLimit > totalActorCount ? actorCountLimit - totalActorCount : 0;
+			applyActorBudget(totalNewActorsCount, actorCountLimit > totalActorCount ? actorCountLimit - totalActorCount : 0);
 		}
-		createActors(m_newActorsBuffer.begin(), m_newActorCreateInfo.begin(), cappedNewActorsCount);
-		m_culledActors.reserve(m_culledActors.size() + totalNewActorsCount - cappedNewActorsCount);
-		for (uint32_t i = cappedNewActorsCount; i < totalNewActorsCount; ++i)
+		else
 		{
-			m_culledActors.pushBack(m_newActorsBuffer[i]);
+			createActors(m_newActorsBuffer.begin(), m_newActorCreateInfo.begin(), totalNewActorsCount);
 		}
-		totalNewActorsCount = cappedNewActorsCount;	// In case it's used below
 	}
 
 	for (uint32_t i = 0; i < eventCount; ++i)
@@ -228,60 +251,442 @@ void ExtPxFamilyImpl::receive(const TkEvent* events, uint32_t eventCount)
 		const TkEvent& e = events[i];
 		if (e.type == TkEvent::JointUpdate)
 		{
-			const TkJointUpdateEvent* jointEvent = e.getPayload<TkJointUpdateEvent>();
-			NVBLAST_ASSERT(jointEvent->joint);
-			TkJoint& joint = *jointEvent->joint;
-
-			switch (jointEvent->subtype)
+			processJointUpdate(*e.getPayload<TkJointUpdateEvent>());
+		}
+		else if (e.type == TkEvent::JointUpdateBatch)
+		{
+			const TkJointUpdateBatchEvent* batchEvent = e.getPayload<TkJointUpdateBatchEvent>();
+			for (uint32_t j = 0; j < batchEvent->jointUpdateCount; ++j)
 			{
-			case TkJointUpdateEvent::External:
-				m_manager.createJoint(joint);
-				break;
-			case TkJointUpdateEvent::Changed:
-				m_manager.updateJoint(joint);
-				break;
-			case TkJointUpdateEvent::Unreferenced:
-				m_manager.destroyJoint(joint);
-				joint.release();
-				break;
+				processJointUpdate(batchEvent->jointUpdates[j]);
 			}
 		}
 	}
 }
 
-void ExtPxFamilyImpl::createActors(TkActor** tkActors, const PxActorCreateInfo* pxActorInfos, uint32_t count)
+void ExtPxFamilyImpl::processJointUpdate(const TkJointUpdateEvent& jointEvent)
+{
+	NVBLAST_ASSERT(jointEvent.joint);
+	TkJoint& joint = *jointEvent.joint;
+
+	switch (jointEvent.subtype)
+	{
+	case TkJointUpdateEvent::External:
+		m_manager.createJoint(joint);
+		break;
+	case TkJointUpdateEvent::Changed:
+		m_manager.updateJoint(joint);
+		break;
+	case TkJointUpdateEvent::Unreferenced:
+		m_manager.destroyJoint(joint);
+		joint.release();
+		break;
+	}
+}
+
+void ExtPxFamilyImpl::addActor(ExtPxActorImpl* actor)
+{
+	m_actors.insert(actor);
+	dispatchActorCreated(*actor);
+
+	// Handle incomplete joints
+	TkActor* tkActor = &actor->getTkActor();
+	auto e = m_manager.m_incompleteJointMultiMap.find(tkActor);
+	if (e != nullptr)
+	{
+		Array<TkJoint*>::type joints = e->second;	// Copying the array
+		m_manager.m_incompleteJointMultiMap.erase(tkActor);
+		for (uint32_t j = 0; j < joints.size(); ++j)
+		{
+			m_manager.updateJoint(*joints[j]);
+		}
+	}
+}
+
+void ExtPxFamilyImpl::createActors(TkActor** tkActors, PxActorCreateInfo* pxActorInfos, uint32_t count)
 {
+	prepareActors(tkActors, pxActorInfos, count);
+
 	auto actorsToAdd = m_physXActorsBuffer.begin();
 	for (uint32_t i = 0; i < count; ++i)
 	{
 		ExtPxActorImpl* actor = NVBLAST_NEW(ExtPxActorImpl)(this, tkActors[i], pxActorInfos[i]);
-		m_actors.insert(actor);
 		actorsToAdd[i] = &actor->getPhysXActor();
-		dispatchActorCreated(*actor);
+		addActor(actor);
+	}
+	m_spawnSettings.scene->addActors(actorsToAdd, static_cast<uint32_t>(count));
+}
+
+void ExtPxFamilyImpl::prepareActors(TkActor** tkActors, PxActorCreateInfo* pxActorInfos, uint32_t count)
+{
+	// lay the actors' chunk and graph node indices out, so that they can be prepared concurrently
+	uint32_t chunkIndexCount = 0;
+	uint32_t graphNodeIndexCount = 0;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		pxActorInfos[i].m_firstChunkIndex = chunkIndexCount;
+		pxActorInfos[i].m_firstGraphNodeIndex = graphNodeIndexCount;
+		chunkIndexCount += tkActors[i]->getVisibleChunkCount();
+		graphNodeIndexCount += tkActors[i]->getGraphNodeCount();
+	}
+	m_newActorChunkIndices.resizeUninitialized(chunkIndexCount);
+	m_newActorGraphNodeIndices.resizeUninitialized(graphNodeIndexCount);
+
+	TkGroupTaskRunner* taskRunner = m_manager.getTaskRunner();
+	const uint32_t taskCount = taskRunner != nullptr ? std::min(taskRunner->getMaxTaskCount(), count / ACTORS_PER_PREPARE_TASK) : 0;
+	if (taskCount > 1)
+	{
+		PrepareTasks tasks(*this, tkActors, pxActorInfos, count, taskCount);
+		taskRunner->run(tasks, taskCount);
+	}
+	else
+	{
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			prepareActor(*tkActors[i], pxActorInfos[i]);
+		}
+	}
+}
+
+void ExtPxFamilyImpl::PrepareTasks::execute(uint32_t taskIndex)
+{
+	const uint32_t start = (uint32_t)((uint64_t)m_count * taskIndex / m_taskCount);
+	const uint32_t end = (uint32_t)((uint64_t)m_count * (taskIndex + 1) / m_taskCount);
+	for (uint32_t i = start; i < end; i++)
+	{
+		m_family.prepareActor(*m_tkActors[i], m_pxActorInfos[i]);
+	}
+}
+
+void ExtPxFamilyImpl::prepareActor(TkActor& tkActor, PxActorCreateInfo& pxActorInfo)
+{
+	const ExtPxChunk* pxChunks = m_pxAsset.getChunks();
+	const NvBlastChunk* chunks = tkActor.getAsset()->getChunks();
+	const uint32_t nodeCount = tkActor.getGraphNodeCount();
+
+	// get visible chunk indices list
+	uint32_t* chunkIndices = m_newActorChunkIndices.begin() + pxActorInfo.m_firstChunkIndex;
+	const uint32_t visibleChunkCount = tkActor.getVisibleChunkIndices(chunkIndices, tkActor.getVisibleChunkCount());
+
+	// Single lower-support chunk actors might be leaf actors, check for this
+	pxActorInfo.m_isLeaf = false;
+	if (nodeCount <= 1)
+	{
+		NVBLAST_ASSERT(visibleChunkCount == 1);
+		if (visibleChunkCount > 0)
+		{
+			const NvBlastChunk& chunk = chunks[chunkIndices[0]];
+			pxActorInfo.m_isLeaf = chunk.firstChildIndex == chunk.childIndexStop;
+		}
+	}
+
+	// keep the chunks with subchunks and sum their mass properties, pairwise so that no memory is needed
+	PxMassProperties massProperties[2];
+	const PxTransform identities[2] = { PxTransform(PxIdentity), PxTransform(PxIdentity) };
+	uint32_t chunkCount = 0;
+	for (uint32_t i = 0; i < visibleChunkCount; ++i)
+	{
+		const uint32_t chunkIndex = chunkIndices[i];
+		if (pxChunks[chunkIndex].subchunkCount == 0)
+			continue;
+		if (chunkCount == 0)
+		{
+			massProperties[0] = m_chunkMassProperties[chunkIndex];
+		}
+		else
+		{
+			massProperties[1] = m_chunkMassProperties[chunkIndex];
+			massProperties[0] = PxMassProperties::sum(massProperties, identities, 2);
+		}
+		chunkIndices[chunkCount++] = chunkIndex;
+	}
+	pxActorInfo.m_chunkCount = chunkCount;
+	pxActorInfo.m_massProperties = massProperties[0];
+
+	// search for static chunk in actor's graph
+	bool staticFound = tkActor.isBoundToWorld();
+	if (nodeCount > 0)
+	{
+		uint32_t* graphNodeIndices = m_newActorGraphNodeIndices.begin() + pxActorInfo.m_firstGraphNodeIndex;
+		tkActor.getGraphNodeIndices(graphNodeIndices, nodeCount);
+		const NvBlastSupportGraph graph = tkActor.getAsset()->getGraph();
+
+		for (uint32_t i = 0; !staticFound && i < nodeCount; ++i)
+		{
+			const uint32_t chunkIndex = graph.chunkIndices[graphNodeIndices[i]];
+			staticFound = pxChunks[chunkIndex].isStatic;
+		}
+	}
+	pxActorInfo.m_isStatic = staticFound;
+}
+
+void ExtPxFamilyImpl::computeChunkMassProperties()
+{
+	const ExtPxChunk* pxChunks = m_pxAsset.getChunks();
+	const ExtPxSubchunk* subchunks = m_pxAsset.getSubchunks();
+	const uint32_t chunkCount = m_pxAsset.getChunkCount();
+
+	Array<PxMassProperties>::type subchunkMassProperties;
+	Array<PxTransform>::type subchunkTransforms;
+	m_chunkMassProperties.resize(chunkCount);
+	for (uint32_t i = 0; i < chunkCount; ++i)
+	{
+		const ExtPxChunk& chunk = pxChunks[i];
+		if (chunk.subchunkCount == 0)
+			continue;
+
+		subchunkMassProperties.resize(0);
+		subchunkTransforms.resize(0);
+		for (uint32_t c = 0; c < chunk.subchunkCount; c++)
+		{
+			const ExtPxSubchunk& subchunk = subchunks[chunk.firstSubchunkIndex + c];
+			subchunkMassProperties.pushBack(PxMassProperties(subchunk.geometry));
+			subchunkTransforms.pushBack(subchunk.transform);
+		}
+		m_chunkMassProperties[i] = PxMassProperties::sum(subchunkMassProperties.begin(), subchunkTransforms.begin(), chunk.subchunkCount);
+	}
+}
+
+void ExtPxFamilyImpl::applyActorBudget(uint32_t count, uint32_t availableCount)
+{
+	prepareActors(m_newActorsBuffer.begin(), m_newActorCreateInfo.begin(), count);
+
+	// rank the new actors, the most important first
+	m_newActorPriorities.resizeUninitialized(count);
+	m_budgetOrder.resizeUninitialized(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		m_newActorPriorities[i] = getActorPriority(i);
+		m_budgetOrder[i] = i;
+	}
+	const float* priorities = m_newActorPriorities.begin();
+	std::sort(m_budgetOrder.begin(), m_budgetOrder.end(), [priorities](uint32_t a, uint32_t b)
+	{
+		return priorities[a] > priorities[b] || (priorities[a] == priorities[b] && a < b);
+	});
+
+	// the actors ranked within the available count get their own body, what happens to the others depends on the budget mode
+	const ExtPxActorBudgetMode::Enum mode = m_manager.getActorBudgetMode();
+	auto& actions = m_budgetActions;
+	actions.resizeUninitialized(count);
+	for (uint32_t rank = 0; rank < count; ++rank)
+	{
+		uint8_t action = BudgetAction::OwnBody;
+		if (rank >= availableCount)
+		{
+			action = mode == ExtPxActorBudgetMode::Sleep ? BudgetAction::Sleep : mode == ExtPxActorBudgetMode::Cull ? BudgetAction::Cull : BudgetAction::OwnBody;
+		}
+		actions[m_budgetOrder[rank]] = action;
+	}
+
+	const uint32_t splitCount = m_newActorSplitIndices[count - 1] + 1;
+	m_debrisActorCounts.resize(0);
+	m_debrisActorCounts.resize(splitCount, 0);
+	m_debrisSplitBodies.resize(0);
+	m_debrisSplitBodies.resize(splitCount, nullptr);
+
+	if (mode == ExtPxActorBudgetMode::Merge)
+	{
+		// the least important actors give their own body up, leaf actors are merged into one debris body per split and the others culled.
+		// The most important actor keeps its own body.
+		uint32_t ownBodyCount = count;
+		uint32_t bodyCount = count;
+		while (ownBodyCount > 1 && bodyCount > availableCount)
+		{
+			const uint32_t i = m_budgetOrder[--ownBodyCount];
+			if (isDebrisCandidate(i))
+			{
+				actions[i] = BudgetAction::Debris;
+				if (m_debrisActorCounts[m_newActorSplitIndices[i]]++ > 0)
+				{
+					bodyCount--;
+				}
+			}
+			else
+			{
+				actions[i] = BudgetAction::Cull;
+				bodyCount--;
+			}
+		}
 
-		// Handle incomplete joints
-		auto e = m_manager.m_incompleteJointMultiMap.find(tkActors[i]);
-		if (e != nullptr)
+		// still too many bodies, cull the least important actors, a debris body goes with its last actor
+		for (uint32_t rank = count; rank-- > 0 && bodyCount > availableCount;)
 		{
-			Array<TkJoint*>::type joints = e->second;	// Copying the array
-			m_manager.m_incompleteJointMultiMap.erase(tkActors[i]);
-			for (uint32_t j = 0; j < joints.size(); ++j)
+			const uint32_t i = m_budgetOrder[rank];
+			if (actions[i] == BudgetAction::Debris)
 			{
-				m_manager.updateJoint(*joints[j]);
+				actions[i] = BudgetAction::Cull;
+				if (--m_debrisActorCounts[m_newActorSplitIndices[i]] == 0)
+				{
+					bodyCount--;
+				}
+			}
+			else if (actions[i] == BudgetAction::OwnBody)
+			{
+				actions[i] = BudgetAction::Cull;
+				bodyCount--;
+			}
+		}
+	}
+
+	// create the actors in priority order, the debris bodies are set up once they have all their shapes
+	auto actorsToAdd = m_physXActorsBuffer.begin();
+	uint32_t addCount = 0;
+	for (uint32_t rank = 0; rank < count; ++rank)
+	{
+		const uint32_t i = m_budgetOrder[rank];
+		TkActor* tkActor = m_newActorsBuffer[i];
+		const PxActorCreateInfo& pxActorInfo = m_newActorCreateInfo[i];
+		if (actions[i] == BudgetAction::OwnBody || actions[i] == BudgetAction::Sleep)
+		{
+			ExtPxActorImpl* actor = NVBLAST_NEW(ExtPxActorImpl)(this, tkActor, pxActorInfo);
+			actorsToAdd[addCount++] = &actor->getPhysXActor();
+			addActor(actor);
+		}
+		else if (actions[i] == BudgetAction::Debris)
+		{
+			PxRigidDynamic*& debrisBody = m_debrisSplitBodies[m_newActorSplitIndices[i]];
+			if (debrisBody == nullptr)
+			{
+				debrisBody = m_manager.acquireRigidDynamic(pxActorInfo.m_transform);
+				if (m_pxActorDescTemplate != nullptr)
+				{
+					debrisBody->setActorFlags(static_cast<physx::PxActorFlags>(m_pxActorDescTemplate->flags));
+				}
+				actorsToAdd[addCount++] = debrisBody;
+			}
+			ExtPxActorImpl* actor = NVBLAST_NEW(ExtPxActorImpl)(this, tkActor, pxActorInfo, debrisBody);
+			m_debrisBodies[debrisBody].pushBack(actor);
+		}
+		else
+		{
+			m_culledActors.pushBack(tkActor);
+		}
+	}
+
+	// the actors of a split share their parent's pose and velocity, any of them sets the debris body up
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		PxRigidDynamic*& debrisBody = m_debrisSplitBodies[m_newActorSplitIndices[i]];
+		if (actions[i] == BudgetAction::Debris && debrisBody != nullptr)
+		{
+			const Array<ExtPxActorImpl*>::type& debrisActors = m_debrisBodies[debrisBody];
+			m_manager.registerActor(debrisBody, debrisActors[0]);
+			PxRigidBodyExt::updateMassAndInertia(*debrisBody, m_spawnSettings.density);
+			ExtPxActorImpl::initVelocity(*debrisBody, m_newActorCreateInfo[i]);
+			for (ExtPxActorImpl* actor : debrisActors)
+			{
+				addActor(actor);
+			}
+			debrisBody = nullptr;
+		}
+	}
+
+	m_spawnSettings.scene->addActors(actorsToAdd, addCount);
+
+	// sleeping requires the bodies to be in the scene
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		if (actions[i] == BudgetAction::Sleep)
+		{
+			PxRigidDynamic& rigidDynamic = reinterpret_cast<ExtPxActorImpl*>(m_newActorsBuffer[i]->userData)->getPhysXActor();
+			if (!(rigidDynamic.getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC))
+			{
+				rigidDynamic.putToSleep();
 			}
 		}
 	}
-	m_spawnSettings.scene->addActors(actorsToAdd, static_cast<uint32_t>(count));
+}
+
+float ExtPxFamilyImpl::getActorPriority(uint32_t newActorIndex)
+{
+	TkActor& tkActor = *m_newActorsBuffer[newActorIndex];
+	ExtPxActorPriorityCallback* callback = m_manager.getActorPriorityCallback();
+	if (callback != nullptr)
+	{
+		return callback->getActorPriority(*this, tkActor, m_newActorCreateInfo[newActorIndex].m_transform);
+	}
+
+	// by default the biggest actors are kept first
+	const NvBlastChunk* chunks = tkActor.getAsset()->getChunks();
+	auto& chunkIndices = m_indicesScratch;
+	chunkIndices.resize(tkActor.getVisibleChunkCount());
+	tkActor.getVisibleChunkIndices(chunkIndices.begin(), chunkIndices.size());
+	float volume = 0.0f;
+	for (const uint32_t chunkIndex : chunkIndices)
+	{
+		volume += chunks[chunkIndex].volume;
+	}
+	return volume;
+}
+
+bool ExtPxFamilyImpl::isDebrisCandidate(uint32_t newActorIndex) const
+{
+	const PxActorCreateInfo& pxActorInfo = m_newActorCreateInfo[newActorIndex];
+	return pxActorInfo.m_isLeaf && !pxActorInfo.m_isStatic && m_newActorsBuffer[newActorIndex]->getJointCount() == 0;
+}
+
+bool ExtPxFamilyImpl::releaseDebrisActor(ExtPxActorImpl& actor)
+{
+	PxRigidDynamic& debrisBody = actor.getPhysXActor();
+	NVBLAST_ASSERT(m_debrisBodies.find(&debrisBody) != nullptr);
+	Array<ExtPxActorImpl*>::type& debrisActors = m_debrisBodies[&debrisBody];
+	debrisActors.findAndReplaceWithLast(&actor);
+
+	if (debrisActors.size() == 0)
+	{
+		m_debrisBodies.erase(&debrisBody);
+		m_spawnSettings.scene->removeActor(debrisBody);
+		return false;
+	}
+
+	actor.detachShapes();
+	PxRigidBodyExt::updateMassAndInertia(debrisBody, m_spawnSettings.density);
+	m_manager.registerActor(&debrisBody, debrisActors[0]);
+	return true;
+}
+
+ExtPxActorImpl* ExtPxFamilyImpl::getDebrisActorFromShape(const PxRigidDynamic& debrisBody, const PxShape& shape) const
+{
+	const auto entry = m_debrisBodies.find(const_cast<PxRigidDynamic*>(&debrisBody));
+	if (entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	// debris actors are single leaf chunks, only a few shapes to compare
+	const ExtPxChunk* pxChunks = m_pxAsset.getChunks();
+	for (ExtPxActorImpl* actor : entry->second)
+	{
+		const uint32_t* chunkIndices = actor->getChunkIndices();
+		for (uint32_t i = 0; i < actor->getChunkCount(); i++)
+		{
+			const ExtPxChunk& chunk = pxChunks[chunkIndices[i]];
+			for (uint32_t c = 0; c < chunk.subchunkCount; c++)
+			{
+				if (m_subchunkShapes[chunk.firstSubchunkIndex + c] == &shape)
+				{
+					return actor;
+				}
+			}
+		}
+	}
+	return nullptr;
 }
 
 void ExtPxFamilyImpl::destroyActors(ExtPxActor** actors, uint32_t count)
 {
+	// debris bodies are removed from the scene with their last actor
 	auto pxActorsToRemove = m_physXActorsBuffer.begin();
+	uint32_t removeCount = 0;
 	for (uint32_t i = 0; i < count; ++i)
 	{
-		pxActorsToRemove[i] = &actors[i]->getPhysXActor();
+		if (!static_cast<ExtPxActorImpl*>(actors[i])->isDebris())
+		{
+			pxActorsToRemove[removeCount++] = &actors[i]->getPhysXActor();
+		}
 	}
-	m_spawnSettings.scene->removeActors(pxActorsToRemove, static_cast<uint32_t>(count));
+	m_spawnSettings.scene->removeActors(pxActorsToRemove, removeCount);
 
 	for (uint32_t i = 0; i < count; ++i)
 	{
@@ -292,6 +697,47 @@ void ExtPxFamilyImpl::destroyActors(ExtPxActor** actors, uint32_t count)
 	}
 }
 
+PxShape* ExtPxFamilyImpl::acquireSubchunkShape(uint32_t subchunkIndex)
+{
+	PxMaterial* material = m_spawnSettings.material;
+	PxShape*& shape = m_shapePool[subchunkIndex];
+	if (shape != nullptr)
+	{
+		NVBLAST_ASSERT(m_pooledShapeCount > 0);
+		m_pooledShapeCount--;
+
+		PxMaterial* shapeMaterial = nullptr;
+		shape->getMaterials(&shapeMaterial, 1);
+		if (shapeMaterial == material)
+		{
+			return shape;
+		}
+		shape->release();
+	}
+
+	const ExtPxSubchunk& subchunk = m_pxAsset.getSubchunks()[subchunkIndex];
+	shape = m_manager.m_physics.createShape(subchunk.geometry, *material, true);
+	shape->setLocalPose(subchunk.transform);
+	return shape;
+}
+
+uint32_t ExtPxFamilyImpl::releasePooledShapes()
+{
+	uint32_t releasedCount = 0;
+	for (uint32_t i = 0; i < m_shapePool.size(); ++i)
+	{
+		if (m_shapePool[i] != nullptr && m_subchunkShapes[i] == nullptr)
+		{
+			m_shapePool[i]->release();
+			m_shapePool[i] = nullptr;
+			releasedCount++;
+		}
+	}
+	NVBLAST_ASSERT(releasedCount == m_pooledShapeCount);
+	m_pooledShapeCount = 0;
+	return releasedCount;
+}
+
 void ExtPxFamilyImpl::dispatchActorCreated(ExtPxActor& actor)
 {
 	for (ExtPxListener* listener : m_listeners)
@@ -32,8 +32,11 @@
 #include "NvBlastExtPxFamily.h"
 #include "NvBlastArray.h"
 #include "NvBlastHashSet.h"
+#include "NvBlastHashMap.h"
 #include "PxTransform.h"
 #include "NvBlastTkEvent.h"
+#include "NvBlastTkGroup.h"
+#include "PxMassProperties.h"
 
 
 using namespace physx;
@@ -98,6 +101,13 @@ public:
 		return m_subchunkShapes.begin();
 	}
 
+	virtual uint32_t						getPooledShapeCount() const override
+	{
+		return m_pooledShapeCount;
+	}
+
+	virtual uint32_t						releasePooledShapes() override;
+
 	virtual ExtPxAsset&						getPxAsset() const override
 	{
 		return m_pxAsset;
@@ -164,9 +174,76 @@ public:
 private:
 	//////// private methods ////////
 
-	void									createActors(TkActor** tkActors, const PxActorCreateInfo* pxActorInfos, uint32_t count);
+	void									addActor(ExtPxActorImpl* actor);
+	void									createActors(TkActor** tkActors, PxActorCreateInfo* pxActorInfos, uint32_t count);
+
+	/**
+	Fill the prepared part of the new actors' PxActorCreateInfo, concurrently with the manager's task runner for large splits.
+	*/
+	void									prepareActors(TkActor** tkActors, PxActorCreateInfo* pxActorInfos, uint32_t count);
+
+	/**
+	Prepare one new actor, touching only its own ranges of m_newActorChunkIndices and m_newActorGraphNodeIndices.
+	*/
+	void									prepareActor(TkActor& tkActor, PxActorCreateInfo& pxActorInfo);
+
+	/**
+	Sum the mass properties of every chunk's subchunks, for a unit density.
+	*/
+	void									computeChunkMassProperties();
 	void									destroyActors(ExtPxActor** actors, uint32_t count);
 
+	/**
+	Create the new actors of m_newActorsBuffer when they exceed the actor count limit, the ones ranked below the available count are
+	handled according to the manager's ExtPxActorBudgetMode.
+	*/
+	void									applyActorBudget(uint32_t count, uint32_t availableCount);
+
+	float									getActorPriority(uint32_t newActorIndex);
+
+	/**
+	Whether a new actor can share a debris body: a single leaf chunk, not static and without joints.
+	*/
+	bool									isDebrisCandidate(uint32_t newActorIndex) const;
+
+	/**
+	Take a destroyed debris actor's shapes off its body.  Returns false if it was the last actor on the body, which is then out of the scene
+	for the actor to release.
+	*/
+	bool									releaseDebrisActor(ExtPxActorImpl& actor);
+
+	/**
+	Find the actor of a debris body owning one of its shapes.  Returns nullptr if the shape is not one of the body's.
+	*/
+	ExtPxActorImpl*							getDebrisActorFromShape(const PxRigidDynamic& debrisBody, const PxShape& shape) const;
+
+	/**
+	Tasks run by prepareActors(), each on a range of the new actors.
+	*/
+	class PrepareTasks : public TkGroupTaskRunner::Tasks
+	{
+	public:
+		PrepareTasks(ExtPxFamilyImpl& family, TkActor** tkActors, PxActorCreateInfo* pxActorInfos, uint32_t count, uint32_t taskCount)
+			: m_family(family), m_tkActors(tkActors), m_pxActorInfos(pxActorInfos), m_count(count), m_taskCount(taskCount) {}
+
+		virtual void execute(uint32_t taskIndex) override;
+
+	private:
+		ExtPxFamilyImpl&	m_family;
+		TkActor**			m_tkActors;
+		PxActorCreateInfo*	m_pxActorInfos;
+		uint32_t			m_count;
+		uint32_t			m_taskCount;
+	};
+
+	static const uint32_t					ACTORS_PER_PREPARE_TASK = 32;	//!< the least new actors for each PrepareTasks task
+	void									processJointUpdate(const TkJointUpdateEvent& jointEvent);
+
+	/**
+	Get the shape of a subchunk to attach to a new actor: the pooled shape if its material is the current one, a new shape otherwise.
+	*/
+	PxShape*								acquireSubchunkShape(uint32_t subchunkIndex);
+
 	//////// data ////////
 
 	ExtPxManagerImpl&						m_manager;
@@ -183,8 +260,20 @@ private:
 	Array<TkActor*>::type				    m_culledActors;
 	InlineArray<ExtPxListener*, 4>::type	m_listeners;
 	Array<PxShape*>::type				    m_subchunkShapes;
+	Array<PxShape*>::type				    m_shapePool;			//!< every shape created per subchunk, owned by the family whether attached or not
+	uint32_t								m_pooledShapeCount;		//!< number of shapes in m_shapePool not attached to an actor
 	Array<TkActor*>::type				    m_newActorsBuffer;
 	Array<PxActorCreateInfo>::type		    m_newActorCreateInfo;
+	Array<uint32_t>::type				    m_newActorChunkIndices;		//!< chunk indices of the new actors, see PxActorCreateInfo
+	Array<uint32_t>::type				    m_newActorGraphNodeIndices;	//!< graph node indices of the new actors, see PxActorCreateInfo
+	Array<PxMassProperties>::type		    m_chunkMassProperties;		//!< per chunk, mass properties of its subchunks for a unit density
+	Array<uint32_t>::type				    m_newActorSplitIndices;	//!< index of the split event in receive() each new actor comes from
+	Array<float>::type					    m_newActorPriorities;
+	Array<uint32_t>::type				    m_budgetOrder;
+	Array<uint8_t>::type				    m_budgetActions;
+	Array<uint32_t>::type				    m_debrisActorCounts;	//!< per split event, number of new actors merged into its debris body
+	Array<PxRigidDynamic*>::type		    m_debrisSplitBodies;	//!< per split event, its debris body
+	HashMap<PxRigidDynamic*, Array<ExtPxActorImpl*>::type>::type	m_debrisBodies;	//!< debris bodies and the actors sharing them
 	Array<PxActor*>::type				    m_physXActorsBuffer;
 	Array<ExtPxActor*>::type				m_actorsBuffer;
 	Array<uint32_t>::type				    m_indicesScratch;
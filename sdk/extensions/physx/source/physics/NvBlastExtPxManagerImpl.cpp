@@ -40,6 +40,7 @@
 
 #include "PxRigidDynamic.h"
 #include "PxJoint.h"
+#include "PxPhysics.h"
 
 
 namespace Nv
@@ -155,6 +156,89 @@ void ExtPxManagerImpl::updateJoint(TkJoint& joint)
 	}
 }
 
+void ExtPxManagerImpl::setRigidBodyPoolLimit(uint32_t limit)
+{
+	m_rigidBodyPoolLimit = limit;
+	while (m_rigidBodyPool.size() > limit)
+	{
+		m_rigidBodyPool.back()->release();
+		m_rigidBodyPool.popBack();
+	}
+}
+
+ExtPxActor* ExtPxManagerImpl::getActorFromPhysXShape(const PxRigidDynamic& pxActor, const PxShape& shape) const
+{
+	ExtPxActorImpl* actor = static_cast<ExtPxActorImpl*>(getActorFromPhysXActor(pxActor));
+	if (actor != nullptr && actor->isDebris())
+	{
+		// the body is shared, registered with one of its actors
+		return static_cast<ExtPxFamilyImpl&>(actor->getFamily()).getDebrisActorFromShape(pxActor, shape);
+	}
+	return actor;
+}
+
+PxRigidDynamic* ExtPxManagerImpl::acquireRigidDynamic(const PxTransform& pose)
+{
+	if (m_rigidBodyPool.size() == 0)
+	{
+		m_rigidBodyPoolStats.createdCount++;
+		return m_physics.createRigidDynamic(pose);
+	}
+
+	m_rigidBodyPoolStats.reusedCount++;
+	PxRigidDynamic* rigidDynamic = m_rigidBodyPool.back();
+	m_rigidBodyPool.popBack();
+
+	// reset what the actor creation does not set to the defaults of a new rigid body, mass is computed from the new shapes
+	const float speed = m_physics.getTolerancesScale().speed;
+	rigidDynamic->setGlobalPose(pose);
+	rigidDynamic->setRigidBodyFlags(PxRigidBodyFlags());
+	rigidDynamic->setRigidDynamicLockFlags(PxRigidDynamicLockFlags());
+	rigidDynamic->setActorFlags(PxActorFlag::eVISUALIZATION);
+	rigidDynamic->setDominanceGroup(0);
+	rigidDynamic->setOwnerClient(PX_DEFAULT_CLIENT);
+	rigidDynamic->setName(nullptr);
+	rigidDynamic->setLinearVelocity(PxVec3(PxZero));
+	rigidDynamic->setAngularVelocity(PxVec3(PxZero));
+	rigidDynamic->setLinearDamping(0.0f);
+	rigidDynamic->setAngularDamping(0.05f);
+	rigidDynamic->setMaxAngularVelocity(7.0f);
+	rigidDynamic->setMaxDepenetrationVelocity(1e32f);
+	rigidDynamic->setMaxContactImpulse(1e32f);
+	rigidDynamic->setContactReportThreshold(PX_MAX_F32);
+	rigidDynamic->setSleepThreshold(5e-5f * speed * speed);
+	rigidDynamic->setStabilizationThreshold(1e-5f * speed * speed);
+	rigidDynamic->setSolverIterationCounts(4, 1);
+	rigidDynamic->setWakeCounter(0.4f);
+	rigidDynamic->userData = nullptr;
+	return rigidDynamic;
+}
+
+void ExtPxManagerImpl::releaseRigidDynamic(PxRigidDynamic& rigidDynamic)
+{
+	NVBLAST_ASSERT(rigidDynamic.getScene() == nullptr);
+
+	if (m_rigidBodyPool.size() >= m_rigidBodyPoolLimit || rigidDynamic.getNbConstraints() > 0)
+	{
+		if (m_rigidBodyPoolLimit > 0)
+		{
+			m_rigidBodyPoolStats.releasedCount++;
+		}
+		rigidDynamic.release();
+		return;
+	}
+
+	// detach the shapes, they are kept by their family for reuse
+	m_shapesBuffer.resizeUninitialized(rigidDynamic.getNbShapes());
+	rigidDynamic.getShapes(m_shapesBuffer.begin(), m_shapesBuffer.size());
+	for (PxShape* shape : m_shapesBuffer)
+	{
+		rigidDynamic.detachShape(*shape);
+	}
+
+	m_rigidBodyPool.pushBack(&rigidDynamic);
+}
+
 void ExtPxManagerImpl::destroyJoint(TkJoint& joint)
 {
 	if (joint.userData)
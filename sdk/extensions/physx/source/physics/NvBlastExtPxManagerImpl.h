@@ -58,12 +58,16 @@ public:
 	friend class ExtPxFamilyImpl;
 
 	ExtPxManagerImpl(PxPhysics& physics, TkFramework&framework, ExtPxCreateJointFunction createFn, bool usePxUserData)
-		: m_physics(physics), m_framework(framework), m_createJointFn(createFn), m_usePxUserData(usePxUserData), m_actorCountLimit(0)
+		: m_physics(physics), m_framework(framework), m_createJointFn(createFn), m_usePxUserData(usePxUserData), m_actorCountLimit(0),
+		m_rigidBodyPoolLimit(0), m_actorBudgetMode(ExtPxActorBudgetMode::Cull), m_actorPriorityCallback(nullptr),
+		m_taskRunner(nullptr)
 	{
+		memset(&m_rigidBodyPoolStats, 0, sizeof(ExtPxRigidBodyPoolStats));
 	}
 
 	~ExtPxManagerImpl()
 	{
+		setRigidBodyPoolLimit(0);
 	}
 
 	virtual void release() override;
@@ -109,6 +113,8 @@ public:
 		return it != nullptr ? it->second : nullptr;
 	}
 
+	virtual ExtPxActor*		getActorFromPhysXShape(const PxRigidDynamic& pxActor, const PxShape& shape) const override;
+
 	virtual PxPhysics&		getPhysics() const override
 	{
 		return m_physics;
@@ -144,11 +150,54 @@ public:
 		return m_actorCountLimit;
 	}
 
+	virtual void			setActorBudgetMode(ExtPxActorBudgetMode::Enum mode) override
+	{
+		m_actorBudgetMode = mode;
+	}
+
+	virtual ExtPxActorBudgetMode::Enum	getActorBudgetMode() const override
+	{
+		return m_actorBudgetMode;
+	}
+
+	virtual void			setActorPriorityCallback(ExtPxActorPriorityCallback* callback) override
+	{
+		m_actorPriorityCallback = callback;
+	}
+
+	virtual ExtPxActorPriorityCallback*	getActorPriorityCallback() const override
+	{
+		return m_actorPriorityCallback;
+	}
+
 	virtual uint32_t		getPxActorCount() const override
 	{
 		return m_physXActorsMap.size();
 	}
 
+	virtual void			setRigidBodyPoolLimit(uint32_t limit) override;
+
+	virtual uint32_t		getRigidBodyPoolLimit() const override
+	{
+		return m_rigidBodyPoolLimit;
+	}
+
+	virtual void			getRigidBodyPoolStats(ExtPxRigidBodyPoolStats& stats) const override
+	{
+		stats = m_rigidBodyPoolStats;
+		stats.pooledCount = m_rigidBodyPool.size();
+	}
+
+	virtual void			setTaskRunner(TkGroupTaskRunner* taskRunner) override
+	{
+		m_taskRunner = taskRunner;
+	}
+
+	virtual TkGroupTaskRunner*	getTaskRunner() const override
+	{
+		return m_taskRunner;
+	}
+
 
 	//////// internal public methods ////////
 
@@ -182,6 +231,16 @@ public:
 
 	void					updateJoint(TkJoint& joint);
 
+	/**
+	Get a rigid body at the given pose for a new actor, from the pool if possible.  A pooled body is reset to the state of a new one.
+	*/
+	PxRigidDynamic*			acquireRigidDynamic(const PxTransform& pose);
+
+	/**
+	Release the rigid body of a destroyed actor, which must not be in a scene.  It is kept in the pool if possible.
+	*/
+	void					releaseRigidDynamic(PxRigidDynamic& rigidDynamic);
+
 
 	//////// events dispatch ////////
 
@@ -211,6 +270,13 @@ private:
 	HashMap<TkFamily*, ExtPxFamily*>::type					m_tkFamiliesMap;
 	HashMap<TkActor*, Array<TkJoint*>::type >::type			m_incompleteJointMultiMap;
 	uint32_t												m_actorCountLimit;
+	uint32_t												m_rigidBodyPoolLimit;
+	Array<PxRigidDynamic*>::type							m_rigidBodyPool;
+	ExtPxRigidBodyPoolStats									m_rigidBodyPoolStats;
+	Array<PxShape*>::type									m_shapesBuffer;
+	ExtPxActorBudgetMode::Enum								m_actorBudgetMode;
+	ExtPxActorPriorityCallback*								m_actorPriorityCallback;
+	TkGroupTaskRunner*										m_taskRunner;
 };
 
 } // namespace Blast
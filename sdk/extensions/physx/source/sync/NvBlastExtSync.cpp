@@ -29,12 +29,15 @@
 #include "NvBlastExtSync.h"
 #include "NvBlastAssert.h"
 #include "NvBlast.h"
+#include "NvBlastIndexFns.h"
 #include "NvBlastExtPxManager.h"
 #include "NvBlastExtPxFamily.h"
 #include "NvBlastExtPxActor.h"
 #include "PxRigidDynamic.h"
 
+#include <algorithm>
 #include <chrono>
+#include <map>
 using namespace std::chrono;
 
 namespace Nv
@@ -42,6 +45,243 @@ namespace Nv
 namespace Blast
 {
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//											Sync Stream Encoding
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+Every event in a sync stream is a record made of:
+	uint8		ExtSyncEventType and SyncStreamFlag bits
+	NvBlastID	family ID
+	varint		zigzag encoded timestamp difference to the previous record
+followed by the event type specific payload:
+	Fracture:		varint bond count, {varint node index 0, varint node index 1, float health} per bond,
+					varint chunk count, {varint chunk index, float health} per chunk
+	FamilySync:		varint family size, family blob
+	Physics:		varint actor count, {varint actor index, PxTransform} per actor
+	BondHealths:	float max bond health, varint bond count, then either
+					{quantized health} per bond of the family (keyframe), or
+					{varint bond index gap to the previous bond + 1, quantized health} per changed bond (delta)
+*/
+struct SyncStreamFlag
+{
+	enum Enum
+	{
+		TypeMask	= 0x0F,	//!< bits of the ExtSyncEventType
+		Keyframe	= 0x10,	//!< BondHealths record containing all bonds
+		Health16	= 0x20,	//!< BondHealths record with 16 bit quantized healths, 8 bit otherwise
+	};
+};
+
+
+/**
+Writes to a preallocated byte stream, remembering if anything didn't fit.
+*/
+class SyncStreamWriter
+{
+public:
+	SyncStreamWriter(void* stream, uint32_t capacity, uint32_t size) : m_data(static_cast<uint8_t*>(stream)), m_capacity(capacity), m_size(size), m_overflow(false) {}
+
+	void writeBytes(const void* data, uint32_t size)
+	{
+		if (m_overflow || m_capacity - m_size < size)
+		{
+			m_overflow = true;
+			return;
+		}
+		memcpy(m_data + m_size, data, size);
+		m_size += size;
+	}
+
+	void writeByte(uint8_t value)
+	{
+		writeBytes(&value, 1);
+	}
+
+	void writeFloat(float value)
+	{
+		writeBytes(&value, sizeof(float));
+	}
+
+	void writeVarint(uint64_t value)
+	{
+		uint8_t bytes[10];
+		uint32_t count = 0;
+		while (value >= 0x80)
+		{
+			bytes[count++] = static_cast<uint8_t>(value | 0x80);
+			value >>= 7;
+		}
+		bytes[count++] = static_cast<uint8_t>(value);
+		writeBytes(bytes, count);
+	}
+
+	void writeQuantized(uint32_t value, bool is16Bit)
+	{
+		writeByte(static_cast<uint8_t>(value));
+		if (is16Bit)
+		{
+			writeByte(static_cast<uint8_t>(value >> 8));
+		}
+	}
+
+	uint32_t	getSize() const		{ return m_size; }
+	bool		hasOverflow() const	{ return m_overflow; }
+
+private:
+	uint8_t*	m_data;
+	uint32_t	m_capacity;
+	uint32_t	m_size;
+	bool		m_overflow;
+};
+
+
+/**
+Reads from a byte stream, remembering if it ended prematurely or held invalid data.
+*/
+class SyncStreamReader
+{
+public:
+	SyncStreamReader(const void* stream, uint32_t size) : m_data(static_cast<const uint8_t*>(stream)), m_size(size), m_position(0), m_error(false) {}
+
+	void readBytes(void* data, uint32_t size)
+	{
+		if (m_error || m_size - m_position < size)
+		{
+			m_error = true;
+			memset(data, 0, size);
+			return;
+		}
+		memcpy(data, m_data + m_position, size);
+		m_position += size;
+	}
+
+	uint8_t readByte()
+	{
+		uint8_t value;
+		readBytes(&value, 1);
+		return value;
+	}
+
+	float readFloat()
+	{
+		float value;
+		readBytes(&value, sizeof(float));
+		return value;
+	}
+
+	uint64_t readVarint()
+	{
+		uint64_t value = 0;
+		for (uint32_t shift = 0; shift < 64; shift += 7)
+		{
+			const uint8_t byte = readByte();
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return value;
+			}
+		}
+		m_error = true;
+		return 0;
+	}
+
+	uint32_t readIndex()
+	{
+		const uint64_t value = readVarint();
+		if (value > UINT32_MAX)
+		{
+			m_error = true;
+			return 0;
+		}
+		return static_cast<uint32_t>(value);
+	}
+
+	/**
+	Reads the element count of an array whose elements take at least one byte each.
+	*/
+	uint32_t readCount()
+	{
+		const uint32_t count = readIndex();
+		if (count > m_size - m_position)
+		{
+			m_error = true;
+			return 0;
+		}
+		return count;
+	}
+
+	uint32_t readQuantized(bool is16Bit)
+	{
+		uint32_t value = readByte();
+		if (is16Bit)
+		{
+			value |= static_cast<uint32_t>(readByte()) << 8;
+		}
+		return value;
+	}
+
+	bool	isDone() const		{ return m_position == m_size; }
+	bool	hasError() const	{ return m_error; }
+
+private:
+	const uint8_t*	m_data;
+	uint32_t		m_size;
+	uint32_t		m_position;
+	bool			m_error;
+};
+
+
+NV_INLINE uint64_t zigzagEncode(int64_t value)
+{
+	return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+
+NV_INLINE int64_t zigzagDecode(uint64_t value)
+{
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+
+NV_INLINE float dequantizeHealth(uint32_t value, float maxHealth, uint32_t maxValue)
+{
+	return value * maxHealth / maxValue;
+}
+
+
+/**
+Broken bonds are quantized to 0, the others to [1, maxValue], rounding up: a client applying the dequantized health to a bond
+with the same health doesn't damage it.
+*/
+NV_INLINE uint32_t quantizeHealth(float health, float maxHealth, uint32_t maxValue)
+{
+	if (!(health > 0.0f))
+	{
+		return 0;
+	}
+
+	const float scaled = health / maxHealth * maxValue;
+	if (!(scaled < maxValue))
+	{
+		return maxValue;
+	}
+
+	uint32_t value = static_cast<uint32_t>(scaled);
+	if (value == 0 || dequantizeHealth(value, maxHealth, maxValue) < health)
+	{
+		++value;
+	}
+	return value;
+}
+
+
+NV_INLINE uint64_t getTimestamp()
+{
+	return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //											ExtSyncImpl Definition
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,18 +309,61 @@ public:
 
 	virtual void		syncFamily(const TkFamily& family) override;
 	virtual void		syncFamily(const ExtPxFamily& family) override;
+	virtual void		syncBondHealths(const TkFamily& family, uint32_t keyframeInterval) override;
 
 	virtual uint32_t	getSyncBufferSize() const override;
 	virtual void		acquireSyncBuffer(const ExtSyncEvent*const*& buffer, uint32_t& size) const override;
 	virtual void		releaseSyncBuffer() override;
 
+	virtual void		setSyncStream(const ExtSyncStreamDesc& desc) override;
+	virtual uint32_t	getSyncStreamSize() const override;
+
 	virtual void		applySyncBuffer(TkFramework& framework, const ExtSyncEvent** buffer, uint32_t size, TkGroup* groupForNewActors, ExtPxManager* manager) override;
 
+	virtual bool		readSyncStream(const void* stream, uint32_t size) override;
+
 
 private:
+	//////// internal operations ////////
+
+	bool				isStreaming() const { return m_streamDesc.stream != nullptr; }
+
+	SyncStreamWriter	beginStreamRecord(ExtSyncEventType::Enum type, uint8_t flags, const NvBlastID& familyID, uint64_t timestamp);
+
+	void				endStreamRecord(const SyncStreamWriter& writer, uint64_t timestamp);
+
+	ExtSyncEvent*		readStreamRecord(SyncStreamReader& reader, uint64_t& timestamp);
+
+	void				applyBondHealths(TkFamily& family, const ExtSyncEventBondHealths& e);
+
+
+	//////// internal data ////////
+
+	struct BondHealthsState
+	{
+		std::vector<float>	healths;	//!< bond healths of the previous sync, as received by clients
+		uint32_t			syncCount;	//!< syncs since the last keyframe
+	};
+
+	struct IDCompare
+	{
+		bool operator()(const NvBlastID& id0, const NvBlastID& id1) const { return memcmp(&id0, &id1, sizeof(NvBlastID)) < 0; }
+	};
+
+
 	//////// data ////////
 
 	std::vector<ExtSyncEvent*>		 m_syncEvents;
+
+	ExtSyncStreamDesc				m_streamDesc;
+	uint32_t						m_streamSize;
+	uint32_t						m_streamEventCount;
+	uint64_t						m_streamTimestamp;
+
+	std::map<NvBlastID, BondHealthsState, IDCompare>	m_bondHealths;
+	std::vector<ExtSyncEventBondHealths::BondData>		m_bondData;
+	std::vector<NvBlastBondFractureData>				m_bondFractures;
+	std::vector<uint32_t>								m_bondNodes;
 };
 
 
@@ -108,7 +391,7 @@ void ExtSyncImpl::release()
 	NVBLAST_DELETE(this, ExtSyncImpl);
 }
 
-ExtSyncImpl::ExtSyncImpl()
+ExtSyncImpl::ExtSyncImpl() : m_streamSize(0), m_streamEventCount(0), m_streamTimestamp(0)
 {
 }
 
@@ -122,7 +405,28 @@ void ExtSyncImpl::receive(const TkEvent* events, uint32_t eventCount)
 	for (uint32_t i = 0; i < eventCount; ++i)
 	{
 		const TkEvent& tkEvent = events[i];
-		if (tkEvent.type == TkEvent::FractureCommand)
+		if (tkEvent.type == TkEvent::FractureCommand && isStreaming())
+		{
+			const TkFractureCommands* fracEvent = tkEvent.getPayload<TkFractureCommands>();
+			const NvBlastFractureBuffers& buffers = fracEvent->buffers;
+			const uint64_t timestamp = getTimestamp();
+			SyncStreamWriter writer = beginStreamRecord(ExtSyncEventType::Fracture, 0, fracEvent->tkActorData.family->getID(), timestamp);
+			writer.writeVarint(buffers.bondFractureCount);
+			for (uint32_t j = 0; j < buffers.bondFractureCount; ++j)
+			{
+				writer.writeVarint(buffers.bondFractures[j].nodeIndex0);
+				writer.writeVarint(buffers.bondFractures[j].nodeIndex1);
+				writer.writeFloat(buffers.bondFractures[j].health);
+			}
+			writer.writeVarint(buffers.chunkFractureCount);
+			for (uint32_t j = 0; j < buffers.chunkFractureCount; ++j)
+			{
+				writer.writeVarint(buffers.chunkFractures[j].chunkIndex);
+				writer.writeFloat(buffers.chunkFractures[j].health);
+			}
+			endStreamRecord(writer, timestamp);
+		}
+		else if (tkEvent.type == TkEvent::FractureCommand)
 		{
 			const TkFractureCommands* fracEvent = tkEvent.getPayload<TkFractureCommands>();
 			ExtSyncEventFracture* e = NVBLAST_NEW(ExtSyncEventFracture) ();
@@ -139,6 +443,18 @@ void ExtSyncImpl::receive(const TkEvent* events, uint32_t eventCount)
 
 void ExtSyncImpl::syncFamily(const TkFamily& family)
 {
+	if (isStreaming())
+	{
+		const NvBlastFamily* familyLL = family.getFamilyLL();
+		const uint32_t size = NvBlastFamilyGetSize(familyLL, logLL);
+		const uint64_t timestamp = getTimestamp();
+		SyncStreamWriter writer = beginStreamRecord(ExtSyncEventType::FamilySync, 0, family.getID(), timestamp);
+		writer.writeVarint(size);
+		writer.writeBytes(familyLL, size);
+		endStreamRecord(writer, timestamp);
+		return;
+	}
+
 	ExtSyncEventFamilySync* e = NVBLAST_NEW(ExtSyncEventFamilySync) ();
 	e->timestamp = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 	e->familyID = family.getID();
@@ -154,6 +470,23 @@ void ExtSyncImpl::syncFamily(const ExtPxFamily& family)
 
 	syncFamily(tkFamily);
 
+	if (isStreaming())
+	{
+		std::vector<ExtPxActor*> actors(family.getActorCount());
+		family.getActors(actors.data(), static_cast<uint32_t>(actors.size()));
+		const uint64_t timestamp = getTimestamp();
+		SyncStreamWriter writer = beginStreamRecord(ExtSyncEventType::Physics, 0, tkFamily.getID(), timestamp);
+		writer.writeVarint(actors.size());
+		for (ExtPxActor* actor : actors)
+		{
+			const physx::PxTransform transform = actor->getPhysXActor().getGlobalPose();
+			writer.writeVarint(actor->getTkActor().getIndex());
+			writer.writeBytes(&transform, sizeof(physx::PxTransform));
+		}
+		endStreamRecord(writer, timestamp);
+		return;
+	}
+
 	ExtSyncEventPhysicsSync* e = NVBLAST_NEW(ExtSyncEventPhysicsSync) ();
 	e->timestamp = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 	e->familyID = tkFamily.getID();
@@ -171,9 +504,97 @@ void ExtSyncImpl::syncFamily(const ExtPxFamily& family)
 	m_syncEvents.push_back(e);
 }
 
+void ExtSyncImpl::syncBondHealths(const TkFamily& family, uint32_t keyframeInterval)
+{
+	TkActor* actor;
+	if (family.getActors(&actor, 1) == 0)
+	{
+		return;
+	}
+
+	const float* bondHealths = actor->getBondHealths();
+	const uint32_t bondCount = family.getAsset()->getBondCount();
+
+	BondHealthsState& state = m_bondHealths[family.getID()];
+	const bool keyframe = state.healths.size() != bondCount || state.syncCount >= keyframeInterval;
+
+	// healths above maxBondHealth widen the quantization range of this record rather than being clamped
+	float maxBondHealth = m_streamDesc.maxBondHealth;
+	if (isStreaming())
+	{
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			maxBondHealth = std::max(maxBondHealth, bondHealths[i]);
+		}
+	}
+
+	// healths as received by clients, quantized in stream mode
+	const bool is16Bit = m_streamDesc.healthBits == 16;
+	const uint32_t maxValue = is16Bit ? 0xFFFF : 0xFF;
+	m_bondData.clear();
+	for (uint32_t i = 0; i < bondCount; ++i)
+	{
+		ExtSyncEventBondHealths::BondData data;
+		data.bondIndex = i;
+		data.health = isStreaming() ? dequantizeHealth(quantizeHealth(bondHealths[i], maxBondHealth, maxValue), maxBondHealth, maxValue) : bondHealths[i];
+		if (keyframe || data.health != state.healths[i])
+		{
+			m_bondData.push_back(data);
+		}
+	}
+
+	if (!keyframe && m_bondData.empty())
+	{
+		state.syncCount++;
+		return;
+	}
+
+	if (isStreaming())
+	{
+		const uint64_t timestamp = getTimestamp();
+		const uint8_t flags = (keyframe ? SyncStreamFlag::Keyframe : 0) | (is16Bit ? SyncStreamFlag::Health16 : 0);
+		SyncStreamWriter writer = beginStreamRecord(ExtSyncEventType::BondHealths, flags, family.getID(), timestamp);
+		writer.writeFloat(maxBondHealth);
+		writer.writeVarint(m_bondData.size());
+		uint32_t nextBondIndex = 0;
+		for (const ExtSyncEventBondHealths::BondData& data : m_bondData)
+		{
+			if (!keyframe)
+			{
+				writer.writeVarint(data.bondIndex - nextBondIndex);
+				nextBondIndex = data.bondIndex + 1;
+			}
+			writer.writeQuantized(quantizeHealth(bondHealths[data.bondIndex], maxBondHealth, maxValue), is16Bit);
+		}
+		endStreamRecord(writer, timestamp);
+
+		// keep the previous state when the record is dropped, so that the next delta contains these changes
+		if (writer.hasOverflow())
+		{
+			return;
+		}
+	}
+	else
+	{
+		ExtSyncEventBondHealths* e = NVBLAST_NEW(ExtSyncEventBondHealths) ();
+		e->timestamp = getTimestamp();
+		e->familyID = family.getID();
+		e->keyframe = keyframe;
+		e->data = m_bondData;
+		m_syncEvents.push_back(e);
+	}
+
+	state.healths.resize(bondCount);
+	for (const ExtSyncEventBondHealths::BondData& data : m_bondData)
+	{
+		state.healths[data.bondIndex] = data.health;
+	}
+	state.syncCount = keyframe ? 1 : state.syncCount + 1;
+}
+
 uint32_t ExtSyncImpl::getSyncBufferSize() const
 {
-	return static_cast<uint32_t>(m_syncEvents.size());
+	return isStreaming() ? m_streamEventCount : static_cast<uint32_t>(m_syncEvents.size());
 }
 
 void ExtSyncImpl::acquireSyncBuffer(const ExtSyncEvent* const*& buffer, uint32_t& size) const
@@ -189,6 +610,46 @@ void ExtSyncImpl::releaseSyncBuffer()
 		NVBLAST_DELETE(m_syncEvents[i], ExtSyncEvent);
 	}
 	m_syncEvents.clear();
+
+	m_streamSize = 0;
+	m_streamEventCount = 0;
+	m_streamTimestamp = 0;
+}
+
+void ExtSyncImpl::setSyncStream(const ExtSyncStreamDesc& desc)
+{
+	NVBLAST_CHECK_ERROR(desc.stream == nullptr || desc.healthBits == 8 || desc.healthBits == 16, "ExtSync::setSyncStream: healthBits must be 8 or 16.", return);
+	NVBLAST_CHECK_ERROR(desc.stream == nullptr || desc.maxBondHealth > 0.0f, "ExtSync::setSyncStream: maxBondHealth must be positive.", return);
+
+	releaseSyncBuffer();
+	m_streamDesc = desc;
+}
+
+uint32_t ExtSyncImpl::getSyncStreamSize() const
+{
+	return m_streamSize;
+}
+
+SyncStreamWriter ExtSyncImpl::beginStreamRecord(ExtSyncEventType::Enum type, uint8_t flags, const NvBlastID& familyID, uint64_t timestamp)
+{
+	SyncStreamWriter writer(m_streamDesc.stream, m_streamDesc.capacity, m_streamSize);
+	writer.writeByte(static_cast<uint8_t>(type) | flags);
+	writer.writeBytes(&familyID, sizeof(NvBlastID));
+	writer.writeVarint(zigzagEncode(static_cast<int64_t>(timestamp - m_streamTimestamp)));
+	return writer;
+}
+
+void ExtSyncImpl::endStreamRecord(const SyncStreamWriter& writer, uint64_t timestamp)
+{
+	if (writer.hasOverflow())
+	{
+		NVBLAST_LOG_WARNING("ExtSync: sync stream capacity exceeded, event dropped.");
+		return;
+	}
+
+	m_streamSize = writer.getSize();
+	m_streamEventCount++;
+	m_streamTimestamp = timestamp;
 }
 
 void ExtSyncImpl::applySyncBuffer(TkFramework& framework, const ExtSyncEvent** buffer, uint32_t size, TkGroup* groupForNewActors, ExtPxManager* manager)
@@ -222,6 +683,10 @@ void ExtSyncImpl::applySyncBuffer(TkFramework& framework, const ExtSyncEvent** b
 				const ExtSyncEventFamilySync* familyEvent = e->getEvent<ExtSyncEventFamilySync>();
 				family->reinitialize((NvBlastFamily*)familyEvent->family.data(), groupForNewActors);
 			}
+			else if (e->type == ExtSyncEventBondHealths::EVENT_TYPE)
+			{
+				applyBondHealths(*family, *e->getEvent<ExtSyncEventBondHealths>());
+			}
 			else if (e->type == ExtSyncEventPhysicsSync::EVENT_TYPE && manager)
 			{
 				const ExtSyncEventPhysicsSync* physicsEvent = e->getEvent<ExtSyncEventPhysicsSync>();
@@ -247,5 +712,165 @@ void ExtSyncImpl::applySyncBuffer(TkFramework& framework, const ExtSyncEvent** b
 	}
 }
 
+void ExtSyncImpl::applyBondHealths(TkFamily& family, const ExtSyncEventBondHealths& e)
+{
+	TkActor* actor;
+	if (family.getActors(&actor, 1) == 0)
+	{
+		return;
+	}
+
+	const float* bondHealths = actor->getBondHealths();
+	const NvBlastSupportGraph graph = family.getAsset()->getGraph();
+	const uint32_t bondCount = family.getAsset()->getBondCount();
+
+	// the graph nodes of every bond, lower node first
+	m_bondNodes.resize(2 * bondCount);
+	for (uint32_t node = 0; node < graph.nodeCount; ++node)
+	{
+		for (uint32_t adjacency = graph.adjacencyPartition[node]; adjacency < graph.adjacencyPartition[node + 1]; ++adjacency)
+		{
+			const uint32_t bondIndex = graph.adjacentBondIndices[adjacency];
+			m_bondNodes[2 * bondIndex + (node < graph.adjacentNodeIndices[adjacency] ? 0 : 1)] = node;
+		}
+	}
+
+	// damage the bonds down to the synced health, bonds can't be healed
+	m_bondFractures.clear();
+	for (const ExtSyncEventBondHealths::BondData& data : e.data)
+	{
+		if (data.bondIndex >= bondCount)
+		{
+			continue;
+		}
+
+		const uint32_t node0 = m_bondNodes[2 * data.bondIndex];
+		const uint32_t node1 = m_bondNodes[2 * data.bondIndex + 1];
+		if (isInvalidIndex(graph.chunkIndices[node0]) || isInvalidIndex(graph.chunkIndices[node1]))
+		{
+			// bonds to the world are not supported by TkFamily::applyFracture
+			continue;
+		}
+
+		const float health = bondHealths[data.bondIndex];
+		if (health > data.health)
+		{
+			NvBlastBondFractureData fracture;
+			fracture.userdata = 0;
+			fracture.nodeIndex0 = node0;
+			fracture.nodeIndex1 = node1;
+			fracture.health = data.health > 0.0f ? health - data.health : health;
+			m_bondFractures.push_back(fracture);
+		}
+	}
+
+	if (!m_bondFractures.empty())
+	{
+		const NvBlastFractureBuffers commands = { static_cast<uint32_t>(m_bondFractures.size()), 0, m_bondFractures.data(), nullptr };
+		family.applyFracture(&commands);
+	}
+}
+
+bool ExtSyncImpl::readSyncStream(const void* stream, uint32_t size)
+{
+	SyncStreamReader reader(stream, size);
+	uint64_t timestamp = 0;
+	while (!reader.isDone())
+	{
+		ExtSyncEvent* e = readStreamRecord(reader, timestamp);
+		if (e == nullptr)
+		{
+			NVBLAST_LOG_ERROR("ExtSync::readSyncStream: malformed sync stream.");
+			return false;
+		}
+		m_syncEvents.push_back(e);
+	}
+	return true;
+}
+
+ExtSyncEvent* ExtSyncImpl::readStreamRecord(SyncStreamReader& reader, uint64_t& timestamp)
+{
+	const uint8_t header = reader.readByte();
+	NvBlastID familyID;
+	reader.readBytes(&familyID, sizeof(NvBlastID));
+	timestamp += zigzagDecode(reader.readVarint());
+
+	ExtSyncEvent* e = nullptr;
+	switch (header & SyncStreamFlag::TypeMask)
+	{
+	case ExtSyncEventType::Fracture:
+	{
+		ExtSyncEventFracture* fractureEvent = NVBLAST_NEW(ExtSyncEventFracture) ();
+		fractureEvent->bondFractures.resize(reader.readCount());
+		for (NvBlastBondFractureData& fracture : fractureEvent->bondFractures)
+		{
+			fracture.userdata = 0;
+			fracture.nodeIndex0 = reader.readIndex();
+			fracture.nodeIndex1 = reader.readIndex();
+			fracture.health = reader.readFloat();
+		}
+		fractureEvent->chunkFractures.resize(reader.readCount());
+		for (NvBlastChunkFractureData& fracture : fractureEvent->chunkFractures)
+		{
+			fracture.userdata = 0;
+			fracture.chunkIndex = reader.readIndex();
+			fracture.health = reader.readFloat();
+		}
+		e = fractureEvent;
+		break;
+	}
+	case ExtSyncEventType::FamilySync:
+	{
+		ExtSyncEventFamilySync* familyEvent = NVBLAST_NEW(ExtSyncEventFamilySync) ();
+		familyEvent->family.resize(reader.readCount());
+		reader.readBytes(familyEvent->family.data(), static_cast<uint32_t>(familyEvent->family.size()));
+		e = familyEvent;
+		break;
+	}
+	case ExtSyncEventType::Physics:
+	{
+		ExtSyncEventPhysicsSync* physicsEvent = NVBLAST_NEW(ExtSyncEventPhysicsSync) ();
+		physicsEvent->data.resize(reader.readCount());
+		for (ExtSyncEventPhysicsSync::ActorData& data : physicsEvent->data)
+		{
+			data.actorIndex = reader.readIndex();
+			reader.readBytes(&data.transform, sizeof(physx::PxTransform));
+		}
+		e = physicsEvent;
+		break;
+	}
+	case ExtSyncEventType::BondHealths:
+	{
+		ExtSyncEventBondHealths* healthsEvent = NVBLAST_NEW(ExtSyncEventBondHealths) ();
+		const bool is16Bit = (header & SyncStreamFlag::Health16) != 0;
+		const uint32_t maxValue = is16Bit ? 0xFFFF : 0xFF;
+		const float maxBondHealth = reader.readFloat();
+		healthsEvent->keyframe = (header & SyncStreamFlag::Keyframe) != 0;
+		healthsEvent->data.resize(reader.readCount());
+		uint32_t nextBondIndex = 0;
+		for (ExtSyncEventBondHealths::BondData& data : healthsEvent->data)
+		{
+			data.bondIndex = healthsEvent->keyframe ? nextBondIndex : nextBondIndex + reader.readIndex();
+			data.health = dequantizeHealth(reader.readQuantized(is16Bit), maxBondHealth, maxValue);
+			nextBondIndex = data.bondIndex + 1;
+		}
+		e = healthsEvent;
+		break;
+	}
+	default:
+		return nullptr;
+	}
+
+	if (reader.hasError())
+	{
+		e->release();
+		return nullptr;
+	}
+
+	e->timestamp = timestamp;
+	e->familyID = familyID;
+	return e;
+}
+
 } // namespace Blast
 } // namespace Nv
@@ -50,6 +50,31 @@ public:
 	virtual Nv::Blast::DebugBuffer fillDebugRender(int depth = -1, bool segments = false) = 0;
 };
 
+/**
+Damage accelerator types, passed as the 'type' argument of NvBlastExtDamageAcceleratorCreate.
+*/
+struct NvBlastExtDamageAcceleratorType
+{
+	enum Enum
+	{
+		None = 0,		//!<	No accelerator, NvBlastExtDamageAcceleratorCreate returns nullptr.
+		AABBTree = 3,	//!<	Binary AABB tree.  Values not listed here also create an AABB tree.
+		BVH4 = 4,		//!<	4-wide bounding volume hierarchy, each node tests its 4 child boxes at once using SIMD.
+		Grid = 5		//!<	Sparse uniform grid of bond centroids.  Best suited for assets with roughly uniform bond density, like voxel-like assets.
+	};
+};
+
+/**
+Creates a damage accelerator for the given asset, which can be passed to the damage shaders in NvBlastExtProgramParams.
+
+Shaders query the accelerator only when the query is expected to visit fewer bonds than the damaged actor has, so the same
+accelerator serves both large actors and small debris.
+
+\param[in]	asset	The asset to build the accelerator for.
+\param[in]	type	Accelerator type, see NvBlastExtDamageAcceleratorType.
+
+\return the new accelerator, or nullptr for NvBlastExtDamageAcceleratorType::None.  Release with NvBlastExtDamageAccelerator::release.
+*/
 NVBLAST_API NvBlastExtDamageAccelerator* NvBlastExtDamageAcceleratorCreate(const NvBlastAsset* asset, int type);
 
 
@@ -28,7 +28,6 @@
 #include "NvBlastExtDamageAcceleratorAABBTree.h"
 #include "NvBlastIndexFns.h"
 #include "NvBlastAssert.h"
-#include "PxVec4.h"
 #include <algorithm>
 
 using namespace physx;
@@ -61,9 +60,6 @@ void ExtDamageAcceleratorAABBTree::build(const NvBlastAsset* asset)
 {
 	NVBLAST_ASSERT(m_root == nullptr);
 
-	const NvBlastSupportGraph graph = NvBlastAssetGetSupportGraph(asset, logLL);
-	const NvBlastBond* bonds = NvBlastAssetGetBonds(asset, logLL);
-	const NvBlastChunk* chunks = NvBlastAssetGetChunks(asset, logLL);
 	const uint32_t N = NvBlastAssetGetBondCount(asset, logLL);
 
 	m_indices.resizeUninitialized(N);
@@ -72,40 +68,10 @@ void ExtDamageAcceleratorAABBTree::build(const NvBlastAsset* asset)
 	m_bonds.resizeUninitialized(N);
 	m_nodes.reserve(2 * N);
 
-	for (uint32_t node0 = 0; node0 < graph.nodeCount; ++node0)
+	fillBondData(asset, m_points.begin(), m_segments.begin(), m_bonds.begin());
+	for (uint32_t i = 0; i < N; ++i)
 	{
-		for (uint32_t j = graph.adjacencyPartition[node0]; j < graph.adjacencyPartition[node0 + 1]; ++j)
-		{
-			uint32_t bondIndex = graph.adjacentBondIndices[j];
-			uint32_t node1 = graph.adjacentNodeIndices[j];
-			if (node0 < node1)
-			{
-				const NvBlastBond& bond = bonds[bondIndex];
-				const PxVec3& p = (reinterpret_cast<const PxVec3&>(bond.centroid));
-				m_points[bondIndex] = p;
-				m_indices[bondIndex] = bondIndex;
-				m_bonds[bondIndex].node0 = node0;
-				m_bonds[bondIndex].node1 = node1;
-
-				// filling bond segments as a connection of 2 chunk centroids
-				const uint32_t chunk0 = graph.chunkIndices[node0];
-				const uint32_t chunk1 = graph.chunkIndices[node1];
-				if (isInvalidIndex(chunk1))
-				{
-					// for world node we don't have it's centroid, so approximate with projection on bond normal 
-					m_segments[bondIndex].p0 = (reinterpret_cast<const PxVec3&>(chunks[chunk0].centroid));
-					const PxVec3 normal = (reinterpret_cast<const PxVec3&>(bond.normal));
-					m_segments[bondIndex].p1 = m_segments[bondIndex].p0 + normal * (p - m_segments[bondIndex].p0).dot(normal) * 2;
-
-				}
-				else
-				{
-					m_segments[bondIndex].p0 = (reinterpret_cast<const PxVec3&>(chunks[chunk0].centroid));
-					m_segments[bondIndex].p1 = (reinterpret_cast<const PxVec3&>(chunks[chunk1].centroid));
-				}
-			}
-		}
-
+		m_indices[i] = i;
 	}
 
 	int rootIndex = N > 0 ? createNode(0, N - 1, 0) : -1;
@@ -251,24 +217,6 @@ void ExtDamageAcceleratorAABBTree::findSegmentsInBounds(const Node& node, Result
 	}
 }
 
-bool intersectSegmentPlane(const PxVec3& v1, const PxVec3& v2, const PxPlane& p)
-{
-	const bool s1 = p.distance(v1) > 0.f;
-	const bool s2 = p.distance(v2) > 0.f;
-	return (s1 && !s2) || (s2 && !s1);
-}
-
-bool intersectBoundsPlane(const PxBounds3& b, const PxPlane& p)
-{
-	const PxVec3 extents = b.getExtents();
-	const PxVec3 center = b.getCenter();
-
-	float r =  extents.x * PxAbs(p.n.x) + extents.y * PxAbs(p.n.y) + extents.z * PxAbs(p.n.z);
-	float s = p.n.dot(center) + p.d;
-
-	return PxAbs(s) <= r;
-}
-
 void ExtDamageAcceleratorAABBTree::findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const
 {
 	if (m_root)
@@ -308,16 +256,6 @@ void ExtDamageAcceleratorAABBTree::findSegmentsPlaneIntersected(const Node& node
 //													Debug Render
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static uint32_t PxVec4ToU32Color(const PxVec4& color)
-{
-	uint32_t c = 0;
-	c |= (int)(color.w * 255); c <<= 8;
-	c |= (int)(color.z * 255); c <<= 8;
-	c |= (int)(color.y * 255); c <<= 8;
-	c |= (int)(color.x * 255);
-	return c;
-}
-
 Nv::Blast::DebugBuffer ExtDamageAcceleratorAABBTree::fillDebugRender(int depth, bool segments)
 {
 	Nv::Blast::DebugBuffer debugBuffer = { nullptr, 0 };
@@ -339,31 +277,7 @@ void ExtDamageAcceleratorAABBTree::fillDebugBuffer(const Node& node, int current
 {
 	if (depth < 0 || currentDepth == depth)
 	{
-		const PxVec4 LEAF_COLOR(1.0f, 1.0f, 1.0f, 1.0f);
-		const PxVec4 NON_LEAF_COLOR(0.3f, 0.3f, 0.3f, 1.0f);
-
-		// draw box
-		const PxBounds3 bounds = segments ? node.segmentsBound : node.pointsBound;
-		const PxVec3 center = bounds.getCenter();
-		const PxVec3 extents = bounds.getExtents();
-
-		const int vs[] = { 0,3,5,6 };
-		for (int i = 0; i < 4; i++)
-		{
-			int v = vs[i];
-			for (int d = 1; d < 8; d <<= 1)
-			{
-				auto flip = [](int x, int k) { return ((x >> k) & 1) * 2.f - 1.f; };
-				const float s = std::pow(0.99f, currentDepth);
-				PxVec3 p0 = center + s * extents.multiply(PxVec3(flip(v, 0), flip(v, 1), flip(v, 2)));
-				PxVec3 p1 = center + s * extents.multiply(PxVec3(flip(v^d, 0), flip(v^d, 1), flip(v^d, 2)));
-				m_debugLineBuffer.pushBack(Nv::Blast::DebugLine(
-					reinterpret_cast<NvcVec3&>(p0), 
-					reinterpret_cast<NvcVec3&>(p1), 
-					PxVec4ToU32Color(LEAF_COLOR * (1.f - (currentDepth + 1) * 0.1f)))
-				);
-			}
-		}
+		pushDebugBox(m_debugLineBuffer, segments ? node.segmentsBound : node.pointsBound, currentDepth);
 	}
 
 	for (uint32_t i = 0; i < 2; ++i)
@@ -71,6 +71,16 @@ public:
 
 	virtual void findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const override;
 
+	virtual uint32_t getBondCount() const override
+	{
+		return m_bonds.size();
+	}
+
+	virtual uint32_t estimateBondCentroidsInBounds(const physx::PxBounds3& bounds) const override
+	{
+		return m_root ? estimatePointCount(m_root->pointsBound, m_bonds.size(), bounds) : 0;
+	}
+
 	virtual Nv::Blast::DebugBuffer fillDebugRender(int depth, bool segments) override;
 
 	virtual void* getImmediateScratch(size_t size) override
@@ -124,19 +134,9 @@ private:
 
 	Array<physx::PxVec3>::type		      m_points;
 
-	struct Segment
-	{
-		physx::PxVec3	p0;
-		physx::PxVec3	p1;
-	};
-	Array<Segment>::type			      m_segments;
+	Array<BondSegment>::type			  m_segments;
 
-	struct BondData
-	{
-		uint32_t		node0;
-		uint32_t		node1;
-	};
-	Array<BondData>::type		          m_bonds;
+	Array<QueryBondData>::type		      m_bonds;
 
 	Array<Nv::Blast::DebugLine>::type     m_debugLineBuffer;
 
@@ -0,0 +1,424 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#include "NvBlastExtDamageAcceleratorBVH4.h"
+#include "NvBlastIndexFns.h"
+#include "NvBlastAssert.h"
+#include <algorithm>
+
+#if NV_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace physx;
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Creation
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ExtDamageAcceleratorBVH4* ExtDamageAcceleratorBVH4::create(const NvBlastAsset* asset)
+{
+	ExtDamageAcceleratorBVH4* tree = NVBLAST_NEW(Nv::Blast::ExtDamageAcceleratorBVH4) ();
+	tree->build(asset);
+	return tree;
+}
+
+
+void ExtDamageAcceleratorBVH4::release()
+{
+	NVBLAST_DELETE(this, ExtDamageAcceleratorBVH4);
+}
+
+
+void ExtDamageAcceleratorBVH4::build(const NvBlastAsset* asset)
+{
+	NVBLAST_ASSERT(m_nodes.empty());
+
+	const uint32_t N = NvBlastAssetGetBondCount(asset, logLL);
+
+	m_indices.resizeUninitialized(N);
+	m_points.resizeUninitialized(N);
+	m_segments.resizeUninitialized(N);
+	m_bonds.resizeUninitialized(N);
+	m_nodes.reserve(N / LEAF_SIZE + 1);
+
+	fillBondData(asset, m_points.begin(), m_segments.begin(), m_bonds.begin());
+	for (uint32_t i = 0; i < N; ++i)
+	{
+		m_indices[i] = i;
+	}
+
+	if (N > 0)
+	{
+		createNode(0, N);
+	}
+}
+
+
+uint32_t ExtDamageAcceleratorBVH4::splitRange(uint32_t startIdx, uint32_t endIdx)
+{
+	PxBounds3 bounds = PxBounds3::empty();
+	for (uint32_t i = startIdx; i < endIdx; i++)
+	{
+		bounds.include(m_points[m_indices[i]]);
+	}
+
+	// select axis of biggest extent
+	const PxVec3 ext = bounds.getExtents();
+	uint32_t axis = 0;
+	for (uint32_t k = 1; k < 3; k++)
+	{
+		if (ext[k] > ext[axis])
+		{
+			axis = k;
+		}
+	}
+
+	// split on selected axis and partially sort around the middle
+	const uint32_t mid = startIdx + (endIdx - startIdx) / 2;
+	std::nth_element(m_indices.begin() + startIdx, m_indices.begin() + mid, m_indices.begin() + endIdx, [&](uint32_t lhs, uint32_t rhs)
+	{
+		return m_points[lhs][axis] < m_points[rhs][axis];
+	});
+
+	return mid;
+}
+
+
+uint32_t ExtDamageAcceleratorBVH4::createNode(uint32_t startIdx, uint32_t endIdx)
+{
+	const uint32_t nodeIndex = m_nodes.size();
+	m_nodes.pushBack(Node());
+
+	// Up to 4 children from two levels of median splits, ranges too small to split become a single leaf
+	uint32_t splits[5] = { startIdx, endIdx, endIdx, endIdx, endIdx };
+	if (endIdx - startIdx > LEAF_SIZE)
+	{
+		splits[2] = splitRange(startIdx, endIdx);
+		splits[1] = splitRange(startIdx, splits[2]);
+		splits[3] = splitRange(splits[2], endIdx);
+	}
+
+	Node node;
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		node.first[i] = splits[i];
+		node.count[i] = splits[i + 1] - splits[i];
+
+		PxBounds3 pointsBound = PxBounds3::empty();
+		PxBounds3 segmentsBound = PxBounds3::empty();
+		for (uint32_t j = splits[i]; j < splits[i + 1]; j++)
+		{
+			const uint32_t idx = m_indices[j];
+			pointsBound.include(m_points[idx]);
+			segmentsBound.include(m_segments[idx].p0);
+			segmentsBound.include(m_segments[idx].p1);
+		}
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			node.pointsMin[axis][i] = pointsBound.minimum[axis];
+			node.pointsMax[axis][i] = pointsBound.maximum[axis];
+			node.segmentsMin[axis][i] = segmentsBound.minimum[axis];
+			node.segmentsMax[axis][i] = segmentsBound.maximum[axis];
+		}
+
+		node.child[i] = node.count[i] > LEAF_SIZE ? createNode(splits[i], splits[i + 1]) : invalidIndex<uint32_t>();
+	}
+
+	m_nodes[nodeIndex] = node;
+
+	return nodeIndex;
+}
+
+
+PxBounds3 ExtDamageAcceleratorBVH4::getChildBounds(const Node& node, uint32_t i, bool segments) const
+{
+	const float (&bmin)[3][4] = segments ? node.segmentsMin : node.pointsMin;
+	const float (&bmax)[3][4] = segments ? node.segmentsMax : node.pointsMax;
+	return PxBounds3(PxVec3(bmin[0][i], bmin[1][i], bmin[2][i]), PxVec3(bmax[0][i], bmax[1][i], bmax[2][i]));
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//														Queries
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+Tests the 4 child boxes of a node against 'bounds'.  Bit i of overlapMask is set if child i intersects 'bounds', and bit i of insideMask
+if it is also contained in 'bounds'.
+*/
+static NV_FORCE_INLINE void testChildBounds(const float (&bmin)[3][4], const float (&bmax)[3][4], const PxBounds3& bounds, uint32_t& overlapMask, uint32_t& insideMask)
+{
+#if NV_SSE2
+	__m128 overlap = _mm_castsi128_ps(_mm_set1_epi32(-1));
+	__m128 inside = overlap;
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		const __m128 queryMin = _mm_set1_ps(bounds.minimum[axis]);
+		const __m128 queryMax = _mm_set1_ps(bounds.maximum[axis]);
+		const __m128 childMin = _mm_loadu_ps(bmin[axis]);
+		const __m128 childMax = _mm_loadu_ps(bmax[axis]);
+		overlap = _mm_and_ps(overlap, _mm_and_ps(_mm_cmple_ps(childMin, queryMax), _mm_cmple_ps(queryMin, childMax)));
+		inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmpge_ps(childMin, queryMin), _mm_cmple_ps(childMax, queryMax)));
+	}
+	overlapMask = (uint32_t)_mm_movemask_ps(overlap);
+	insideMask = (uint32_t)_mm_movemask_ps(inside) & overlapMask;
+#else
+	overlapMask = insideMask = 0;
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		bool overlap = true;
+		bool inside = true;
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			overlap = overlap && bmin[axis][i] <= bounds.maximum[axis] && bounds.minimum[axis] <= bmax[axis][i];
+			inside = inside && bmin[axis][i] >= bounds.minimum[axis] && bmax[axis][i] <= bounds.maximum[axis];
+		}
+		overlapMask |= overlap ? (1u << i) : 0;
+		insideMask |= overlap && inside ? (1u << i) : 0;
+	}
+#endif
+}
+
+/**
+Returns a mask with bit i set if the plane intersects child box i, same test as intersectBoundsPlane.
+*/
+static NV_FORCE_INLINE uint32_t testChildBoundsPlane(const float (&bmin)[3][4], const float (&bmax)[3][4], const PxPlane& plane)
+{
+#if NV_SSE2
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128 r = _mm_setzero_ps();
+	__m128 s = _mm_setzero_ps();
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		const __m128 childMin = _mm_loadu_ps(bmin[axis]);
+		const __m128 childMax = _mm_loadu_ps(bmax[axis]);
+		const __m128 extents = _mm_mul_ps(_mm_sub_ps(childMax, childMin), half);
+		const __m128 center = _mm_mul_ps(_mm_add_ps(childMin, childMax), half);
+		r = _mm_add_ps(r, _mm_mul_ps(extents, _mm_set1_ps(PxAbs(plane.n[axis]))));
+		s = _mm_add_ps(s, _mm_mul_ps(center, _mm_set1_ps(plane.n[axis])));
+	}
+	s = _mm_add_ps(s, _mm_set1_ps(plane.d));
+	return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(_mm_and_ps(s, absMask), r));
+#else
+	uint32_t mask = 0;
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		const PxBounds3 bounds(PxVec3(bmin[0][i], bmin[1][i], bmin[2][i]), PxVec3(bmax[0][i], bmax[1][i], bmax[2][i]));
+		mask |= intersectBoundsPlane(bounds, plane) ? (1u << i) : 0;
+	}
+	return mask;
+#endif
+}
+
+
+void ExtDamageAcceleratorBVH4::findInBounds(const physx::PxBounds3& bounds, ResultCallback& callback, bool segments) const
+{
+	if (m_nodes.empty())
+	{
+		return;
+	}
+
+	uint32_t stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		uint32_t overlapMask, insideMask;
+		if (segments)
+		{
+			testChildBounds(node.segmentsMin, node.segmentsMax, bounds, overlapMask, insideMask);
+		}
+		else
+		{
+			testChildBounds(node.pointsMin, node.pointsMax, bounds, overlapMask, insideMask);
+		}
+
+		for (uint32_t i = 0; overlapMask != 0; ++i, overlapMask >>= 1, insideMask >>= 1)
+		{
+			if (!(overlapMask & 1))
+			{
+				continue;
+			}
+
+			const uint32_t first = node.first[i];
+			const uint32_t last = first + node.count[i];
+			if (insideMask & 1)
+			{
+				// if search bound contains child bound, simply add all point indexes.
+				for (uint32_t j = first; j < last; j++)
+				{
+					pushResult(callback, m_indices[j]);
+				}
+			}
+			else if (isInvalidIndex(node.child[i]))
+			{
+				for (uint32_t j = first; j < last; j++)
+				{
+					const uint32_t idx = m_indices[j];
+					if (segments ? (bounds.contains(m_segments[idx].p0) || bounds.contains(m_segments[idx].p1)) : bounds.contains(m_points[idx]))
+					{
+						pushResult(callback, idx);
+					}
+				}
+			}
+			else
+			{
+				NVBLAST_ASSERT(stackSize < STACK_SIZE);
+				stack[stackSize++] = node.child[i];
+			}
+		}
+	}
+
+	callback.dispatch();
+}
+
+
+void ExtDamageAcceleratorBVH4::findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const
+{
+	if (m_nodes.empty())
+	{
+		return;
+	}
+
+	uint32_t stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		uint32_t hitMask = testChildBoundsPlane(node.segmentsMin, node.segmentsMax, plane);
+		for (uint32_t i = 0; hitMask != 0; ++i, hitMask >>= 1)
+		{
+			if (!(hitMask & 1))
+			{
+				continue;
+			}
+
+			if (isInvalidIndex(node.child[i]))
+			{
+				const uint32_t first = node.first[i];
+				const uint32_t last = first + node.count[i];
+				for (uint32_t j = first; j < last; j++)
+				{
+					const uint32_t idx = m_indices[j];
+					if (intersectSegmentPlane(m_segments[idx].p0, m_segments[idx].p1, plane))
+					{
+						pushResult(resultCallback, idx);
+					}
+				}
+			}
+			else
+			{
+				NVBLAST_ASSERT(stackSize < STACK_SIZE);
+				stack[stackSize++] = node.child[i];
+			}
+		}
+	}
+
+	resultCallback.dispatch();
+}
+
+
+uint32_t ExtDamageAcceleratorBVH4::estimateBondCentroidsInBounds(const physx::PxBounds3& bounds) const
+{
+	if (m_nodes.empty())
+	{
+		return 0;
+	}
+
+	// Uniform distribution within each of the root's children
+	const Node& root = m_nodes[0];
+	uint32_t estimate = 0;
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		estimate += estimatePointCount(getChildBounds(root, i, false), root.count[i], bounds);
+	}
+
+	return estimate;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Debug Render
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Nv::Blast::DebugBuffer ExtDamageAcceleratorBVH4::fillDebugRender(int depth, bool segments)
+{
+	Nv::Blast::DebugBuffer debugBuffer = { nullptr, 0 };
+
+	m_debugLineBuffer.clear();
+
+	if (!m_nodes.empty())
+	{
+		fillDebugBuffer(0, 0, depth, segments);
+	}
+
+	debugBuffer.lines = m_debugLineBuffer.begin();
+	debugBuffer.lineCount = m_debugLineBuffer.size();
+
+	return debugBuffer;
+}
+
+
+void ExtDamageAcceleratorBVH4::fillDebugBuffer(uint32_t nodeIndex, int currentDepth, int depth, bool segments)
+{
+	const Node& node = m_nodes[nodeIndex];
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		if (node.count[i] == 0)
+		{
+			continue;
+		}
+
+		if (depth < 0 || currentDepth == depth)
+		{
+			pushDebugBox(m_debugLineBuffer, getChildBounds(node, i, segments), currentDepth);
+		}
+
+		if (!isInvalidIndex(node.child[i]))
+		{
+			fillDebugBuffer(node.child[i], currentDepth + 1, depth, segments);
+		}
+	}
+}
+
+
+} // namespace Blast
+} // namespace Nv
@@ -0,0 +1,152 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#pragma once
+
+#include "NvBlastExtDamageAcceleratorInternal.h"
+#include "NvBlast.h"
+#include "NvBlastArray.h"
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+Bounding volume hierarchy with 4 children per node.  Child bounds are stored in SoA layout so that a query tests all 4 of them at once.
+*/
+class ExtDamageAcceleratorBVH4 final : public ExtDamageAcceleratorInternal
+{
+public:
+	//////// ctor ////////
+
+	ExtDamageAcceleratorBVH4()
+	{
+	}
+
+	virtual ~ExtDamageAcceleratorBVH4()
+	{
+	}
+
+	static ExtDamageAcceleratorBVH4* create(const NvBlastAsset* asset);
+
+
+	//////// interface ////////
+
+	virtual void release() override;
+
+	virtual void findBondCentroidsInBounds(const physx::PxBounds3& bounds, ResultCallback& resultCallback) const override
+	{
+		findInBounds(bounds, resultCallback, false);
+	}
+
+	virtual void findBondSegmentsInBounds(const physx::PxBounds3& bounds, ResultCallback& resultCallback) const override
+	{
+		findInBounds(bounds, resultCallback, true);
+	}
+
+	virtual void findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const override;
+
+	virtual uint32_t getBondCount() const override
+	{
+		return m_bonds.size();
+	}
+
+	virtual uint32_t estimateBondCentroidsInBounds(const physx::PxBounds3& bounds) const override;
+
+	virtual Nv::Blast::DebugBuffer fillDebugRender(int depth, bool segments) override;
+
+	virtual void* getImmediateScratch(size_t size) override
+	{
+		m_scratch.resizeUninitialized(size);
+		return m_scratch.begin();
+	}
+
+
+private:
+	// no copy/assignment
+	ExtDamageAcceleratorBVH4(ExtDamageAcceleratorBVH4&);
+	ExtDamageAcceleratorBVH4& operator=(const ExtDamageAcceleratorBVH4& tree);
+
+	// Tree node, children cover the contiguous ranges [first, first + count) of m_indices.  Unused children have empty bounds and count = 0.
+	struct Node
+	{
+		float		pointsMin[3][4];
+		float		pointsMax[3][4];
+		float		segmentsMin[3][4];
+		float		segmentsMax[3][4];
+		uint32_t	first[4];
+		uint32_t	count[4];
+		uint32_t	child[4];	// Node index, or invalidIndex<uint32_t>() for leaves
+	};
+
+	// Leaf size and the traversal stack size it allows for, given the median splits keep the tree balanced
+	enum
+	{
+		LEAF_SIZE = 8,
+		STACK_SIZE = 64
+	};
+
+
+	void build(const NvBlastAsset* asset);
+
+	uint32_t createNode(uint32_t startIdx, uint32_t endIdx);
+
+	uint32_t splitRange(uint32_t startIdx, uint32_t endIdx);
+
+	physx::PxBounds3 getChildBounds(const Node& node, uint32_t i, bool segments) const;
+
+	void pushResult(ResultCallback& callback, uint32_t pointIndex) const
+	{
+		callback.push(pointIndex, m_bonds[pointIndex].node0, m_bonds[pointIndex].node1);
+	}
+
+	void findInBounds(const physx::PxBounds3& bounds, ResultCallback& callback, bool segments) const;
+
+	void fillDebugBuffer(uint32_t nodeIndex, int currentDepth, int depth, bool segments);
+
+
+	//////// data ////////
+
+	Array<Node>::type						m_nodes;
+	Array<uint32_t>::type					m_indices;
+
+	Array<physx::PxVec3>::type				m_points;
+
+	Array<BondSegment>::type				m_segments;
+
+	Array<QueryBondData>::type				m_bonds;
+
+	Array<Nv::Blast::DebugLine>::type		m_debugLineBuffer;
+
+	Array<char>::type						m_scratch;
+};
+
+
+} // namespace Blast
+} // namespace Nv
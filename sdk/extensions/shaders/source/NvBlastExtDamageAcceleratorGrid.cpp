@@ -0,0 +1,331 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#include "NvBlastExtDamageAcceleratorGrid.h"
+#include "NvBlastIndexFns.h"
+#include "NvBlastAssert.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace physx;
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Creation
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ExtDamageAcceleratorGrid* ExtDamageAcceleratorGrid::create(const NvBlastAsset* asset)
+{
+	ExtDamageAcceleratorGrid* grid = NVBLAST_NEW(Nv::Blast::ExtDamageAcceleratorGrid) ();
+	grid->build(asset);
+	return grid;
+}
+
+
+void ExtDamageAcceleratorGrid::release()
+{
+	NVBLAST_DELETE(this, ExtDamageAcceleratorGrid);
+}
+
+
+void ExtDamageAcceleratorGrid::build(const NvBlastAsset* asset)
+{
+	NVBLAST_ASSERT(m_cells.empty());
+
+	const uint32_t N = NvBlastAssetGetBondCount(asset, logLL);
+
+	m_indices.resizeUninitialized(N);
+	m_points.resizeUninitialized(N);
+	m_segments.resizeUninitialized(N);
+	m_bonds.resizeUninitialized(N);
+
+	fillBondData(asset, m_points.begin(), m_segments.begin(), m_bonds.begin());
+
+	m_bounds = PxBounds3::empty();
+	m_segmentReach = PxVec3(0.0f);
+	m_dims[0] = m_dims[1] = m_dims[2] = 1;
+	m_invCellSize = 1.0f;
+	for (uint32_t i = 0; i < N; ++i)
+	{
+		m_indices[i] = i;
+		m_bounds.include(m_points[i]);
+
+		// how far bond segments reach out of the cell holding their centroid
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			const float reach0 = PxAbs(m_segments[i].p0[axis] - m_points[i][axis]);
+			const float reach1 = PxAbs(m_segments[i].p1[axis] - m_points[i][axis]);
+			m_segmentReach[axis] = PxMax(m_segmentReach[axis], PxMax(reach0, reach1));
+		}
+	}
+
+	if (N == 0)
+	{
+		return;
+	}
+
+	// Cell size giving about POINTS_PER_CELL points per cell.  Axes the bonds are flat along count as one cell wide, hence the iteration.
+	const PxVec3 dimensions = m_bounds.maximum - m_bounds.minimum;
+	float cellSize = PxMax(dimensions.x, PxMax(dimensions.y, dimensions.z));
+	for (uint32_t iter = 0; iter < 16; ++iter)
+	{
+		const float volume = PxMax(dimensions.x, cellSize) * PxMax(dimensions.y, cellSize) * PxMax(dimensions.z, cellSize);
+		cellSize = std::cbrt(volume * POINTS_PER_CELL / N);
+	}
+	if (!(cellSize > 0.0f))
+	{
+		cellSize = 1.0f;
+	}
+	m_invCellSize = 1.0f / cellSize;
+
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		const float dim = PxMin(dimensions[axis] * m_invCellSize, (float)(1 << MAX_CELL_COORD_BITS));
+		m_dims[axis] = PxMin((uint32_t)dim + 1, (uint32_t)(1 << MAX_CELL_COORD_BITS));
+	}
+
+	// sort bonds by cell
+	Array<uint64_t>::type keys(N);
+	for (uint32_t i = 0; i < N; ++i)
+	{
+		const PxVec3& p = m_points[i];
+		keys[i] = getCellKey(getCellCoord(p.x, 0), getCellCoord(p.y, 1), getCellCoord(p.z, 2));
+	}
+	std::sort(m_indices.begin(), m_indices.end(), [&](uint32_t lhs, uint32_t rhs)
+	{
+		return keys[lhs] < keys[rhs] || (keys[lhs] == keys[rhs] && lhs < rhs);
+	});
+
+	// fill cells
+	for (uint32_t i = 0; i < N; ++i)
+	{
+		const uint32_t idx = m_indices[i];
+		if (m_cells.empty() || m_cells.back().key != keys[idx])
+		{
+			Cell cell;
+			cell.pointsBound = PxBounds3::empty();
+			cell.segmentsBound = PxBounds3::empty();
+			cell.key = keys[idx];
+			cell.first = i;
+			cell.count = 0;
+			m_cells.pushBack(cell);
+		}
+
+		Cell& cell = m_cells.back();
+		cell.pointsBound.include(m_points[idx]);
+		cell.segmentsBound.include(m_segments[idx].p0);
+		cell.segmentsBound.include(m_segments[idx].p1);
+		cell.count++;
+	}
+
+	// hash table, open addressing with at most 50% load
+	m_tableBits = 1;
+	while ((1u << m_tableBits) < 2 * m_cells.size())
+	{
+		m_tableBits++;
+	}
+	m_table.resize(1u << m_tableBits, invalidIndex<uint32_t>());
+	for (uint32_t i = 0; i < m_cells.size(); ++i)
+	{
+		uint32_t slot = hashKey(m_cells[i].key);
+		while (!isInvalidIndex(m_table[slot]))
+		{
+			slot = (slot + 1) & (m_table.size() - 1);
+		}
+		m_table[slot] = i;
+	}
+}
+
+
+uint32_t ExtDamageAcceleratorGrid::getCellCoord(float v, uint32_t axis) const
+{
+	const float f = (v - m_bounds.minimum[axis]) * m_invCellSize;
+	if (!(f > 0.0f))
+	{
+		return 0;
+	}
+	return f < (float)m_dims[axis] ? PxMin((uint32_t)f, m_dims[axis] - 1) : m_dims[axis] - 1;
+}
+
+
+uint32_t ExtDamageAcceleratorGrid::findCell(uint64_t key) const
+{
+	uint32_t slot = hashKey(key);
+	for (;;)
+	{
+		const uint32_t cellIndex = m_table[slot];
+		if (isInvalidIndex(cellIndex) || m_cells[cellIndex].key == key)
+		{
+			return cellIndex;
+		}
+		slot = (slot + 1) & (m_table.size() - 1);
+	}
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//														Queries
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExtDamageAcceleratorGrid::findInBounds(const physx::PxBounds3& bounds, ResultCallback& callback, bool segments) const
+{
+	// segments can stick out of the cell holding their centroid by up to m_segmentReach
+	const PxBounds3 searchBounds = segments ? PxBounds3(bounds.minimum - m_segmentReach, bounds.maximum + m_segmentReach) : bounds;
+	if (m_cells.empty() || !searchBounds.intersects(m_bounds))
+	{
+		return;
+	}
+
+	uint32_t lo[3], hi[3];
+	uint64_t rangeCellCount = 1;
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		lo[axis] = getCellCoord(searchBounds.minimum[axis], axis);
+		hi[axis] = getCellCoord(searchBounds.maximum[axis], axis);
+		rangeCellCount *= hi[axis] - lo[axis] + 1;
+	}
+
+	if (rangeCellCount > m_cells.size())
+	{
+		// large query, cheaper to walk the occupied cells
+		for (uint32_t i = 0; i < m_cells.size(); ++i)
+		{
+			findInCell(m_cells[i], bounds, callback, segments);
+		}
+	}
+	else
+	{
+		for (uint32_t z = lo[2]; z <= hi[2]; ++z)
+		{
+			for (uint32_t y = lo[1]; y <= hi[1]; ++y)
+			{
+				for (uint32_t x = lo[0]; x <= hi[0]; ++x)
+				{
+					const uint32_t cellIndex = findCell(getCellKey(x, y, z));
+					if (!isInvalidIndex(cellIndex))
+					{
+						findInCell(m_cells[cellIndex], bounds, callback, segments);
+					}
+				}
+			}
+		}
+	}
+
+	callback.dispatch();
+}
+
+
+void ExtDamageAcceleratorGrid::findInCell(const Cell& cell, const physx::PxBounds3& bounds, ResultCallback& callback, bool segments) const
+{
+	const PxBounds3& cellBound = segments ? cell.segmentsBound : cell.pointsBound;
+	if (!bounds.intersects(cellBound))
+	{
+		return;
+	}
+
+	const uint32_t first = cell.first;
+	const uint32_t last = first + cell.count;
+
+	// if search bound contains cell bound, simply add all point indexes.
+	if (cellBound.isInside(bounds))
+	{
+		for (uint32_t i = first; i < last; i++)
+		{
+			pushResult(callback, m_indices[i]);
+		}
+		return;
+	}
+
+	for (uint32_t i = first; i < last; i++)
+	{
+		const uint32_t idx = m_indices[i];
+		if (segments ? (bounds.contains(m_segments[idx].p0) || bounds.contains(m_segments[idx].p1)) : bounds.contains(m_points[idx]))
+		{
+			pushResult(callback, idx);
+		}
+	}
+}
+
+
+void ExtDamageAcceleratorGrid::findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const
+{
+	for (uint32_t i = 0; i < m_cells.size(); ++i)
+	{
+		const Cell& cell = m_cells[i];
+		if (!intersectBoundsPlane(cell.segmentsBound, plane))
+		{
+			continue;
+		}
+
+		const uint32_t last = cell.first + cell.count;
+		for (uint32_t j = cell.first; j < last; j++)
+		{
+			const uint32_t idx = m_indices[j];
+			if (intersectSegmentPlane(m_segments[idx].p0, m_segments[idx].p1, plane))
+			{
+				pushResult(resultCallback, idx);
+			}
+		}
+	}
+
+	resultCallback.dispatch();
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Debug Render
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Nv::Blast::DebugBuffer ExtDamageAcceleratorGrid::fillDebugRender(int depth, bool segments)
+{
+	Nv::Blast::DebugBuffer debugBuffer = { nullptr, 0 };
+
+	m_debugLineBuffer.clear();
+
+	// the grid is flat, all cells are at depth 0
+	if (depth <= 0)
+	{
+		for (uint32_t i = 0; i < m_cells.size(); ++i)
+		{
+			pushDebugBox(m_debugLineBuffer, segments ? m_cells[i].segmentsBound : m_cells[i].pointsBound, 0);
+		}
+	}
+
+	debugBuffer.lines = m_debugLineBuffer.begin();
+	debugBuffer.lineCount = m_debugLineBuffer.size();
+
+	return debugBuffer;
+}
+
+
+} // namespace Blast
+} // namespace Nv
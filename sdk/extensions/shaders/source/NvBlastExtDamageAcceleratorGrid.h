@@ -0,0 +1,170 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#pragma once
+
+#include "NvBlastExtDamageAcceleratorInternal.h"
+#include "NvBlast.h"
+#include "NvBlastArray.h"
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+Uniform grid over bond centroids, sized for a handful of bonds per cell.  Only occupied cells are stored, they are found through a hash
+table keyed by the cell coordinates.  Works best on assets with a roughly uniform bond distribution.
+*/
+class ExtDamageAcceleratorGrid final : public ExtDamageAcceleratorInternal
+{
+public:
+	//////// ctor ////////
+
+	ExtDamageAcceleratorGrid() : m_tableBits(0), m_invCellSize(0.0f)
+	{
+	}
+
+	virtual ~ExtDamageAcceleratorGrid()
+	{
+	}
+
+	static ExtDamageAcceleratorGrid* create(const NvBlastAsset* asset);
+
+
+	//////// interface ////////
+
+	virtual void release() override;
+
+	virtual void findBondCentroidsInBounds(const physx::PxBounds3& bounds, ResultCallback& resultCallback) const override
+	{
+		findInBounds(bounds, resultCallback, false);
+	}
+
+	virtual void findBondSegmentsInBounds(const physx::PxBounds3& bounds, ResultCallback& resultCallback) const override
+	{
+		findInBounds(bounds, resultCallback, true);
+	}
+
+	virtual void findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const override;
+
+	virtual uint32_t getBondCount() const override
+	{
+		return m_bonds.size();
+	}
+
+	virtual uint32_t estimateBondCentroidsInBounds(const physx::PxBounds3& bounds) const override
+	{
+		return estimatePointCount(m_bounds, m_bonds.size(), bounds);
+	}
+
+	virtual Nv::Blast::DebugBuffer fillDebugRender(int depth, bool segments) override;
+
+	virtual void* getImmediateScratch(size_t size) override
+	{
+		m_scratch.resizeUninitialized(size);
+		return m_scratch.begin();
+	}
+
+
+private:
+	// no copy/assignment
+	ExtDamageAcceleratorGrid(ExtDamageAcceleratorGrid&);
+	ExtDamageAcceleratorGrid& operator=(const ExtDamageAcceleratorGrid& tree);
+
+	// Occupied grid cell, holds the bonds [first, first + count) of m_indices
+	struct Cell
+	{
+		physx::PxBounds3	pointsBound;
+		physx::PxBounds3	segmentsBound;
+		uint64_t			key;
+		uint32_t			first;
+		uint32_t			count;
+	};
+
+	enum
+	{
+		POINTS_PER_CELL = 4,
+		MAX_CELL_COORD_BITS = 20,
+		CELL_KEY_SHIFT = 21
+	};
+
+
+	void build(const NvBlastAsset* asset);
+
+	uint32_t getCellCoord(float v, uint32_t axis) const;
+
+	static uint64_t getCellKey(uint32_t x, uint32_t y, uint32_t z)
+	{
+		return (uint64_t)x | (uint64_t)y << CELL_KEY_SHIFT | (uint64_t)z << (2 * CELL_KEY_SHIFT);
+	}
+
+	uint32_t hashKey(uint64_t key) const
+	{
+		return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> (64 - m_tableBits));
+	}
+
+	uint32_t findCell(uint64_t key) const;
+
+	void pushResult(ResultCallback& callback, uint32_t pointIndex) const
+	{
+		callback.push(pointIndex, m_bonds[pointIndex].node0, m_bonds[pointIndex].node1);
+	}
+
+	void findInBounds(const physx::PxBounds3& bounds, ResultCallback& callback, bool segments) const;
+
+	void findInCell(const Cell& cell, const physx::PxBounds3& bounds, ResultCallback& callback, bool segments) const;
+
+
+	//////// data ////////
+
+	Array<Cell>::type						m_cells;
+	Array<uint32_t>::type					m_table;
+	uint32_t								m_tableBits;
+
+	physx::PxBounds3						m_bounds;
+	physx::PxVec3							m_segmentReach;
+	float									m_invCellSize;
+	uint32_t								m_dims[3];
+
+	Array<uint32_t>::type					m_indices;
+
+	Array<physx::PxVec3>::type				m_points;
+
+	Array<BondSegment>::type				m_segments;
+
+	Array<QueryBondData>::type				m_bonds;
+
+	Array<Nv::Blast::DebugLine>::type		m_debugLineBuffer;
+
+	Array<char>::type						m_scratch;
+};
+
+
+} // namespace Blast
+} // namespace Nv
@@ -29,6 +29,8 @@
 
 #include "NvBlastExtDamageShaders.h"
 #include "PxBounds3.h"
+#include "PxPlane.h"
+#include "NvBlastArray.h"
 
 
 namespace Nv
@@ -83,14 +85,61 @@ public:
 		uint32_t	   m_bondCount;
 	};
 
+	struct BondSegment
+	{
+		physx::PxVec3	p0;
+		physx::PxVec3	p1;
+	};
+
 	virtual void findBondCentroidsInBounds(const physx::PxBounds3& bounds, ResultCallback& resultCallback) const = 0;
 	virtual void findBondSegmentsInBounds(const physx::PxBounds3& bounds, ResultCallback& resultCallback) const = 0;
 	virtual void findBondSegmentsPlaneIntersected(const physx::PxPlane& plane, ResultCallback& resultCallback) const = 0;
 
+	// Number of bonds in the accelerated asset.
+	virtual uint32_t getBondCount() const = 0;
+
+	// Cheap estimate of the number of results findBondCentroidsInBounds would report, used to decide whether a query is worth it for a given actor.
+	virtual uint32_t estimateBondCentroidsInBounds(const physx::PxBounds3& bounds) const = 0;
+
 	// Non-thread safe! Multiple calls return the same memory.
 	virtual void* getImmediateScratch(size_t size) = 0;
+
+	/**
+	Fills the per-bond data all accelerators are built from.  Arrays are indexed by bond index and must hold NvBlastAssetGetBondCount(asset) elements.
+	Bond segments connect the centroids of the two bonded chunks.
+	*/
+	static void fillBondData(const NvBlastAsset* asset, physx::PxVec3* points, BondSegment* segments, QueryBondData* bonds);
+
+	/**
+	Estimated number of points inside 'bounds', assuming 'pointCount' points are spread uniformly over 'pointsBounds'.
+	*/
+	static uint32_t estimatePointCount(const physx::PxBounds3& pointsBounds, uint32_t pointCount, const physx::PxBounds3& bounds);
+
+	/**
+	Pushes the 12 edges of 'bounds' for debug render, shrunk and darkened with the tree depth.
+	*/
+	static void pushDebugBox(Array<Nv::Blast::DebugLine>::type& lines, const physx::PxBounds3& bounds, int currentDepth);
 };
 
 
+NV_INLINE bool intersectSegmentPlane(const physx::PxVec3& v1, const physx::PxVec3& v2, const physx::PxPlane& p)
+{
+	const bool s1 = p.distance(v1) > 0.f;
+	const bool s2 = p.distance(v2) > 0.f;
+	return (s1 && !s2) || (s2 && !s1);
+}
+
+NV_INLINE bool intersectBoundsPlane(const physx::PxBounds3& b, const physx::PxPlane& p)
+{
+	const physx::PxVec3 extents = b.getExtents();
+	const physx::PxVec3 center = b.getCenter();
+
+	float r =  extents.x * physx::PxAbs(p.n.x) + extents.y * physx::PxAbs(p.n.y) + extents.z * physx::PxAbs(p.n.z);
+	float s = p.n.dot(center) + p.d;
+
+	return physx::PxAbs(s) <= r;
+}
+
+
 } // namespace Blast
 } // namespace Nv
@@ -29,15 +29,139 @@
 //#include "NvBlastExtDamageAcceleratorOctree.h"
 //#include "NvBlastExtDamageAcceleratorKdtree.h"
 #include "NvBlastExtDamageAcceleratorAABBTree.h"
+#include "NvBlastExtDamageAcceleratorBVH4.h"
+#include "NvBlastExtDamageAcceleratorGrid.h"
+#include "NvBlastIndexFns.h"
+#include "PxVec4.h"
+#include <cmath>
+
+using namespace physx;
+
 
 NvBlastExtDamageAccelerator* NvBlastExtDamageAcceleratorCreate(const NvBlastAsset* asset, int type)
 {
 	switch (type)
 	{
-		case 0:
+		case NvBlastExtDamageAcceleratorType::None:
 			return nullptr;
+		case NvBlastExtDamageAcceleratorType::BVH4:
+			return Nv::Blast::ExtDamageAcceleratorBVH4::create(asset);
+		case NvBlastExtDamageAcceleratorType::Grid:
+			return Nv::Blast::ExtDamageAcceleratorGrid::create(asset);
 		default:
 			return Nv::Blast::ExtDamageAcceleratorAABBTree::create(asset);
 			break;
 	}
 }
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+void ExtDamageAcceleratorInternal::fillBondData(const NvBlastAsset* asset, PxVec3* points, BondSegment* segments, QueryBondData* bonds)
+{
+	const NvBlastSupportGraph graph = NvBlastAssetGetSupportGraph(asset, logLL);
+	const NvBlastBond* assetBonds = NvBlastAssetGetBonds(asset, logLL);
+	const NvBlastChunk* chunks = NvBlastAssetGetChunks(asset, logLL);
+
+	for (uint32_t node0 = 0; node0 < graph.nodeCount; ++node0)
+	{
+		for (uint32_t j = graph.adjacencyPartition[node0]; j < graph.adjacencyPartition[node0 + 1]; ++j)
+		{
+			uint32_t bondIndex = graph.adjacentBondIndices[j];
+			uint32_t node1 = graph.adjacentNodeIndices[j];
+			if (node0 < node1)
+			{
+				const NvBlastBond& bond = assetBonds[bondIndex];
+				const PxVec3& p = (reinterpret_cast<const PxVec3&>(bond.centroid));
+				points[bondIndex] = p;
+				bonds[bondIndex].bond = bondIndex;
+				bonds[bondIndex].node0 = node0;
+				bonds[bondIndex].node1 = node1;
+
+				// filling bond segments as a connection of 2 chunk centroids
+				const uint32_t chunk0 = graph.chunkIndices[node0];
+				const uint32_t chunk1 = graph.chunkIndices[node1];
+				if (isInvalidIndex(chunk1))
+				{
+					// for world node we don't have it's centroid, so approximate with projection on bond normal 
+					segments[bondIndex].p0 = (reinterpret_cast<const PxVec3&>(chunks[chunk0].centroid));
+					const PxVec3 normal = (reinterpret_cast<const PxVec3&>(bond.normal));
+					segments[bondIndex].p1 = segments[bondIndex].p0 + normal * (p - segments[bondIndex].p0).dot(normal) * 2;
+
+				}
+				else
+				{
+					segments[bondIndex].p0 = (reinterpret_cast<const PxVec3&>(chunks[chunk0].centroid));
+					segments[bondIndex].p1 = (reinterpret_cast<const PxVec3&>(chunks[chunk1].centroid));
+				}
+			}
+		}
+	}
+}
+
+
+uint32_t ExtDamageAcceleratorInternal::estimatePointCount(const PxBounds3& pointsBounds, uint32_t pointCount, const PxBounds3& bounds)
+{
+	if (pointCount == 0 || !bounds.intersects(pointsBounds))
+	{
+		return 0;
+	}
+
+	float fraction = 1.0f;
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		// Axes the points are flat along are fully covered once the bounds intersect
+		const float extent = pointsBounds.maximum[axis] - pointsBounds.minimum[axis];
+		if (extent > 0.0f)
+		{
+			const float overlap = PxMin(bounds.maximum[axis], pointsBounds.maximum[axis]) - PxMax(bounds.minimum[axis], pointsBounds.minimum[axis]);
+			fraction *= overlap / extent;
+		}
+	}
+
+	return PxMin((uint32_t)PxCeil(fraction * pointCount), pointCount);
+}
+
+
+static uint32_t PxVec4ToU32Color(const PxVec4& color)
+{
+	uint32_t c = 0;
+	c |= (int)(color.w * 255); c <<= 8;
+	c |= (int)(color.z * 255); c <<= 8;
+	c |= (int)(color.y * 255); c <<= 8;
+	c |= (int)(color.x * 255);
+	return c;
+}
+
+
+void ExtDamageAcceleratorInternal::pushDebugBox(Array<Nv::Blast::DebugLine>::type& lines, const PxBounds3& bounds, int currentDepth)
+{
+	const PxVec4 LEAF_COLOR(1.0f, 1.0f, 1.0f, 1.0f);
+
+	const PxVec3 center = bounds.getCenter();
+	const PxVec3 extents = bounds.getExtents();
+
+	const int vs[] = { 0,3,5,6 };
+	for (int i = 0; i < 4; i++)
+	{
+		int v = vs[i];
+		for (int d = 1; d < 8; d <<= 1)
+		{
+			auto flip = [](int x, int k) { return ((x >> k) & 1) * 2.f - 1.f; };
+			const float s = std::pow(0.99f, currentDepth);
+			PxVec3 p0 = center + s * extents.multiply(PxVec3(flip(v, 0), flip(v, 1), flip(v, 2)));
+			PxVec3 p1 = center + s * extents.multiply(PxVec3(flip(v^d, 0), flip(v^d, 1), flip(v^d, 2)));
+			lines.pushBack(Nv::Blast::DebugLine(
+				reinterpret_cast<NvcVec3&>(p0), 
+				reinterpret_cast<NvcVec3&>(p1), 
+				PxVec4ToU32Color(LEAF_COLOR * (1.f - (currentDepth + 1) * 0.1f)))
+			);
+		}
+	}
+}
+
+} // namespace Blast
+} // namespace Nv
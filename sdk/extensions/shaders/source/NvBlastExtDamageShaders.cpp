@@ -38,6 +38,14 @@
 #include <cmath> // for abs() on linux
 #include <new>
 
+#if NV_SSE2
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
 
 using namespace Nv::Blast;
 using namespace Nv::Blast::VecMath;
@@ -143,11 +151,288 @@ PxBounds3 capsuleBounds(const void* damageDesc)
 }
 
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													SIMD Wrappers
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// AVX2 is used when this module is compiled with it enabled, SSE2 otherwise on x86/x64, and plain floats elsewhere.
+#if NV_SSE2 && defined(__AVX2__)
+
+typedef __m256 SimdFloat;
+typedef __m256 SimdMask;
+const uint32_t SIMD_WIDTH = 8;
+
+NV_FORCE_INLINE SimdFloat	simdLoad(const float* p)						{ return _mm256_loadu_ps(p); }
+NV_FORCE_INLINE void		simdStore(float* p, SimdFloat a)				{ _mm256_storeu_ps(p, a); }
+NV_FORCE_INLINE SimdFloat	simdSplat(float f)								{ return _mm256_set1_ps(f); }
+NV_FORCE_INLINE SimdFloat	simdAdd(SimdFloat a, SimdFloat b)				{ return _mm256_add_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdSub(SimdFloat a, SimdFloat b)				{ return _mm256_sub_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdMul(SimdFloat a, SimdFloat b)				{ return _mm256_mul_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdDiv(SimdFloat a, SimdFloat b)				{ return _mm256_div_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdSqrt(SimdFloat a)							{ return _mm256_sqrt_ps(a); }
+NV_FORCE_INLINE SimdMask	simdGreater(SimdFloat a, SimdFloat b)			{ return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+NV_FORCE_INLINE SimdMask	simdLess(SimdFloat a, SimdFloat b)				{ return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+NV_FORCE_INLINE SimdMask	simdLessEqual(SimdFloat a, SimdFloat b)			{ return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+NV_FORCE_INLINE SimdMask	simdOr(SimdMask a, SimdMask b)					{ return _mm256_or_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdSelect(SimdMask m, SimdFloat a, SimdFloat b)	{ return _mm256_blendv_ps(b, a, m); }
+NV_FORCE_INLINE uint32_t	simdMoveMask(SimdMask m)						{ return (uint32_t)_mm256_movemask_ps(m); }
+
+#elif NV_SSE2
+
+typedef __m128 SimdFloat;
+typedef __m128 SimdMask;
+const uint32_t SIMD_WIDTH = 4;
+
+NV_FORCE_INLINE SimdFloat	simdLoad(const float* p)						{ return _mm_loadu_ps(p); }
+NV_FORCE_INLINE void		simdStore(float* p, SimdFloat a)				{ _mm_storeu_ps(p, a); }
+NV_FORCE_INLINE SimdFloat	simdSplat(float f)								{ return _mm_set1_ps(f); }
+NV_FORCE_INLINE SimdFloat	simdAdd(SimdFloat a, SimdFloat b)				{ return _mm_add_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdSub(SimdFloat a, SimdFloat b)				{ return _mm_sub_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdMul(SimdFloat a, SimdFloat b)				{ return _mm_mul_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdDiv(SimdFloat a, SimdFloat b)				{ return _mm_div_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdSqrt(SimdFloat a)							{ return _mm_sqrt_ps(a); }
+NV_FORCE_INLINE SimdMask	simdGreater(SimdFloat a, SimdFloat b)			{ return _mm_cmpgt_ps(a, b); }
+NV_FORCE_INLINE SimdMask	simdLess(SimdFloat a, SimdFloat b)				{ return _mm_cmplt_ps(a, b); }
+NV_FORCE_INLINE SimdMask	simdLessEqual(SimdFloat a, SimdFloat b)			{ return _mm_cmple_ps(a, b); }
+NV_FORCE_INLINE SimdMask	simdOr(SimdMask a, SimdMask b)					{ return _mm_or_ps(a, b); }
+NV_FORCE_INLINE SimdFloat	simdSelect(SimdMask m, SimdFloat a, SimdFloat b)	{ return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+NV_FORCE_INLINE uint32_t	simdMoveMask(SimdMask m)						{ return (uint32_t)_mm_movemask_ps(m); }
+
+#else
+
+typedef float SimdFloat;
+typedef bool SimdMask;
+const uint32_t SIMD_WIDTH = 1;
+
+NV_FORCE_INLINE SimdFloat	simdLoad(const float* p)						{ return *p; }
+NV_FORCE_INLINE void		simdStore(float* p, SimdFloat a)				{ *p = a; }
+NV_FORCE_INLINE SimdFloat	simdSplat(float f)								{ return f; }
+NV_FORCE_INLINE SimdFloat	simdAdd(SimdFloat a, SimdFloat b)				{ return a + b; }
+NV_FORCE_INLINE SimdFloat	simdSub(SimdFloat a, SimdFloat b)				{ return a - b; }
+NV_FORCE_INLINE SimdFloat	simdMul(SimdFloat a, SimdFloat b)				{ return a * b; }
+NV_FORCE_INLINE SimdFloat	simdDiv(SimdFloat a, SimdFloat b)				{ return a / b; }
+NV_FORCE_INLINE SimdFloat	simdSqrt(SimdFloat a)							{ return sqrtf(a); }
+NV_FORCE_INLINE SimdMask	simdGreater(SimdFloat a, SimdFloat b)			{ return a > b; }
+NV_FORCE_INLINE SimdMask	simdLess(SimdFloat a, SimdFloat b)				{ return a < b; }
+NV_FORCE_INLINE SimdMask	simdLessEqual(SimdFloat a, SimdFloat b)			{ return a <= b; }
+NV_FORCE_INLINE SimdMask	simdOr(SimdMask a, SimdMask b)					{ return a || b; }
+NV_FORCE_INLINE SimdFloat	simdSelect(SimdMask m, SimdFloat a, SimdFloat b)	{ return m ? a : b; }
+NV_FORCE_INLINE uint32_t	simdMoveMask(SimdMask m)						{ return m ? 1u : 0u; }
+
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//												Batch Damage Functions
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+Bond centroids staged in SoA layout for SIMD_WIDTH-wide evaluation, along with the graph nodes of each bond.
+*/
+struct BondBatch
+{
+	static const uint32_t CAPACITY = 64;
+
+	float		x[CAPACITY];
+	float		y[CAPACITY];
+	float		z[CAPACITY];
+	uint32_t	node0[CAPACITY];
+	uint32_t	node1[CAPACITY];
+	uint32_t	count;
+};
+
+NV_COMPILE_TIME_ASSERT(BondBatch::CAPACITY % SIMD_WIDTH == 0);
+
+typedef SimdFloat(*SimdProfileFunction)(SimdFloat, SimdFloat, SimdFloat, SimdFloat);
+
+// Evaluates all bonds in the batch and writes the damaged ones to 'out', returns the number written.
+typedef uint32_t(*BatchDamageFunction)(NvBlastBondFractureData* out, const BondBatch& batch, const void* damageDescBuffer);
+
+// Same results as falloffProfile, per lane.
+NV_FORCE_INLINE SimdFloat falloffProfileSimd(SimdFloat min, SimdFloat max, SimdFloat x, SimdFloat f)
+{
+	const SimdFloat y = simdSub(simdSplat(1.0f), simdDiv(simdSub(x, min), simdSub(max, min)));
+	return simdSelect(simdGreater(x, max), simdSplat(0.0f), simdSelect(simdLess(x, min), f, simdMul(y, f)));
+}
+
+// Same results as cutterProfile, per lane.
+NV_FORCE_INLINE SimdFloat cutterProfileSimd(SimdFloat min, SimdFloat max, SimdFloat x, SimdFloat f)
+{
+	return simdSelect(simdOr(simdGreater(x, max), simdLess(x, min)), simdSplat(0.0f), f);
+}
+
+// Writes the lanes of 'damage' greater than zero for the bonds starting at batch index 'first'.
+NV_FORCE_INLINE uint32_t writeBondFractures(NvBlastBondFractureData* out, const BondBatch& batch, uint32_t first, SimdFloat damage)
+{
+	uint32_t hitMask = simdMoveMask(simdGreater(damage, simdSplat(0.0f)));
+	if (batch.count - first < SIMD_WIDTH)
+	{
+		hitMask &= (1u << (batch.count - first)) - 1;	// Ignore padding lanes
+	}
+
+	float damages[SIMD_WIDTH];
+	simdStore(damages, damage);
+
+	uint32_t outCount = 0;
+	for (uint32_t lane = 0; hitMask != 0; ++lane, hitMask >>= 1)
+	{
+		if (hitMask & 1)
+		{
+			NvBlastBondFractureData& outCommand = out[outCount++];
+			outCommand.nodeIndex0 = batch.node0[first + lane];
+			outCommand.nodeIndex1 = batch.node1[first + lane];
+			outCommand.health = damages[lane];
+		}
+	}
+
+	return outCount;
+}
+
+template <SimdProfileFunction profileFn, typename DescT = NvBlastExtRadialDamageDesc>
+uint32_t pointDistanceDamageBatch(NvBlastBondFractureData* out, const BondBatch& batch, const void* damageDescBuffer)
+{
+	const DescT& desc = *static_cast<const DescT*>(damageDescBuffer);
+
+	const SimdFloat px = simdSplat(desc.position[0]);
+	const SimdFloat py = simdSplat(desc.position[1]);
+	const SimdFloat pz = simdSplat(desc.position[2]);
+	const SimdFloat minRadius = simdSplat(desc.minRadius);
+	const SimdFloat maxRadius = simdSplat(desc.maxRadius);
+	const SimdFloat damage = simdSplat(desc.damage);
+
+	uint32_t outCount = 0;
+	for (uint32_t i = 0; i < batch.count; i += SIMD_WIDTH)
+	{
+		const SimdFloat dx = simdSub(px, simdLoad(batch.x + i));
+		const SimdFloat dy = simdSub(py, simdLoad(batch.y + i));
+		const SimdFloat dz = simdSub(pz, simdLoad(batch.z + i));
+		const SimdFloat distance = simdSqrt(simdAdd(simdAdd(simdMul(dx, dx), simdMul(dy, dy)), simdMul(dz, dz)));
+		outCount += writeBondFractures(out + outCount, batch, i, profileFn(minRadius, maxRadius, distance, damage));
+	}
+
+	return outCount;
+}
+
+template <SimdProfileFunction profileFn>
+uint32_t capsuleDistanceDamageBatch(NvBlastBondFractureData* out, const BondBatch& batch, const void* damageDescBuffer)
+{
+	const NvBlastExtCapsuleRadialDamageDesc& desc = *static_cast<const NvBlastExtCapsuleRadialDamageDesc*>(damageDescBuffer);
+
+	// See distanceToSegment, the segment terms are shared by all lanes
+	float v[3];
+	sub(desc.position1, desc.position0, v);
+	const SimdFloat vx = simdSplat(v[0]);
+	const SimdFloat vy = simdSplat(v[1]);
+	const SimdFloat vz = simdSplat(v[2]);
+	const SimdFloat c2 = simdSplat(dot(v, v));
+	const SimdFloat ax = simdSplat(desc.position0[0]);
+	const SimdFloat ay = simdSplat(desc.position0[1]);
+	const SimdFloat az = simdSplat(desc.position0[2]);
+	const SimdFloat bx = simdSplat(desc.position1[0]);
+	const SimdFloat by = simdSplat(desc.position1[1]);
+	const SimdFloat bz = simdSplat(desc.position1[2]);
+	const SimdFloat minRadius = simdSplat(desc.minRadius);
+	const SimdFloat maxRadius = simdSplat(desc.maxRadius);
+	const SimdFloat damage = simdSplat(desc.damage);
+	const SimdFloat zero = simdSplat(0.0f);
+
+	uint32_t outCount = 0;
+	for (uint32_t i = 0; i < batch.count; i += SIMD_WIDTH)
+	{
+		const SimdFloat x = simdLoad(batch.x + i);
+		const SimdFloat y = simdLoad(batch.y + i);
+		const SimdFloat z = simdLoad(batch.z + i);
+
+		const SimdFloat wx = simdSub(x, ax);
+		const SimdFloat wy = simdSub(y, ay);
+		const SimdFloat wz = simdSub(z, az);
+		const SimdFloat c1 = simdAdd(simdAdd(simdMul(vx, wx), simdMul(vy, wy)), simdMul(vz, wz));
+
+		// Closest to position0
+		const SimdFloat distance0 = simdSqrt(simdAdd(simdAdd(simdMul(wx, wx), simdMul(wy, wy)), simdMul(wz, wz)));
+
+		// Closest to position1
+		const SimdFloat ux = simdSub(x, bx);
+		const SimdFloat uy = simdSub(y, by);
+		const SimdFloat uz = simdSub(z, bz);
+		const SimdFloat distance1 = simdSqrt(simdAdd(simdAdd(simdMul(ux, ux), simdMul(uy, uy)), simdMul(uz, uz)));
+
+		// Closest to the segment interior
+		const SimdFloat t = simdDiv(c1, c2);
+		const SimdFloat ex = simdSub(simdMul(vx, t), wx);
+		const SimdFloat ey = simdSub(simdMul(vy, t), wy);
+		const SimdFloat ez = simdSub(simdMul(vz, t), wz);
+		const SimdFloat distanceT = simdSqrt(simdAdd(simdAdd(simdMul(ex, ex), simdMul(ey, ey)), simdMul(ez, ez)));
+
+		const SimdFloat distance = simdSelect(simdLessEqual(c1, zero), distance0, simdSelect(simdLess(c2, c1), distance1, distanceT));
+		outCount += writeBondFractures(out + outCount, batch, i, profileFn(minRadius, maxRadius, distance, damage));
+	}
+
+	return outCount;
+}
+
+/**
+Collects bonds into a BondBatch and evaluates them with damageFn each time it is full.  flush() must be called after the last bond.
+*/
+template <BatchDamageFunction damageFn>
+class BondBatchEvaluator
+{
+public:
+	BondBatchEvaluator(NvBlastFractureBuffers* commandBuffers, uint32_t& outCount, const NvBlastBond* assetBonds, const void* damageDescBuffer) :
+		m_commandBuffers(commandBuffers),
+		m_outCount(outCount),
+		m_assetBonds(assetBonds),
+		m_damageDescBuffer(damageDescBuffer)
+	{
+		m_batch.count = 0;
+	}
+
+	void addBond(uint32_t bondIndex, uint32_t node0, uint32_t node1)
+	{
+		const float* centroid = m_assetBonds[bondIndex].centroid;
+		const uint32_t i = m_batch.count;
+		m_batch.x[i] = centroid[0];
+		m_batch.y[i] = centroid[1];
+		m_batch.z[i] = centroid[2];
+		m_batch.node0[i] = node0;
+		m_batch.node1[i] = node1;
+		if (++m_batch.count == BondBatch::CAPACITY)
+		{
+			flush();
+		}
+	}
+
+	void flush()
+	{
+		if (m_batch.count == 0)
+		{
+			return;
+		}
+
+		// Pad to a whole number of lanes
+		for (uint32_t i = m_batch.count; (i % SIMD_WIDTH) != 0; ++i)
+		{
+			m_batch.x[i] = m_batch.y[i] = m_batch.z[i] = 0.0f;
+		}
+
+		m_outCount += damageFn(m_commandBuffers->bondFractures + m_outCount, m_batch, m_damageDescBuffer);
+		m_batch.count = 0;
+	}
+
+private:
+	NvBlastFractureBuffers* m_commandBuffers;
+	uint32_t& m_outCount;
+	const NvBlastBond* m_assetBonds;
+	const void* m_damageDescBuffer;
+	BondBatch m_batch;
+};
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //												Radial Graph Shader Template
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template <DamageFunction damageFn, BoundFunction boundsFn>
+template <BatchDamageFunction damageFn, BoundFunction boundsFn>
 void RadialProfileGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastGraphShaderActor* actor, const void* params)
 {
 	const uint32_t* graphNodeIndexLinks = actor->graphNodeIndexLinks;
@@ -161,32 +446,22 @@ void RadialProfileGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBl
 
 	uint32_t outCount = 0;
 
-	auto processBondFn = [&](uint32_t bondIndex, uint32_t node0, uint32_t node1)
+	const ExtDamageAcceleratorInternal* damageAccelerator = programParams->accelerator ? static_cast<const ExtDamageAcceleratorInternal*>(programParams->accelerator) : nullptr;
+	physx::PxBounds3 bounds;
+	if (damageAccelerator)
 	{
-		// skip bonds that are already broken or were visited already
-		// TODO: investigate why testing against health > -1.0f seems slower
-		// could reuse the island edge bitmap instead
-		if ((familyBondHealths[bondIndex] > 0.0f))
+		// The query reports bonds of the whole asset, only worth it if it is expected to visit fewer bonds than walking this actor's graph.
+		// Actor bond count is approximated from its share of graph nodes.
+		bounds = boundsFn(programParams->damageDesc);
+		const uint64_t actorBondCount = (uint64_t)actor->graphNodeCount * damageAccelerator->getBondCount() / PxMax(actor->assetNodeCount, 1u);
+		if (damageAccelerator->estimateBondCentroidsInBounds(bounds) >= actorBondCount)
 		{
-			const NvBlastBond& bond = assetBonds[bondIndex];
-
-			const float totalBondDamage = damageFn(bond.centroid, programParams->damageDesc);
-			if (totalBondDamage > 0.0f)
-			{
-				NvBlastBondFractureData& outCommand = commandBuffers->bondFractures[outCount++];
-				outCommand.nodeIndex0 = node0;
-				outCommand.nodeIndex1 = node1;
-				outCommand.health = totalBondDamage;
-			}
+			damageAccelerator = nullptr;
 		}
-	};
+	}
 
-	const ExtDamageAcceleratorInternal* damageAccelerator = programParams->accelerator ? static_cast<const ExtDamageAcceleratorInternal*>(programParams->accelerator) : nullptr;
-	const uint32_t ACTOR_MINIMUM_NODE_COUNT_TO_ACCELERATE = actor->assetNodeCount / 3;
-	if (damageAccelerator && actor->graphNodeCount > ACTOR_MINIMUM_NODE_COUNT_TO_ACCELERATE)
+	if (damageAccelerator)
 	{
-		physx::PxBounds3 bounds = boundsFn(programParams->damageDesc);
-
 		const uint32_t CALLBACK_BUFFER_SIZE = 1000;
 
 		class AcceleratorCallback : public ExtDamageAcceleratorInternal::ResultCallback
@@ -195,9 +470,7 @@ void RadialProfileGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBl
 			AcceleratorCallback(NvBlastFractureBuffers* commandBuffers, uint32_t& outCount, const NvBlastGraphShaderActor* actor, const NvBlastExtProgramParams* programParams) :
 				ExtDamageAcceleratorInternal::ResultCallback(m_buffer, CALLBACK_BUFFER_SIZE),
 				m_actor(actor),
-				m_commandBuffers(commandBuffers),
-				m_outCount(outCount),
-				m_programParams(programParams)
+				m_evaluator(commandBuffers, outCount, actor->assetBonds, programParams->damageDesc)
 			{
 			}
 
@@ -210,26 +483,20 @@ void RadialProfileGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBl
 					{
 						if ((m_actor->familyBondHealths[bondData.bond] > 0.0f))
 						{
-							const NvBlastBond& bond = m_actor->assetBonds[bondData.bond];
-
-							const float totalBondDamage = damageFn(bond.centroid, m_programParams->damageDesc);
-							if (totalBondDamage > 0.0f)
-							{
-								NvBlastBondFractureData& outCommand = m_commandBuffers->bondFractures[m_outCount++];
-								outCommand.nodeIndex0 = bondData.node0;
-								outCommand.nodeIndex1 = bondData.node1;
-								outCommand.health = totalBondDamage;
-							}
+							m_evaluator.addBond(bondData.bond, bondData.node0, bondData.node1);
 						}
 					}
 				}
 			}
 
+			void flush()
+			{
+				m_evaluator.flush();
+			}
+
 		private:
 			const NvBlastGraphShaderActor* m_actor;
-			NvBlastFractureBuffers* m_commandBuffers;
-			uint32_t& m_outCount;
-			const NvBlastExtProgramParams* m_programParams;
+			BondBatchEvaluator<damageFn> m_evaluator;
 
 			ExtDamageAcceleratorInternal::QueryBondData m_buffer[CALLBACK_BUFFER_SIZE];
 		};
@@ -237,9 +504,12 @@ void RadialProfileGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBl
 		AcceleratorCallback cb(commandBuffers, outCount, actor, programParams);
 
 		damageAccelerator->findBondCentroidsInBounds(bounds, cb);
+		cb.flush();
 	}
 	else
 	{
+		BondBatchEvaluator<damageFn> evaluator(commandBuffers, outCount, assetBonds, programParams->damageDesc);
+
 		uint32_t currentNodeIndex = firstGraphNodeIndex;
 		while (!Nv::Blast::isInvalidIndex(currentNodeIndex))
 		{
@@ -249,11 +519,18 @@ void RadialProfileGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBl
 				if (currentNodeIndex < adjacentNodeIndex)
 				{
 					uint32_t bondIndex = adjacentBondIndices[adj];
-					processBondFn(bondIndex, currentNodeIndex, adjacentNodeIndex);
+					// skip bonds that are already broken or were visited already
+					// TODO: investigate why testing against health > -1.0f seems slower
+					// could reuse the island edge bitmap instead
+					if ((familyBondHealths[bondIndex] > 0.0f))
+					{
+						evaluator.addBond(bondIndex, currentNodeIndex, adjacentNodeIndex);
+					}
 				}
 			}
 			currentNodeIndex = graphNodeIndexLinks[currentNodeIndex];
 		}
+		evaluator.flush();
 	}
 
 	commandBuffers->bondFractureCount = outCount;
@@ -294,7 +571,7 @@ void RadialProfileSubgraphShader(NvBlastFractureBuffers* commandBuffers, const N
 
 void NvBlastExtFalloffGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastGraphShaderActor* actor, const void* params)
 {
-	RadialProfileGraphShader<pointDistanceDamage<falloffProfile>, sphereBounds>(commandBuffers, actor, params);
+	RadialProfileGraphShader<pointDistanceDamageBatch<falloffProfileSimd>, sphereBounds>(commandBuffers, actor, params);
 }
 
 void NvBlastExtFalloffSubgraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastSubgraphShaderActor* actor, const void* params)
@@ -304,7 +581,7 @@ void NvBlastExtFalloffSubgraphShader(NvBlastFractureBuffers* commandBuffers, con
 
 void NvBlastExtCutterGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastGraphShaderActor* actor, const void* params)
 {
-	RadialProfileGraphShader<pointDistanceDamage<cutterProfile>, sphereBounds>(commandBuffers, actor, params);
+	RadialProfileGraphShader<pointDistanceDamageBatch<cutterProfileSimd>, sphereBounds>(commandBuffers, actor, params);
 }
 
 void NvBlastExtCutterSubgraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastSubgraphShaderActor* actor, const void* params)
@@ -314,7 +591,7 @@ void NvBlastExtCutterSubgraphShader(NvBlastFractureBuffers* commandBuffers, cons
 
 void NvBlastExtCapsuleFalloffGraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastGraphShaderActor* actor, const void* params)
 {
-	RadialProfileGraphShader<capsuleDistanceDamage<falloffProfile>, capsuleBounds>(commandBuffers, actor, params);
+	RadialProfileGraphShader<capsuleDistanceDamageBatch<falloffProfileSimd>, capsuleBounds>(commandBuffers, actor, params);
 }
 
 void NvBlastExtCapsuleFalloffSubgraphShader(NvBlastFractureBuffers* commandBuffers, const NvBlastSubgraphShaderActor* actor, const void* params)
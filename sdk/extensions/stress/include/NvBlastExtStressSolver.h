@@ -53,6 +53,12 @@ stressLinearFactor, stressAngularFactor, hardness = multiplier parameters set by
 Support graph reduction:
 graphReductionLevel is the number of node merge passes.  The resulting graph will be
 roughly 2^graphReductionLevel times smaller than the original.
+
+Graph coloring:
+With graphColoring set, solver bonds are grouped in colors such that bonds of the same color share no nodes, and
+every iteration processes the bonds color by color.  Bonds of one color are then independent and are split across
+the task runner set with ExtStressSolver::setTaskRunner(), if any.  The result only depends on the coloring,
+not on the number of tasks or threads.
 */
 struct ExtStressSolverSettings
 {
@@ -61,13 +67,15 @@ struct ExtStressSolverSettings
 	float		stressAngularFactor;		//!<	angular stress on bond multiplier
 	uint32_t	bondIterationsPerFrame;		//!<	number of bond iterations to perform per frame, @see getIterationsPerFrame() below
 	uint32_t	graphReductionLevel;		//!<	graph reduction level
+	bool		graphColoring;				//!<	iterate bonds in graph color order, required for parallel iteration
 
 	ExtStressSolverSettings() :
 		hardness(1000.0f),
 		stressLinearFactor(0.25f),
 		stressAngularFactor(0.75f),
 		bondIterationsPerFrame(18000),
-		graphReductionLevel(3)
+		graphReductionLevel(3),
+		graphColoring(false)
 	{}
 };
 
@@ -87,6 +95,51 @@ struct ExtForceMode
 };
 
 
+/**
+Task interface used by the stress solver to run work on the user's threads.
+
+@see ExtStressSolver.setTaskRunner()
+*/
+class ExtStressSolverTaskRunner
+{
+public:
+	/**
+	Work split in tasks, implemented by the stress solver.
+	*/
+	class Tasks
+	{
+	public:
+		/**
+		Execute one task.  Must be called exactly once for every taskIndex in [0, taskCount) of the run() call.
+
+		\param[in]	taskIndex		The index of the task to execute.
+		*/
+		virtual void	execute(uint32_t taskIndex) = 0;
+
+	protected:
+		virtual			~Tasks() {}
+	};
+
+	/**
+	The maximum number of tasks to be passed into a single run() call, typically the number of worker threads.
+
+	\return the maximum task count.
+	*/
+	virtual uint32_t	getMaxTaskCount() const = 0;
+
+	/**
+	Execute tasks, possibly concurrently, and return after all of them completed.
+
+	\param[in]	tasks			The tasks to execute.
+	\param[in]	taskCount		The number of tasks, at most getMaxTaskCount().
+	*/
+	virtual void		run(Tasks& tasks, uint32_t taskCount) = 0;
+
+protected:
+	virtual				~ExtStressSolverTaskRunner() {}
+};
+
+
 /**
 Stress Solver.
 
@@ -163,6 +216,16 @@ public:
 	*/
 	virtual const ExtStressSolverSettings&	getSettings() const = 0;
 
+	/**
+	Set the task runner used to iterate bonds in parallel when ExtStressSolverSettings::graphColoring is set.
+
+	update() calls into the task runner and returns after all tasks completed.  Without a task runner (the default) 
+	colored iteration runs on the calling thread, with the same result.
+
+	\param[in]	taskRunner		The task runner to use, or nullptr.
+	*/
+	virtual void							setTaskRunner(ExtStressSolverTaskRunner* taskRunner) = 0;
+
 	/**
 	Notify stress solver on newly created actor.
 
@@ -183,6 +246,18 @@ public:
 	*/
 	virtual void							notifyActorDestroyed(const NvBlastActor& actor) = 0;
 
+	/**
+	Notify stress solver on fractures applied to the family's actors.
+
+	Pass the fracture events (or commands) of NvBlastActorApplyFracture, or TkFractureEvents::buffers.  Broken bonds, and the 
+	bonds around fractured support chunks, are removed from the stress graph directly and only the aggregated solver nodes they 
+	touch are rebuilt.  Once this function was called, actor create/destroy notifications no longer trigger a sweep over the 
+	whole support graph to find broken bonds, so every fracture applied after that must be passed to it.
+
+	\param[in]	fractures			The bond and chunk fracture data applied.
+	*/
+	virtual void							notifyFractures(const NvBlastFractureBuffers& fractures) = 0;
+
 	/**
 	Apply external impulse on particular actor of family. This function will find nearest actor's graph node to apply impulse on.
 
@@ -232,6 +307,42 @@ public:
 	*/
 	virtual void							update() = 0;
 
+	/**
+	Latch the stress solver state for an asynchronous solve, the alternative to update().
+
+	Moves the forces applied so far and a snapshot of the family's bond healths to the latched solve, and applies actor and 
+	bond fracture notifications received since the last call.  Then solveLatched() can run on any thread while the family 
+	keeps being simulated and damaged: forces and notifications received meanwhile go to the next latch() call.  Call 
+	acquireFractureCommands() after solveLatched() returned to get the fracture commands of the latched frame.
+
+	Between latch() and acquireFractureCommands() only add forces and notify actors and bond fractures, do not call update(),
+	generateFractureCommands(), setNodeInfo(), setAllNodesInfoFromLL(), reset() or fillDebugRender().
+	*/
+	virtual void							latch() = 0;
+
+	/**
+	Solve stress on the state latched by latch() and generate fracture commands for the overstressed bonds.  Can be called
+	on any thread, but once per latch() call.
+	*/
+	virtual void							solveLatched() = 0;
+
+	/**
+	Get the fracture commands generated by the last solveLatched() call.  Call it on the thread calling latch().  It may be 
+	polled while solveLatched() runs: it returns false until solveLatched() has finished, and once it returned true the 
+	latched solve's results, including getStressErrorLinear() and getStressErrorAngular(), are visible to the calling thread.
+
+	Fracture commands use the bond healths latched, so they can be applied to the family with NvBlastActorApplyFracture 
+	(or TkFamily::applyFracture) as usual even if bonds were damaged meanwhile.
+
+	IMPORTANT: NvBlastFractureBuffers::bondFractures will point to internal stress solver memory which will be valid till the
+	next call of acquireFractureCommands() or stress solver release() call.
+
+	\param[out]	commands		Fracture commands of the latched frame.
+
+	\return true if new commands were acquired, false if there was no finished latched solve since the last call.
+	*/
+	virtual bool							acquireFractureCommands(NvBlastFractureBuffers& commands) = 0;
+
 	/**
 	Get overstressed/broken bonds count. 
 	
@@ -0,0 +1,148 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#ifndef NVBLASTEXTSTRESSSOLVERMANAGER_H
+#define NVBLASTEXTSTRESSSOLVERMANAGER_H
+
+#include "NvBlastExtStressSolver.h"
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+
+/**
+Fracture commands generated for one stress solver by ExtStressSolverManager::update().
+*/
+struct ExtStressSolverManagerResult
+{
+	ExtStressSolver*		solver;					//!< The solver (and so family) the commands are generated for
+	NvBlastFractureBuffers	commands;				//!< Bond fracture commands, bondFractures points into ExtStressSolverManager::getBondFractures()
+	uint32_t				overstressedBondCount;	//!< The solver's overstressed bond count after update
+};
+
+
+/**
+Stress Solver Manager.
+
+Updates many families' stress solvers in one call, spread over the task runner's threads.  Solvers are dealt to tasks
+by estimated cost (bond count times iterations), a task which runs out of solvers steals the remaining ones of other tasks.
+
+Fracture commands of all overstressed solvers are gathered in one contiguous bond fracture buffer, with one
+ExtStressSolverManagerResult per solver pointing into it.
+
+Solvers are not owned by the manager, remove them before releasing them.  The solvers' own task runners are called 
+from the manager's tasks during update(), leave them unset unless they can be run from worker threads.
+*/
+class NV_DLL_EXPORT ExtStressSolverManager
+{
+public:
+	//////// creation ////////
+
+	/**
+	Create a new ExtStressSolverManager.
+
+	\return the new ExtStressSolverManager if successful, NULL otherwise.
+	*/
+	static ExtStressSolverManager*					create();
+
+
+	//////// interface ////////
+
+	/**
+	Release this manager.  Added solvers are not released.
+	*/
+	virtual void									release() = 0;
+
+	/**
+	Add a stress solver to be updated by this manager.
+
+	\param[in]	solver			The solver to add.
+	*/
+	virtual void									addSolver(ExtStressSolver& solver) = 0;
+
+	/**
+	Remove a stress solver from this manager.
+
+	\param[in]	solver			The solver to remove.
+	*/
+	virtual void									removeSolver(ExtStressSolver& solver) = 0;
+
+	/**
+	\return the number of solvers added to this manager.
+	*/
+	virtual uint32_t								getSolverCount() const = 0;
+
+	/**
+	Set the task runner used to update solvers in parallel.  Without a task runner (the default) solvers are updated
+	on the calling thread.
+
+	\param[in]	taskRunner		The task runner to use, or nullptr.
+	*/
+	virtual void									setTaskRunner(ExtStressSolverTaskRunner* taskRunner) = 0;
+
+	/**
+	Call ExtStressSolver::update() on every solver and, if generateFractureCommands is set, gather the fracture commands 
+	of every overstressed solver.  Forces are to be applied to the solvers before this call, as with a single solver.
+
+	\param[in]	generateFractureCommands	Whether to generate fracture commands for overstressed solvers.
+	*/
+	virtual void									update(bool generateFractureCommands = true) = 0;
+
+	/**
+	Get the per solver results of the last update(), only solvers with fracture commands are listed.
+
+	IMPORTANT: the results and the bond fractures they point to are valid till the next update() or release() call.
+
+	\param[out]	resultCount		The number of results.
+
+	\return the results array.
+	*/
+	virtual const ExtStressSolverManagerResult*		getResults(uint32_t& resultCount) const = 0;
+
+	/**
+	Get the bond fractures of all results of the last update(), stored contiguously in results order.
+
+	\param[out]	bondFractureCount	The total number of bond fractures.
+
+	\return the bond fractures array.
+	*/
+	virtual const NvBlastBondFractureData*			getBondFractures(uint32_t& bondFractureCount) const = 0;
+
+	/**
+	\return the total overstressed bond count of all solvers after the last update().
+	*/
+	virtual uint32_t								getOverstressedBondCount() const = 0;
+};
+
+} // namespace Blast
+} // namespace Nv
+
+
+#endif // ifndef NVBLASTEXTSTRESSSOLVERMANAGER_H
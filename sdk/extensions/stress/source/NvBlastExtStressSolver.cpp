@@ -34,11 +34,13 @@
 #include "NvBlastHashSet.h"
 #include "NvBlastAssert.h"
 #include "NvBlastIndexFns.h"
+#include "NvBlastExtStressSolverKernels.h"
 
 #include <PsVecMath.h>
 #include "PsFPU.h"
 
 #include <algorithm>
+#include <atomic>
 
 #define USE_SCALAR_IMPL 0
 #define WARM_START 1
@@ -86,8 +88,13 @@ public:
 	}
 	PX_ALIGN_SUFFIX(16);
 
-	SequentialImpulseSolver(uint32_t nodeCount, uint32_t maxBondCount)
+	SequentialImpulseSolver(uint32_t nodeCount, uint32_t maxBondCount) : m_coloringDirty(true)
 	{
+#if USE_SCALAR_IMPL
+		m_bondKernel = getStressBondKernelScalar();
+#else
+		m_bondKernel = getStressBondKernel();
+#endif
 		m_nodesData.resize(nodeCount);
 		m_bondsData.reserve(maxBondCount);
 	}
@@ -112,6 +119,19 @@ public:
 		return m_nodesData.size();;
 	}
 
+	uint32_t addNode()
+	{
+		const NodeData data = {
+			PxVec3(PxZero),
+			0.0f,
+			PxVec3(PxZero),
+			0.0f
+		};
+		m_nodesData.pushBack(data);
+		m_coloringDirty = true;
+		return m_nodesData.size() - 1;
+	}
+
 	void setNodeMassInfo(uint32_t node, float invMass, float invI)
 	{
 		m_nodesData[node].invMass = invMass;
@@ -144,32 +164,51 @@ public:
 			1.0f / offset.magnitudeSquared() 
 		};
 		m_bondsData.pushBack(data);
+		m_coloringDirty = true;
 		return m_bondsData.size() - 1;
 	}
 
 	void replaceWithLast(uint32_t bondIndex)
 	{
 		m_bondsData.replaceWithLast(bondIndex);
+		m_coloringDirty = true;
 	}
 
 	void reset(uint32_t nodeCount)
 	{
 		m_bondsData.clear();
 		m_nodesData.resize(nodeCount);
+		m_coloringDirty = true;
 	}
 
 	void clearBonds()
 	{
 		m_bondsData.clear();
+		m_coloringDirty = true;
 	}
 
-	void solve(uint32_t iterationCount, bool warmStart = true)
+	void solve(uint32_t iterationCount, bool warmStart = true, bool colored = false, ExtStressSolverTaskRunner* taskRunner = nullptr)
 	{
 		solveInit(warmStart);
 
-		for (uint32_t i = 0; i < iterationCount; ++i)
+		if (colored)
+		{
+			updateColoring();
+			loadColoredData();
+
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				iterateColored(taskRunner);
+			}
+
+			storeColoredData();
+		}
+		else
 		{
-			iterate();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				iterate();
+			}
 		}
 	}
 
@@ -229,85 +268,324 @@ private:
 
 	void iterate()
 	{
-		using namespace physx::shdfnd::aos;
-
 		for (BondData& bond : m_bondsData)
 		{
-			NodeData* node0 = &m_nodesData[bond.node0];
-			NodeData* node1 = &m_nodesData[bond.node1];
+			solveBond(bond);
+		}
+	}
+
+	// Bonds of one color in tasks, every task solves a contiguous run of whole kernel batches so that the result
+	// does not depend on the task count
+	class ColorTasks : public ExtStressSolverTaskRunner::Tasks
+	{
+	public:
+		ColorTasks(const ExtStressBondKernel& kernel, const ExtStressBondsSoA& bonds, const ExtStressNodesSoA& nodes, uint32_t firstBond, uint32_t bondCount, uint32_t taskCount)
+			: m_kernel(kernel), m_bonds(bonds), m_nodes(nodes), m_firstBond(firstBond), m_bondCount(bondCount), m_taskCount(taskCount) {}
+
+		virtual void execute(uint32_t taskIndex) override
+		{
+			const uint64_t batchCount = (m_bondCount + m_kernel.width - 1) / m_kernel.width;
+			const uint32_t begin = std::min<uint32_t>((uint32_t)(batchCount * taskIndex / m_taskCount) * m_kernel.width, m_bondCount);
+			const uint32_t end = std::min<uint32_t>((uint32_t)(batchCount * (taskIndex + 1) / m_taskCount) * m_kernel.width, m_bondCount);
+			m_kernel.solveBonds(m_bonds, m_nodes, m_firstBond + begin, end - begin);
+		}
+
+	private:
+		const ExtStressBondKernel&	m_kernel;
+		const ExtStressBondsSoA&	m_bonds;
+		const ExtStressNodesSoA&	m_nodes;
+		uint32_t					m_firstBond;
+		uint32_t					m_bondCount;
+		uint32_t					m_taskCount;
+	};
+
+	void iterateColored(ExtStressSolverTaskRunner* taskRunner)
+	{
+		const uint32_t maxTaskCount = taskRunner ? taskRunner->getMaxTaskCount() : 1;
+
+		for (uint32_t color = 0; color + 1 < m_colorOffsets.size(); ++color)
+		{
+			const uint32_t firstBond = m_colorOffsets[color];
+			const uint32_t bondCount = m_colorOffsets[color + 1] - firstBond;
+
+			// the last color holds bonds left over when colors ran out, they can share nodes
+			if (color == MAX_COLOR_COUNT)
+			{
+				getStressBondKernelScalar().solveBonds(m_bondsSoA, m_nodesSoA, firstBond, bondCount);
+				continue;
+			}
+
+			const uint32_t taskCount = std::min<uint32_t>(maxTaskCount, bondCount / MIN_BONDS_PER_TASK);
+			if (taskCount > 1)
+			{
+				ColorTasks tasks(m_bondKernel, m_bondsSoA, m_nodesSoA, firstBond, bondCount, taskCount);
+				taskRunner->run(tasks, taskCount);
+			}
+			else
+			{
+				m_bondKernel.solveBonds(m_bondsSoA, m_nodesSoA, firstBond, bondCount);
+			}
+		}
+	}
+
+	/**
+	Copies bond impulses and node velocities and masses into the SoA working set, in color order for bonds.
+	*/
+	void loadColoredData()
+	{
+		const uint32_t nodeCount = m_nodesData.size();
+		if (m_nodesSoAData.size() != nodeCount * NODE_SOA_FLOAT_COUNT)
+		{
+			m_nodesSoAData.resize(nodeCount * NODE_SOA_FLOAT_COUNT);
+			float* data = m_nodesSoAData.begin();
+			m_nodesSoA.velocityLinear.x = data;
+			m_nodesSoA.velocityLinear.y = data + nodeCount;
+			m_nodesSoA.velocityLinear.z = data + nodeCount * 2;
+			m_nodesSoA.velocityAngular.x = data + nodeCount * 3;
+			m_nodesSoA.velocityAngular.y = data + nodeCount * 4;
+			m_nodesSoA.velocityAngular.z = data + nodeCount * 5;
+			m_nodesSoA.invMass = data + nodeCount * 6;
+			m_nodesSoA.invI = data + nodeCount * 7;
+		}
+
+		float* invMass = m_nodesSoAData.begin() + nodeCount * 6;
+		float* invI = m_nodesSoAData.begin() + nodeCount * 7;
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			const NodeData& node = m_nodesData[i];
+			m_nodesSoA.velocityLinear.x[i] = node.velocityLinear.x;
+			m_nodesSoA.velocityLinear.y[i] = node.velocityLinear.y;
+			m_nodesSoA.velocityLinear.z[i] = node.velocityLinear.z;
+			m_nodesSoA.velocityAngular.x[i] = node.velocityAngular.x;
+			m_nodesSoA.velocityAngular.y[i] = node.velocityAngular.y;
+			m_nodesSoA.velocityAngular.z[i] = node.velocityAngular.z;
+			invMass[i] = node.invMass;
+			invI[i] = node.invI;
+		}
+
+		const uint32_t bondCount = m_colorBondIndices.size();
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			const BondData& bond = m_bondsData[m_colorBondIndices[i]];
+			m_bondsSoA.impulseLinear.x[i] = bond.impulseLinear.x;
+			m_bondsSoA.impulseLinear.y[i] = bond.impulseLinear.y;
+			m_bondsSoA.impulseLinear.z[i] = bond.impulseLinear.z;
+			m_bondsSoA.impulseAngular.x[i] = bond.impulseAngular.x;
+			m_bondsSoA.impulseAngular.y[i] = bond.impulseAngular.y;
+			m_bondsSoA.impulseAngular.z[i] = bond.impulseAngular.z;
+		}
+	}
+
+	/**
+	Copies solved bond impulses and node velocities back from the SoA working set.
+	*/
+	void storeColoredData()
+	{
+		const uint32_t nodeCount = m_nodesData.size();
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			NodeData& node = m_nodesData[i];
+			node.velocityLinear = PxVec3(m_nodesSoA.velocityLinear.x[i], m_nodesSoA.velocityLinear.y[i], m_nodesSoA.velocityLinear.z[i]);
+			node.velocityAngular = PxVec3(m_nodesSoA.velocityAngular.x[i], m_nodesSoA.velocityAngular.y[i], m_nodesSoA.velocityAngular.z[i]);
+		}
+
+		const uint32_t bondCount = m_colorBondIndices.size();
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			BondData& bond = m_bondsData[m_colorBondIndices[i]];
+			bond.impulseLinear = PxVec3(m_bondsSoA.impulseLinear.x[i], m_bondsSoA.impulseLinear.y[i], m_bondsSoA.impulseLinear.z[i]);
+			bond.impulseAngular = PxVec3(m_bondsSoA.impulseAngular.x[i], m_bondsSoA.impulseAngular.y[i], m_bondsSoA.impulseAngular.z[i]);
+		}
+	}
+
+	/**
+	Greedy bond coloring: every bond takes the first color none of its nodes' bonds has taken yet.
+	Bond indices are then sorted by color, keeping bond order within a color, and the constant bond data is laid out
+	in that order for the SoA kernels.
+	*/
+	void updateColoring()
+	{
+		if (!m_coloringDirty)
+		{
+			return;
+		}
+
+		const uint32_t bondCount = m_bondsData.size();
+
+		m_nodeColorMasks.resize(m_nodesData.size());
+		memset(m_nodeColorMasks.begin(), 0, m_nodeColorMasks.size() * sizeof(uint64_t));
+		m_bondColors.resize(bondCount);
+		m_colorOffsets.resize(MAX_COLOR_COUNT + 2);
+		memset(m_colorOffsets.begin(), 0, m_colorOffsets.size() * sizeof(uint32_t));
+
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			const BondData& bond = m_bondsData[i];
+			const uint64_t usedColors = m_nodeColorMasks[bond.node0] | m_nodeColorMasks[bond.node1];
+			uint32_t color = 0;
+			while (color < MAX_COLOR_COUNT && (usedColors & (1ull << color)))
+			{
+				color++;
+			}
+			if (color < MAX_COLOR_COUNT)
+			{
+				m_nodeColorMasks[bond.node0] |= 1ull << color;
+				m_nodeColorMasks[bond.node1] |= 1ull << color;
+			}
+			m_bondColors[i] = (uint8_t)color;
+			m_colorOffsets[color + 1]++;
+		}
+
+		for (uint32_t color = 0; color <= MAX_COLOR_COUNT; ++color)
+		{
+			m_colorOffsets[color + 1] += m_colorOffsets[color];
+		}
+
+		m_colorBondIndices.resize(bondCount);
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			m_colorBondIndices[m_colorOffsets[m_bondColors[i]]++] = i;
+		}
+
+		// offsets were shifted by one color while filling
+		for (uint32_t color = MAX_COLOR_COUNT + 1; color > 0; --color)
+		{
+			m_colorOffsets[color] = m_colorOffsets[color - 1];
+		}
+		m_colorOffsets[0] = 0;
+
+		m_bondNodesSoAData.resize(bondCount * 2);
+		m_bondsSoAData.resize(bondCount * BOND_SOA_FLOAT_COUNT);
+		uint32_t* nodes = m_bondNodesSoAData.begin();
+		float* data = m_bondsSoAData.begin();
+		m_bondsSoA.node0 = nodes;
+		m_bondsSoA.node1 = nodes + bondCount;
+		m_bondsSoA.offset.x = data;
+		m_bondsSoA.offset.y = data + bondCount;
+		m_bondsSoA.offset.z = data + bondCount * 2;
+		m_bondsSoA.invOffsetSqrLength = data + bondCount * 3;
+		m_bondsSoA.impulseLinear.x = data + bondCount * 4;
+		m_bondsSoA.impulseLinear.y = data + bondCount * 5;
+		m_bondsSoA.impulseLinear.z = data + bondCount * 6;
+		m_bondsSoA.impulseAngular.x = data + bondCount * 7;
+		m_bondsSoA.impulseAngular.y = data + bondCount * 8;
+		m_bondsSoA.impulseAngular.z = data + bondCount * 9;
+
+		float* invOffsetSqrLength = data + bondCount * 3;
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			const BondData& bond = m_bondsData[m_colorBondIndices[i]];
+			nodes[i] = bond.node0;
+			nodes[bondCount + i] = bond.node1;
+			m_bondsSoA.offset.x[i] = bond.offset0.x;
+			m_bondsSoA.offset.y[i] = bond.offset0.y;
+			m_bondsSoA.offset.z[i] = bond.offset0.z;
+			invOffsetSqrLength[i] = bond.invOffsetSqrLength;
+		}
+
+		m_coloringDirty = false;
+	}
+
+	NV_FORCE_INLINE void solveBond(BondData& bond)
+	{
+		using namespace physx::shdfnd::aos;
+
+		NodeData* node0 = &m_nodesData[bond.node0];
+		NodeData* node1 = &m_nodesData[bond.node1];
 
 #if USE_SCALAR_IMPL
-			const PxVec3 vA = node0->velocityLinear - node0->velocityAngular.cross(bond.offset0);
-			const PxVec3 vB = node1->velocityLinear + node1->velocityAngular.cross(bond.offset0);
+		const PxVec3 vA = node0->velocityLinear - node0->velocityAngular.cross(bond.offset0);
+		const PxVec3 vB = node1->velocityLinear + node1->velocityAngular.cross(bond.offset0);
 
-			const PxVec3 vErrorLinear = vA - vB;
-			const PxVec3 vErrorAngular = node0->velocityAngular - node1->velocityAngular;
+		const PxVec3 vErrorLinear = vA - vB;
+		const PxVec3 vErrorAngular = node0->velocityAngular - node1->velocityAngular;
 
-			const float weightedMass = 1.0f / (node0->invMass + node1->invMass);
-			const float weightedInertia = 1.0f / (node0->invI + node1->invI);
+		const float weightedMass = 1.0f / (node0->invMass + node1->invMass);
+		const float weightedInertia = 1.0f / (node0->invI + node1->invI);
 
-			const PxVec3 outImpulseLinear = -vErrorLinear * weightedMass * 0.5f;
-			const PxVec3 outImpulseAngular = -vErrorAngular * weightedInertia * 0.5f;
+		const PxVec3 outImpulseLinear = -vErrorLinear * weightedMass * 0.5f;
+		const PxVec3 outImpulseAngular = -vErrorAngular * weightedInertia * 0.5f;
 
-			bond.impulseLinear += outImpulseLinear;
-			bond.impulseAngular += outImpulseAngular;
+		bond.impulseLinear += outImpulseLinear;
+		bond.impulseAngular += outImpulseAngular;
 
-			const PxVec3 velocityLinearCorr0 = outImpulseLinear * node0->invMass;
-			const PxVec3 velocityLinearCorr1 = outImpulseLinear * node1->invMass;
+		const PxVec3 velocityLinearCorr0 = outImpulseLinear * node0->invMass;
+		const PxVec3 velocityLinearCorr1 = outImpulseLinear * node1->invMass;
 
-			const PxVec3 velocityAngularCorr0 = outImpulseAngular * node0->invI - bond.offset0.cross(velocityLinearCorr0) * bond.invOffsetSqrLength;
-			const PxVec3 velocityAngularCorr1 = outImpulseAngular * node1->invI + bond.offset0.cross(velocityLinearCorr1) * bond.invOffsetSqrLength;
+		const PxVec3 velocityAngularCorr0 = outImpulseAngular * node0->invI - bond.offset0.cross(velocityLinearCorr0) * bond.invOffsetSqrLength;
+		const PxVec3 velocityAngularCorr1 = outImpulseAngular * node1->invI + bond.offset0.cross(velocityLinearCorr1) * bond.invOffsetSqrLength;
 
-			node0->velocityLinear += velocityLinearCorr0;
-			node1->velocityLinear -= velocityLinearCorr1;
+		node0->velocityLinear += velocityLinearCorr0;
+		node1->velocityLinear -= velocityLinearCorr1;
 
-			node0->velocityAngular += velocityAngularCorr0;
-			node1->velocityAngular -= velocityAngularCorr1;
+		node0->velocityAngular += velocityAngularCorr0;
+		node1->velocityAngular -= velocityAngularCorr1;
 #else
-			const Vec3V velocityLinear0 = V3LoadUnsafeA(node0->velocityLinear);
-			const Vec3V velocityLinear1 = V3LoadUnsafeA(node1->velocityLinear);
-			const Vec3V velocityAngular0 = V3LoadUnsafeA(node0->velocityAngular);
-			const Vec3V velocityAngular1 = V3LoadUnsafeA(node1->velocityAngular);
+		const Vec3V velocityLinear0 = V3LoadUnsafeA(node0->velocityLinear);
+		const Vec3V velocityLinear1 = V3LoadUnsafeA(node1->velocityLinear);
+		const Vec3V velocityAngular0 = V3LoadUnsafeA(node0->velocityAngular);
+		const Vec3V velocityAngular1 = V3LoadUnsafeA(node1->velocityAngular);
 
-			const Vec3V offset = V3LoadUnsafeA(bond.offset0);
-			const Vec3V vA = V3Add(velocityLinear0, V3Neg(V3Cross(velocityAngular0, offset)));
-			const Vec3V vB = V3Add(velocityLinear1, V3Cross(velocityAngular1, offset));
+		const Vec3V offset = V3LoadUnsafeA(bond.offset0);
+		const Vec3V vA = V3Add(velocityLinear0, V3Neg(V3Cross(velocityAngular0, offset)));
+		const Vec3V vB = V3Add(velocityLinear1, V3Cross(velocityAngular1, offset));
 
-			const Vec3V vErrorLinear = V3Sub(vA, vB);
-			const Vec3V vErrorAngular = V3Sub(velocityAngular0, velocityAngular1);
+		const Vec3V vErrorLinear = V3Sub(vA, vB);
+		const Vec3V vErrorAngular = V3Sub(velocityAngular0, velocityAngular1);
 
-			const FloatV invM0 = FLoad(node0->invMass);
-			const FloatV invM1 = FLoad(node1->invMass);
-			const FloatV invI0 = FLoad(node0->invI);
-			const FloatV invI1 = FLoad(node1->invI);
-			const FloatV invOffsetSqrLength = FLoad(bond.invOffsetSqrLength);
+		const FloatV invM0 = FLoad(node0->invMass);
+		const FloatV invM1 = FLoad(node1->invMass);
+		const FloatV invI0 = FLoad(node0->invI);
+		const FloatV invI1 = FLoad(node1->invI);
+		const FloatV invOffsetSqrLength = FLoad(bond.invOffsetSqrLength);
 
-			const FloatV weightedMass = FLoad(-0.5f / (node0->invMass + node1->invMass));
-			const FloatV weightedInertia = FLoad(-0.5f / (node0->invI + node1->invI));
+		const FloatV weightedMass = FLoad(-0.5f / (node0->invMass + node1->invMass));
+		const FloatV weightedInertia = FLoad(-0.5f / (node0->invI + node1->invI));
 
-			const Vec3V outImpulseLinear = V3Scale(vErrorLinear, weightedMass);
-			const Vec3V outImpulseAngular = V3Scale(vErrorAngular, weightedInertia);
+		const Vec3V outImpulseLinear = V3Scale(vErrorLinear, weightedMass);
+		const Vec3V outImpulseAngular = V3Scale(vErrorAngular, weightedInertia);
 
-			V3StoreA(V3Add(V3LoadUnsafeA(bond.impulseLinear), outImpulseLinear), bond.impulseLinear);
-			V3StoreA(V3Add(V3LoadUnsafeA(bond.impulseAngular), outImpulseAngular), bond.impulseAngular);
+		V3StoreA(V3Add(V3LoadUnsafeA(bond.impulseLinear), outImpulseLinear), bond.impulseLinear);
+		V3StoreA(V3Add(V3LoadUnsafeA(bond.impulseAngular), outImpulseAngular), bond.impulseAngular);
 
-			const Vec3V velocityLinearCorr0 = V3Scale(outImpulseLinear, invM0);
-			const Vec3V velocityLinearCorr1 = V3Scale(outImpulseLinear, invM1);
+		const Vec3V velocityLinearCorr0 = V3Scale(outImpulseLinear, invM0);
+		const Vec3V velocityLinearCorr1 = V3Scale(outImpulseLinear, invM1);
 
-			const Vec3V velocityAngularCorr0 = V3Sub(V3Scale(outImpulseAngular, invI0), V3Scale(V3Cross(offset, velocityLinearCorr0), invOffsetSqrLength));
-			const Vec3V velocityAngularCorr1 = V3Add(V3Scale(outImpulseAngular, invI1),	V3Scale(V3Cross(offset, velocityLinearCorr1), invOffsetSqrLength));
+		const Vec3V velocityAngularCorr0 = V3Sub(V3Scale(outImpulseAngular, invI0), V3Scale(V3Cross(offset, velocityLinearCorr0), invOffsetSqrLength));
+		const Vec3V velocityAngularCorr1 = V3Add(V3Scale(outImpulseAngular, invI1),	V3Scale(V3Cross(offset, velocityLinearCorr1), invOffsetSqrLength));
 
-			V3StoreA(V3Add(velocityLinear0, velocityLinearCorr0), node0->velocityLinear);
-			V3StoreA(V3Sub(velocityLinear1, velocityLinearCorr1), node1->velocityLinear);
+		V3StoreA(V3Add(velocityLinear0, velocityLinearCorr0), node0->velocityLinear);
+		V3StoreA(V3Sub(velocityLinear1, velocityLinearCorr1), node1->velocityLinear);
 
-			V3StoreA(V3Add(velocityAngular0, velocityAngularCorr0), node0->velocityAngular);
-			V3StoreA(V3Sub(velocityAngular1, velocityAngularCorr1), node1->velocityAngular);
+		V3StoreA(V3Add(velocityAngular0, velocityAngularCorr0), node0->velocityAngular);
+		V3StoreA(V3Sub(velocityAngular1, velocityAngularCorr1), node1->velocityAngular);
 #endif
-		}
 	}
 
+	enum
+	{
+		MAX_COLOR_COUNT = 64,		// colors tracked in a 64 bit mask per node
+		MIN_BONDS_PER_TASK = 64,	// smaller colors are not worth a task
+		BOND_SOA_FLOAT_COUNT = 10,	// offset, invOffsetSqrLength, impulseLinear, impulseAngular
+		NODE_SOA_FLOAT_COUNT = 8	// velocityLinear, velocityAngular, invMass, invI
+	};
+
 	Array<BondData>::type		m_bondsData;
 	Array<NodeData>::type		m_nodesData;
+
+	bool						m_coloringDirty;
+	Array<uint64_t>::type		m_nodeColorMasks;
+	Array<uint8_t>::type		m_bondColors;
+	Array<uint32_t>::type		m_colorOffsets;
+	Array<uint32_t>::type		m_colorBondIndices;
+
+	// SoA working set of the colored solve, AoS data above stays the reference between solves
+	ExtStressBondKernel			m_bondKernel;
+	ExtStressBondsSoA			m_bondsSoA;
+	ExtStressNodesSoA			m_nodesSoA;
+	Array<uint32_t>::type		m_bondNodesSoAData;
+	Array<float>::type			m_bondsSoAData;
+	Array<float>::type			m_nodesSoAData;
 };
 
 
@@ -342,6 +620,7 @@ public:
 		uint32_t solverNode;
 		uint32_t neighborsCount;
 		PxVec3 impulse;
+		uint32_t nextNode;		// next support node aggregated into the same solver node
 	};
 
 	struct SolverNodeData
@@ -355,6 +634,8 @@ public:
 		};
 		float volume;
 		bool isStatic;
+		bool isDirty;			// aggregate lost internal bonds or got too large for its island, see rebuildSolverNode()
+		uint32_t firstNode;
 	};
 
 	struct SolverBondData
@@ -362,8 +643,10 @@ public:
 		InlineArray<uint32_t, 8>::type blastBondIndices;
 	};
 
-	SupportGraphProcessor(uint32_t nodeCount, uint32_t maxBondCount) : m_solver(nodeCount, maxBondCount), m_nodesDirty(true)
+	SupportGraphProcessor(const NvBlastSupportGraph& graph, uint32_t maxBondCount) : m_graph(graph), m_solver(graph.nodeCount, maxBondCount), m_nodesDirty(true)
 	{
+		const uint32_t nodeCount = graph.nodeCount;
+
 		m_nodesData.resize(nodeCount);
 		m_bondsData.reserve(maxBondCount);
 
@@ -376,6 +659,7 @@ public:
 		memset(m_blastBondIndexMap.begin(), 0xFF, m_blastBondIndexMap.size() * sizeof(uint32_t));
 
 		resetImpulses();
+		latchImpulses();
 	}
 
 	const NodeData& getNodeData(uint32_t node) const
@@ -460,7 +744,11 @@ public:
 		// check for too huge aggregates (happens after island's split)
 		if (!m_nodesDirty)
 		{
-			m_nodesDirty |= (m_solverNodesData[m_nodesData[node].solverNode].supportNodesCount > neighborsCount / 2);
+			const uint32_t solverNode = m_nodesData[node].solverNode;
+			if (m_solverNodesData[solverNode].supportNodesCount > neighborsCount / 2)
+			{
+				markSolverNodeDirty(solverNode);
+			}
 		}
 	}
 
@@ -508,37 +796,14 @@ public:
 
 			if (isBondInternal)
 			{
-				// internal bond sadly requires graph resync (it never happens on reduction level '0')
-				m_nodesDirty = true;
+				// internal bond can split its aggregate, only this solver node needs to be rebuilt (it never happens on reduction level '0')
+				markSolverNodeDirty(solverNode0);
 			}
 			else if (!m_nodesDirty)
 			{
 				// otherwise it's external bond, we can remove it manually and keep graph synced
 				// we don't need to spend time there if (m_nodesDirty == true), graph will be resynced anyways
-
-				BondKey solverBondKey(solverNode0, solverNode1);
-				auto entry = m_solverBondsMap.find(solverBondKey);
-				if (entry)
-				{
-					const uint32_t solverBondIndex = entry->second;
-					auto& blastBondIndices = m_solverBondsData[solverBondIndex].blastBondIndices;
-					blastBondIndices.findAndReplaceWithLast(blastBondIndex);
-					if (blastBondIndices.empty())
-					{
-						// all bonds associated with this solver bond were removed, so let's remove solver bond
-
-						m_solverBondsData.replaceWithLast(solverBondIndex);
-						m_solver.replaceWithLast(solverBondIndex);
-						if (m_solver.getBondCount() > 0)
-						{
-							// update 'previously last' solver bond mapping
-							const auto& solverBond = m_solver.getBondData(solverBondIndex);
-							m_solverBondsMap[BondKey(solverBond.node0, solverBond.node1)] = solverBondIndex;
-						}
-
-						m_solverBondsMap.erase(solverBondKey);
-					}
-				}
+				detachBond(blastBondIndex, solverNode0, solverNode1);
 
 				CHECK_GRAPH_INTEGRITY;
 			}
@@ -561,22 +826,35 @@ public:
 		return m_graphReductionLevel;
 	}
 
-	void solve(const ExtStressSolverSettings& settings, const float* bondHealth, bool warmStart = true)
+	/**
+	Move impulses applied so far to the next solve(), impulses applied after this call go to the solve after it.
+	*/
+	void latchImpulses()
+	{
+		m_latchedImpulses.resize(m_nodesData.size());
+		for (uint32_t i = 0; i < m_nodesData.size(); ++i)
+		{
+			m_latchedImpulses[i] = m_nodesData[i].impulse;
+		}
+
+		resetImpulses();
+	}
+
+	void solve(const ExtStressSolverSettings& settings, const float* bondHealth, bool warmStart = true, ExtStressSolverTaskRunner* taskRunner = nullptr)
 	{
 		sync();
 
 		m_solver.initialize();
 
-		for (const NodeData& node : m_nodesData)
+		for (uint32_t i = 0; i < m_nodesData.size(); ++i)
 		{
+			const NodeData& node = m_nodesData[i];
 			const SequentialImpulseSolver::NodeData& solverNode = m_solver.getNodeData(node.solverNode);
-			m_solver.setNodeVelocities(node.solverNode, solverNode.velocityLinear + node.impulse * solverNode.invMass, PxVec3(PxZero));
+			m_solver.setNodeVelocities(node.solverNode, solverNode.velocityLinear + m_latchedImpulses[i] * solverNode.invMass, PxVec3(PxZero));
 		}
 
 		uint32_t iterationCount = ExtStressSolver::getIterationsPerFrame(settings, getSolverBondCount());
-		m_solver.solve(iterationCount, warmStart);
-
-		resetImpulses();
+		m_solver.solve(iterationCount, warmStart, settings.graphColoring, taskRunner);
 
 		updateBondStress(settings, bondHealth);
 	}
@@ -638,6 +916,10 @@ private:
 		{
 			syncNodes();
 		}
+		else if (!m_dirtySolverNodes.empty())
+		{
+			syncDirtySolverNodes();
+		}
 		if (m_bondsDirty)
 		{
 			syncBonds();
@@ -775,13 +1057,22 @@ private:
 		m_solver.reset(m_solverNodesData.size());
 		for (uint32_t nodeIndex = 0; nodeIndex < m_solverNodesData.size(); ++nodeIndex)
 		{
-			const SolverNodeData& solverNode = m_solverNodesData[nodeIndex];
+			updateSolverNodeMassInfo(nodeIndex);
+		}
 
-			const float invMass = solverNode.isStatic ? 0.0f : 1.0f / solverNode.mass;
-			const float R = PxPow(solverNode.volume * 3.0f * PxInvPi / 4.0f, 1.0f / 3.0f); // sphere volume approximation
-			const float invI = invMass / (R * R * 0.4f); // sphere inertia tensor approximation: I = 2/5 * M * R^2 ; invI = 1 / I;
-			m_solver.setNodeMassInfo(nodeIndex, invMass, invI);
+		// link support nodes of every solver node, used to rebuild single aggregates later
+		for (SolverNodeData& solverNode : m_solverNodesData)
+		{
+			solverNode.isDirty = false;
+			solverNode.firstNode = invalidIndex<uint32_t>();
+		}
+		for (uint32_t nodeIndex = m_nodesData.size(); nodeIndex-- > 0;)
+		{
+			SolverNodeData& solverNode = m_solverNodesData[m_nodesData[nodeIndex].solverNode];
+			m_nodesData[nodeIndex].nextNode = solverNode.firstNode;
+			solverNode.firstNode = nodeIndex;
 		}
+		m_dirtySolverNodes.clear();
 
 		m_nodesDirty = false;
 
@@ -796,39 +1087,213 @@ private:
 		m_solverBondsData.clear();
 		for (BondData& bond : m_bondsData)
 		{
-			const NodeData& node0 = m_nodesData[bond.node0];
-			const NodeData& node1 = m_nodesData[bond.node1];
+			attachBond(bond);
+		}
 
-			// reset stress, bond structure changed and internal bonds stress won't be updated during updateBondStress()
-			bond.stress = 0.0f;
+		m_bondsDirty = false;
+	}
 
-			if (node0.solverNode == node1.solverNode)
-				continue; // skip (internal)
+	void updateSolverNodeMassInfo(uint32_t nodeIndex)
+	{
+		const SolverNodeData& solverNode = m_solverNodesData[nodeIndex];
 
-			if (node0.isStatic && node1.isStatic)
-				continue;
+		const float invMass = solverNode.isStatic ? 0.0f : 1.0f / solverNode.mass;
+		const float R = PxPow(solverNode.volume * 3.0f * PxInvPi / 4.0f, 1.0f / 3.0f); // sphere volume approximation
+		const float invI = invMass / (R * R * 0.4f); // sphere inertia tensor approximation: I = 2/5 * M * R^2 ; invI = 1 / I;
+		m_solver.setNodeMassInfo(nodeIndex, invMass, invI);
+	}
 
-			BondKey key(node0.solverNode, node1.solverNode);
-			auto entry = m_solverBondsMap.find(key);
-			SolverBondData* data;
-			if (!entry)
+	/**
+	Add blast bond to the solver bond between its nodes' solver nodes, the solver bond is created if needed.
+	*/
+	void attachBond(BondData& bond)
+	{
+		const NodeData& node0 = m_nodesData[bond.node0];
+		const NodeData& node1 = m_nodesData[bond.node1];
+
+		// reset stress, bond structure changed and internal bonds stress won't be updated during updateBondStress()
+		bond.stress = 0.0f;
+
+		if (node0.solverNode == node1.solverNode)
+			return; // skip (internal)
+
+		if (node0.isStatic && node1.isStatic)
+			return;
+
+		BondKey key(node0.solverNode, node1.solverNode);
+		auto entry = m_solverBondsMap.find(key);
+		SolverBondData* data;
+		if (!entry)
+		{
+			m_solverBondsData.pushBack(SolverBondData());
+			data = &m_solverBondsData.back();
+			m_solverBondsMap[key] = m_solverBondsData.size() - 1;
+
+			SolverNodeData& solverNode0 = m_solverNodesData[node0.solverNode];
+			SolverNodeData& solverNode1 = m_solverNodesData[node1.solverNode];
+			m_solver.addBond(node0.solverNode, node1.solverNode, (solverNode1.localPos - solverNode0.localPos) * 0.5f);
+		}
+		else
+		{
+			data = &m_solverBondsData[entry->second];
+		}
+		data->blastBondIndices.pushBack(bond.blastBondIndex);
+	}
+
+	/**
+	Remove blast bond from the solver bond between solverNode0 and solverNode1, the solver bond is removed when it has no blast bonds left.
+	*/
+	void detachBond(uint32_t blastBondIndex, uint32_t solverNode0, uint32_t solverNode1)
+	{
+		BondKey solverBondKey(solverNode0, solverNode1);
+		auto entry = m_solverBondsMap.find(solverBondKey);
+		if (entry)
+		{
+			const uint32_t solverBondIndex = entry->second;
+			auto& blastBondIndices = m_solverBondsData[solverBondIndex].blastBondIndices;
+			blastBondIndices.findAndReplaceWithLast(blastBondIndex);
+			if (blastBondIndices.empty())
 			{
-				m_solverBondsData.pushBack(SolverBondData());
-				data = &m_solverBondsData.back();
-				m_solverBondsMap[key] = m_solverBondsData.size() - 1;
+				// all bonds associated with this solver bond were removed, so let's remove solver bond
 
-				SolverNodeData& solverNode0 = m_solverNodesData[node0.solverNode];
-				SolverNodeData& solverNode1 = m_solverNodesData[node1.solverNode];
-				m_solver.addBond(node0.solverNode, node1.solverNode, (solverNode1.localPos - solverNode0.localPos) * 0.5f);
+				m_solverBondsData.replaceWithLast(solverBondIndex);
+				m_solver.replaceWithLast(solverBondIndex);
+				if (m_solver.getBondCount() > 0)
+				{
+					// update 'previously last' solver bond mapping
+					const auto& solverBond = m_solver.getBondData(solverBondIndex);
+					m_solverBondsMap[BondKey(solverBond.node0, solverBond.node1)] = solverBondIndex;
+				}
+
+				m_solverBondsMap.erase(solverBondKey);
 			}
-			else
+		}
+	}
+
+	void markSolverNodeDirty(uint32_t solverNode)
+	{
+		// no need to track single aggregates if the whole graph is resynced anyways
+		if (!m_nodesDirty && !m_solverNodesData[solverNode].isDirty)
+		{
+			m_solverNodesData[solverNode].isDirty = true;
+			m_dirtySolverNodes.pushBack(solverNode);
+		}
+	}
+
+	void syncDirtySolverNodes()
+	{
+		for (uint32_t i = 0; i < m_dirtySolverNodes.size(); ++i)
+		{
+			rebuildSolverNode(m_dirtySolverNodes[i]);
+		}
+		m_dirtySolverNodes.clear();
+
+		CHECK_GRAPH_INTEGRITY;
+	}
+
+	/**
+	Rebuild a single aggregate instead of resyncing the whole graph.  The aggregate is split into its connected components,
+	a component too large for its island is split into single support nodes.  The first new solver node reuses the aggregate's
+	index, others are appended.  Only the blast bonds of the aggregate's support nodes are moved between solver bonds.
+	*/
+	void rebuildSolverNode(uint32_t solverNodeIndex)
+	{
+		// gather support nodes and their bonds, detach external bonds from their solver bonds
+		m_rebuildNodes.clear();
+		m_rebuildBonds.clear();
+		for (uint32_t node = m_solverNodesData[solverNodeIndex].firstNode; !isInvalidIndex(node); node = m_nodesData[node].nextNode)
+		{
+			m_rebuildNodes.pushBack(node);
+			for (uint32_t adjacencyIndex = m_graph.adjacencyPartition[node]; adjacencyIndex < m_graph.adjacencyPartition[node + 1]; adjacencyIndex++)
+			{
+				const uint32_t blastBondIndex = m_graph.adjacentBondIndices[adjacencyIndex];
+				if (isInvalidIndex(m_blastBondIndexMap[blastBondIndex]))
+					continue;
+
+				const uint32_t otherSolverNode = m_nodesData[m_graph.adjacentNodeIndices[adjacencyIndex]].solverNode;
+				if (otherSolverNode != solverNodeIndex)
+				{
+					detachBond(blastBondIndex, solverNodeIndex, otherSolverNode);
+					m_rebuildBonds.pushBack(blastBondIndex);
+				}
+				else if (node < m_graph.adjacentNodeIndices[adjacencyIndex])
+				{
+					m_rebuildBonds.pushBack(blastBondIndex); // internal, visited from both sides
+				}
+			}
+		}
+
+		// unassigned support nodes are the ones still to be visited
+		for (uint32_t node : m_rebuildNodes)
+		{
+			m_nodesData[node].solverNode = invalidIndex<uint32_t>();
+		}
+
+		bool reuseIndex = true;
+		for (uint32_t root : m_rebuildNodes)
+		{
+			if (!isInvalidIndex(m_nodesData[root].solverNode))
+				continue;
+
+			// flood fill the component through remaining bonds
+			m_rebuildComponent.clear();
+			m_rebuildComponent.pushBack(root);
+			m_nodesData[root].solverNode = solverNodeIndex;
+			for (uint32_t i = 0; i < m_rebuildComponent.size(); ++i)
+			{
+				const uint32_t node = m_rebuildComponent[i];
+				for (uint32_t adjacencyIndex = m_graph.adjacencyPartition[node]; adjacencyIndex < m_graph.adjacencyPartition[node + 1]; adjacencyIndex++)
+				{
+					const uint32_t adjacentNode = m_graph.adjacentNodeIndices[adjacencyIndex];
+					if (isInvalidIndex(m_nodesData[adjacentNode].solverNode) && !isInvalidIndex(m_blastBondIndexMap[m_graph.adjacentBondIndices[adjacencyIndex]]))
+					{
+						m_nodesData[adjacentNode].solverNode = solverNodeIndex;
+						m_rebuildComponent.pushBack(adjacentNode);
+					}
+				}
+			}
+
+			const bool isTooLarge = m_rebuildComponent.size() > m_nodesData[root].neighborsCount / 2;
+			const uint32_t aggregateSize = isTooLarge ? 1 : m_rebuildComponent.size();
+			for (uint32_t i = 0; i < m_rebuildComponent.size(); i += aggregateSize)
 			{
-				data = &m_solverBondsData[entry->second];
+				const uint32_t newSolverNodeIndex = reuseIndex ? solverNodeIndex : m_solverNodesData.size();
+				if (!reuseIndex)
+				{
+					m_solverNodesData.pushBack(SolverNodeData());
+					m_solver.addNode();
+				}
+				reuseIndex = false;
+
+				SolverNodeData& solverNode = m_solverNodesData[newSolverNodeIndex];
+				solverNode.supportNodesCount = aggregateSize;
+				solverNode.localPos = PxVec3(PxZero);
+				solverNode.mass = 0.0f;
+				solverNode.volume = 0.0f;
+				solverNode.isStatic = false;
+				solverNode.isDirty = false;
+				solverNode.firstNode = invalidIndex<uint32_t>();
+				for (uint32_t k = i; k < i + aggregateSize; ++k)
+				{
+					NodeData& node = m_nodesData[m_rebuildComponent[k]];
+					node.solverNode = newSolverNodeIndex;
+					node.nextNode = solverNode.firstNode;
+					solverNode.firstNode = m_rebuildComponent[k];
+					solverNode.localPos += node.localPos;
+					solverNode.mass += node.mass;
+					solverNode.volume += node.volume;
+					solverNode.isStatic |= node.isStatic;
+				}
+				solverNode.localPos /= (float)aggregateSize;
+
+				updateSolverNodeMassInfo(newSolverNodeIndex);
 			}
-			data->blastBondIndices.pushBack(bond.blastBondIndex);
 		}
 
-		m_bondsDirty = false;
+		for (uint32_t blastBondIndex : m_rebuildBonds)
+		{
+			attachBond(m_bondsData[m_blastBondIndexMap[blastBondIndex]]);
+		}
 	}
 
 #if GRAPH_INTERGRIRY_CHECK
@@ -900,6 +1365,7 @@ private:
 		}
 	};
 
+	NvBlastSupportGraph					m_graph;
 	SequentialImpulseSolver			    m_solver;
 	Array<SolverNodeData>::type			m_solverNodesData;
 	Array<SolverBondData>::type			m_solverBondsData;
@@ -916,6 +1382,13 @@ private:
 
 	Array<BondData>::type				m_bondsData;
 	Array<NodeData>::type				m_nodesData;
+
+	Array<PxVec3>::type					m_latchedImpulses;
+
+	Array<uint32_t>::type				m_dirtySolverNodes;
+	Array<uint32_t>::type				m_rebuildNodes;
+	Array<uint32_t>::type				m_rebuildBonds;
+	Array<uint32_t>::type				m_rebuildComponent;
 };
 
 
@@ -962,6 +1435,11 @@ public:
 		return m_settings;
 	}
 
+	virtual void							setTaskRunner(ExtStressSolverTaskRunner* taskRunner) override
+	{
+		m_taskRunner = taskRunner;
+	}
+
 	virtual bool							addForce(const NvBlastActor& actor, physx::PxVec3 localPosition, physx::PxVec3 localForce, ExtForceMode::Enum mode) override;
 
 	virtual void							addForce(uint32_t graphNode, physx::PxVec3 localForce, ExtForceMode::Enum mode) override;
@@ -971,6 +1449,12 @@ public:
 
 	virtual void							update() override;
 
+	virtual void							latch() override;
+
+	virtual void							solveLatched() override;
+
+	virtual bool							acquireFractureCommands(NvBlastFractureBuffers& commands) override;
+
 	virtual uint32_t						getOverstressedBondCount() const override
 	{
 		return m_graphProcessor->getOverstressedBondCount();
@@ -1010,6 +1494,8 @@ public:
 
 	virtual void							notifyActorDestroyed(const NvBlastActor& actor) override;
 
+	virtual void							notifyFractures(const NvBlastFractureBuffers& fractures) override;
+
 	virtual const DebugBuffer				fillDebugRender(const uint32_t* nodes, uint32_t nodeCount, DebugRenderMode mode, float scale) override;
 
 
@@ -1019,16 +1505,20 @@ private:
 
 	//////// private methods ////////
 
-	void									solve();
+	void									solve(const float* bondHealths);
 
 	void									fillFractureCommands(const NvBlastActor& actor, NvBlastFractureBuffers& commands);
 
+	void									fillOverstressedBondFractures(const float* bondHealths, Array<NvBlastBondFractureData>::type& bondFractures);
+
 	void									initialize();
 
 	void									iterate();
 
 	void									syncSolver();
 
+	void									applyPendingNotifications();
+
 	template<class T>
 	T*										getScratchArray(uint32_t size);
 
@@ -1041,12 +1531,20 @@ private:
 		physx::PxVec3 impulse;
 	};
 
+	struct NodeNeighborsCount
+	{
+		uint32_t node;
+		uint32_t neighborsCount;
+	};
+
 	NvBlastFamily&														m_family;
 	HashSet<const NvBlastActor*>::type									m_activeActors;
 	ExtStressSolverSettings												m_settings;
+	ExtStressSolverTaskRunner*											m_taskRunner;
 	NvBlastSupportGraph													m_graph;
 	bool																m_isDirty;
 	bool																m_reset;
+	bool																m_isFractureNotified;
 	const float*														m_bondHealths;
 	SupportGraphProcessor*												m_graphProcessor;
 	float																m_errorAngular;
@@ -1054,6 +1552,18 @@ private:
 	uint32_t															m_framesCount;
 	Array<NvBlastBondFractureData>::type								m_bondFractureBuffer;
 	Array<uint8_t>::type												m_scratch;
+
+	// graph changes notified since the last update() or latch(), not to touch the graph while a latched solve runs
+	Array<uint32_t>::type												m_pendingBrokenBonds;
+	Array<NodeNeighborsCount>::type										m_pendingNodeNeighborsCounts;
+
+	// state of the latched solve, see latch()
+	ExtStressSolverSettings												m_latchedSettings;
+	bool																m_latchedWarmStart;
+	std::atomic<bool>													m_hasLatchedResults;	//!< set by solveLatched() once its results are written
+	Array<float>::type													m_latchedBondHealths;
+	Array<NvBlastBondFractureData>::type								m_latchedBondFractures;
+	Array<NvBlastBondFractureData>::type								m_acquiredBondFractures;
 	Array<DebugLine>::type												m_debugLineBuffer;
 };
 
@@ -1075,8 +1585,9 @@ NV_INLINE T* ExtStressSolverImpl::getScratchArray(uint32_t size)
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 ExtStressSolverImpl::ExtStressSolverImpl(NvBlastFamily& family, ExtStressSolverSettings settings)
-	: m_family(family), m_settings(settings), m_isDirty(false), m_reset(false), 
-	m_errorAngular(std::numeric_limits<float>::max()), m_errorLinear(std::numeric_limits<float>::max()), m_framesCount(0)
+	: m_family(family), m_settings(settings), m_taskRunner(nullptr), m_isDirty(false), m_reset(false), m_isFractureNotified(false), 
+	m_errorAngular(std::numeric_limits<float>::max()), m_errorLinear(std::numeric_limits<float>::max()), m_framesCount(0),
+	m_latchedWarmStart(false)
 {
 	const NvBlastAsset* asset = NvBlastFamilyGetAsset(&m_family, logLL);
 	NVBLAST_ASSERT(asset);
@@ -1085,6 +1596,8 @@ ExtStressSolverImpl::ExtStressSolverImpl(NvBlastFamily& family, ExtStressSolverS
 	const uint32_t bondCount = NvBlastAssetGetBondCount(asset, logLL);
 
 	m_bondFractureBuffer.reserve(bondCount);
+	m_latchedBondHealths.resize(bondCount);
+	m_hasLatchedResults.store(false, std::memory_order_relaxed);
 
 	{
 		NvBlastActor* actor;
@@ -1092,7 +1605,7 @@ ExtStressSolverImpl::ExtStressSolverImpl(NvBlastFamily& family, ExtStressSolverS
 		m_bondHealths = NvBlastActorGetBondHealths(actor, logLL);
 	}
 
-	m_graphProcessor = NVBLAST_NEW(SupportGraphProcessor)(m_graph.nodeCount, bondCount);
+	m_graphProcessor = NVBLAST_NEW(SupportGraphProcessor)(m_graph, bondCount);
 
 	// traverse graph and fill bond info
 	for (uint32_t node0 = 0; node0 < m_graph.nodeCount; ++node0)
@@ -1194,12 +1707,13 @@ bool ExtStressSolverImpl::notifyActorCreated(const NvBlastActor& actor)
 			const uint32_t nodeCount = NvBlastActorGetGraphNodeIndices(graphNodeIndices, graphNodeCount, &actor, logLL);
 			for (uint32_t i = 0; i < nodeCount; ++i)
 			{
-				m_graphProcessor->setNodeNeighborsCount(graphNodeIndices[i], nodeCount);
+				const NodeNeighborsCount data = { graphNodeIndices[i], nodeCount };
+				m_pendingNodeNeighborsCounts.pushBack(data);
 			}
 		}
 
 		m_activeActors.insert(&actor);
-		m_isDirty = true;
+		m_isDirty |= !m_isFractureNotified;
 		return true;
 	}
 	return false;
@@ -1209,7 +1723,50 @@ void ExtStressSolverImpl::notifyActorDestroyed(const NvBlastActor& actor)
 {
 	if (m_activeActors.erase(&actor))
 	{
-		m_isDirty = true;
+		m_isDirty |= !m_isFractureNotified;
+	}
+}
+
+void ExtStressSolverImpl::notifyFractures(const NvBlastFractureBuffers& fractures)
+{
+	m_isFractureNotified = true;
+
+	for (uint32_t i = 0; i < fractures.bondFractureCount; ++i)
+	{
+		const uint32_t node0 = fractures.bondFractures[i].nodeIndex0;
+		const uint32_t node1 = fractures.bondFractures[i].nodeIndex1;
+		if (node0 >= m_graph.nodeCount || node1 >= m_graph.nodeCount)
+			continue;
+
+		for (uint32_t adjacencyIndex = m_graph.adjacencyPartition[node0]; adjacencyIndex < m_graph.adjacencyPartition[node0 + 1]; adjacencyIndex++)
+		{
+			if (m_graph.adjacentNodeIndices[adjacencyIndex] == node1)
+			{
+				// health in fracture data is either damage or remains, the family's bond health is checked when applied
+				m_pendingBrokenBonds.pushBack(m_graph.adjacentBondIndices[adjacencyIndex]);
+				break;
+			}
+		}
+	}
+
+	if (fractures.chunkFractureCount > 0)
+	{
+		// a fractured support chunk loses all its bonds, those still intact are filtered out when applied
+		const NvBlastAsset* asset = NvBlastFamilyGetAsset(&m_family, logLL);
+		const uint32_t chunkCount = NvBlastAssetGetChunkCount(asset, logLL);
+		const uint32_t* chunkToGraphNodeMap = NvBlastAssetGetChunkToGraphNodeMap(asset, logLL);
+		for (uint32_t i = 0; i < fractures.chunkFractureCount; ++i)
+		{
+			const uint32_t chunkIndex = fractures.chunkFractures[i].chunkIndex;
+			const uint32_t node = chunkIndex < chunkCount ? chunkToGraphNodeMap[chunkIndex] : invalidIndex<uint32_t>();
+			if (node >= m_graph.nodeCount)
+				continue;
+
+			for (uint32_t adjacencyIndex = m_graph.adjacencyPartition[node]; adjacencyIndex < m_graph.adjacencyPartition[node + 1]; adjacencyIndex++)
+			{
+				m_pendingBrokenBonds.pushBack(m_graph.adjacentBondIndices[adjacencyIndex]);
+			}
+		}
 	}
 }
 
@@ -1236,6 +1793,24 @@ void ExtStressSolverImpl::syncSolver()
 	m_isDirty = false;
 }
 
+void ExtStressSolverImpl::applyPendingNotifications()
+{
+	for (uint32_t bondIndex : m_pendingBrokenBonds)
+	{
+		if (m_bondHealths[bondIndex] <= 0.0f)
+		{
+			m_graphProcessor->removeBondIfExists(bondIndex);
+		}
+	}
+	m_pendingBrokenBonds.clear();
+
+	for (const NodeNeighborsCount& data : m_pendingNodeNeighborsCounts)
+	{
+		m_graphProcessor->setNodeNeighborsCount(data.node, data.neighborsCount);
+	}
+	m_pendingNodeNeighborsCounts.clear();
+}
+
 void ExtStressSolverImpl::initialize()
 {
 	if (m_reset)
@@ -1243,6 +1818,8 @@ void ExtStressSolverImpl::initialize()
 		m_framesCount = 0;
 	}
 
+	applyPendingNotifications();
+
 	if (m_isDirty)
 	{
 		syncSolver();
@@ -1252,6 +1829,12 @@ void ExtStressSolverImpl::initialize()
 	{
 		m_graphProcessor->setGraphReductionLevel(m_settings.graphReductionLevel);
 	}
+
+	// from here on solve() only works on latched data
+	m_graphProcessor->latchImpulses();
+	m_latchedSettings = m_settings;
+	m_latchedWarmStart = WARM_START && !m_reset;
+	m_reset = false;
 }
 
 bool ExtStressSolverImpl::addForce(const NvBlastActor& actor, physx::PxVec3 localPosition, physx::PxVec3 localForce, ExtForceMode::Enum mode)
@@ -1339,21 +1922,61 @@ void ExtStressSolverImpl::update()
 {
 	initialize();
 
-	solve();
+	solve(m_bondHealths);
 
 	m_framesCount++;
 }
 
-void ExtStressSolverImpl::solve()
+void ExtStressSolverImpl::solve(const float* bondHealths)
 {
 	PX_SIMD_GUARD;
 
-	m_graphProcessor->solve(m_settings, m_bondHealths, WARM_START && !m_reset);
-	m_reset = false;
+	m_graphProcessor->solve(m_latchedSettings, bondHealths, m_latchedWarmStart, m_taskRunner);
 
 	m_graphProcessor->calcError(m_errorLinear, m_errorAngular);
 }
 
+void ExtStressSolverImpl::latch()
+{
+	initialize();
+
+	// the family's bond healths keep changing while the latched solve runs
+	memcpy(m_latchedBondHealths.begin(), m_bondHealths, m_latchedBondHealths.size() * sizeof(float));
+
+	m_hasLatchedResults.store(false, std::memory_order_relaxed);
+	m_framesCount++;
+}
+
+void ExtStressSolverImpl::solveLatched()
+{
+	solve(m_latchedBondHealths.begin());
+
+	fillOverstressedBondFractures(m_latchedBondHealths.begin(), m_latchedBondFractures);
+
+	// publishes the fracture commands and errors to acquireFractureCommands()
+	m_hasLatchedResults.store(true, std::memory_order_release);
+}
+
+bool ExtStressSolverImpl::acquireFractureCommands(NvBlastFractureBuffers& commands)
+{
+	commands.chunkFractureCount = 0;
+	commands.chunkFractures = nullptr;
+
+	if (!m_hasLatchedResults.load(std::memory_order_acquire))
+	{
+		commands.bondFractureCount = 0;
+		commands.bondFractures = nullptr;
+		return false;
+	}
+
+	m_acquiredBondFractures.swap(m_latchedBondFractures);
+	m_hasLatchedResults.store(false, std::memory_order_relaxed);
+
+	commands.bondFractureCount = m_acquiredBondFractures.size();
+	commands.bondFractures = m_acquiredBondFractures.size() > 0 ? m_acquiredBondFractures.begin() : nullptr;
+	return true;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //													Damage
@@ -1409,16 +2032,16 @@ void ExtStressSolverImpl::generateFractureCommands(const NvBlastActor& actor, Nv
 	fillFractureCommands(actor, commands);
 }
 
-void ExtStressSolverImpl::generateFractureCommands(NvBlastFractureBuffers& commands)
+void ExtStressSolverImpl::fillOverstressedBondFractures(const float* bondHealths, Array<NvBlastBondFractureData>::type& bondFractures)
 {
-	m_bondFractureBuffer.clear();
+	bondFractures.clear();
 
 	const uint32_t bondCount = m_graphProcessor->getBondCount();
 	const uint32_t overstressedBondCount = m_graphProcessor->getOverstressedBondCount();
-	for (uint32_t i = 0; i < bondCount && m_bondFractureBuffer.size() < overstressedBondCount; i++)
+	for (uint32_t i = 0; i < bondCount && bondFractures.size() < overstressedBondCount; i++)
 	{
 		const auto& bondData = m_graphProcessor->getBondData(i);
-		const float bondHealth = m_bondHealths[bondData.blastBondIndex];
+		const float bondHealth = bondHealths[bondData.blastBondIndex];
 		if (bondHealth > 0.0f && bondData.stress > bondHealth)
 		{
 			const NvBlastBondFractureData data = {
@@ -1427,9 +2050,14 @@ void ExtStressSolverImpl::generateFractureCommands(NvBlastFractureBuffers& comma
 				bondData.node1,
 				bondHealth
 			};
-			m_bondFractureBuffer.pushBack(data);
+			bondFractures.pushBack(data);
 		}
 	}
+}
+
+void ExtStressSolverImpl::generateFractureCommands(NvBlastFractureBuffers& commands)
+{
+	fillOverstressedBondFractures(m_bondHealths, m_bondFractureBuffer);
 
 	commands.chunkFractureCount = 0;
 	commands.chunkFractures = nullptr;
@@ -0,0 +1,169 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#include "NvBlastExtStressSolverKernels.h"
+
+#if NV_SSE2
+#include <emmintrin.h>
+#endif
+
+#if NV_VC
+#include <intrin.h>
+#endif
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//												SSE2 Kernel
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if NV_SSE2
+
+namespace
+{
+
+struct StressSimdSSE
+{
+	typedef __m128 Float;
+	enum { WIDTH = 4 };
+
+	static NV_FORCE_INLINE Float load(const float* p) { return _mm_loadu_ps(p); }
+	static NV_FORCE_INLINE void store(float* p, Float v) { _mm_storeu_ps(p, v); }
+	static NV_FORCE_INLINE Float gather(const float* base, const uint32_t* indices)
+	{
+		return _mm_setr_ps(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]]);
+	}
+	static NV_FORCE_INLINE void scatter(float* base, const uint32_t* indices, Float v)
+	{
+		NV_ALIGN(16, float lanes[4]);
+		_mm_storeu_ps(lanes, v);
+		base[indices[0]] = lanes[0];
+		base[indices[1]] = lanes[1];
+		base[indices[2]] = lanes[2];
+		base[indices[3]] = lanes[3];
+	}
+	static NV_FORCE_INLINE Float splat(float f) { return _mm_set1_ps(f); }
+	static NV_FORCE_INLINE Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+	static NV_FORCE_INLINE Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+	static NV_FORCE_INLINE Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+	static NV_FORCE_INLINE Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+};
+
+} // anonymous namespace
+
+#endif // NV_SSE2
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//												CPU Detection
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool isAVX2Supported()
+{
+#if NV_VC && (NV_X86 || NV_X64)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+	{
+		return false;
+	}
+	__cpuid(info, 1);
+	const int osxsaveAndAvx = (1 << 27) | (1 << 28);
+	if ((info[2] & osxsaveAndAvx) != osxsaveAndAvx)
+	{
+		return false;
+	}
+	// OS must save the YMM registers on context switch
+	if ((_xgetbv(0) & 6) != 6)
+	{
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#elif NV_GCC_FAMILY && (NV_X86 || NV_X64)
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//												Kernel Selection
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ExtStressBondKernel getStressBondKernelScalar()
+{
+	ExtStressBondKernel kernel = { solveStressBonds<StressSimdScalar>, StressSimdScalar::WIDTH };
+	return kernel;
+}
+
+#if NV_SSE2
+
+bool getStressBondKernelSSE2(ExtStressBondKernel& kernel)
+{
+	kernel.solveBonds = solveStressBonds<StressSimdSSE>;
+	kernel.width = StressSimdSSE::WIDTH;
+	return true;
+}
+
+#else
+
+bool getStressBondKernelSSE2(ExtStressBondKernel&)
+{
+	return false;
+}
+
+#endif // NV_SSE2
+
+static ExtStressBondKernel selectStressBondKernel()
+{
+	ExtStressBondKernel kernel;
+	if (isAVX2Supported() && getStressBondKernelAVX2(kernel))
+	{
+		return kernel;
+	}
+	if (getStressBondKernelSSE2(kernel))
+	{
+		return kernel;
+	}
+	return getStressBondKernelScalar();
+}
+
+ExtStressBondKernel getStressBondKernel()
+{
+	static const ExtStressBondKernel kernel = selectStressBondKernel();
+	return kernel;
+}
+
+} // namespace Blast
+} // namespace Nv
@@ -0,0 +1,284 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+#ifndef NVBLASTEXTSTRESSSOLVERKERNELS_H
+#define NVBLASTEXTSTRESSSOLVERKERNELS_H
+
+#include "NvPreprocessor.h"
+#include <stdint.h>
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+SoA views of the sequential impulse solver data, used by the batched bond kernels.
+
+Bonds are stored in graph color order, so that consecutive bonds of the same color share no nodes and can be solved
+side by side in SIMD lanes.
+
+NOTE: kernels are compiled in separate translation units with different instruction sets. Besides data declarations
+this header only holds the kernel templates, in an anonymous namespace so that every translation unit keeps its own
+instantiations and the linker never picks code built for one instruction set in another. Keep inline functions and
+templates outside that namespace out of this header.
+*/
+struct ExtStressVec3SoA
+{
+	float*	x;
+	float*	y;
+	float*	z;
+};
+
+struct ExtStressBondsSoA
+{
+	const uint32_t*		node0;
+	const uint32_t*		node1;
+	ExtStressVec3SoA	offset;
+	const float*		invOffsetSqrLength;
+	ExtStressVec3SoA	impulseLinear;
+	ExtStressVec3SoA	impulseAngular;
+};
+
+struct ExtStressNodesSoA
+{
+	ExtStressVec3SoA	velocityLinear;
+	ExtStressVec3SoA	velocityAngular;
+	const float*		invMass;
+	const float*		invI;
+};
+
+
+/**
+Solves bonds [first, first + count) once, in batches of the kernel width followed by the remaining bonds one by one.
+Bonds of a batch must not share nodes.
+*/
+typedef void (*ExtStressSolveBondsFunction)(const ExtStressBondsSoA& bonds, const ExtStressNodesSoA& nodes, uint32_t first, uint32_t count);
+
+struct ExtStressBondKernel
+{
+	ExtStressSolveBondsFunction	solveBonds;
+	uint32_t					width;		//!< number of bonds solved at once
+};
+
+
+/**
+Kernel solving one bond at a time, for bonds which may share nodes.
+*/
+ExtStressBondKernel getStressBondKernelScalar();
+
+/**
+Widest kernel supported by the CPU: 8 bonds with AVX2, 4 bonds with SSE2, otherwise the scalar kernel.
+*/
+ExtStressBondKernel getStressBondKernel();
+
+/**
+SSE2 kernel.  Returns false if SSE2 code could not be built for the platform.
+*/
+bool getStressBondKernelSSE2(ExtStressBondKernel& kernel);
+
+/**
+AVX2 kernel, defined in a translation unit compiled for AVX2.  Returns false if AVX2 code could not be built for the platform.
+Only call it if the CPU supports AVX2.
+*/
+bool getStressBondKernelAVX2(ExtStressBondKernel& kernel);
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//												Kernel Implementation
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+The bond kernel written once against a SIMD wrapper S providing a Float type, WIDTH and load/store/gather/scatter and arithmetic
+functions.  Instantiated by the kernel translation units only, hence the anonymous namespace.
+*/
+namespace
+{
+
+template<typename S>
+struct StressVec3
+{
+	typename S::Float x, y, z;
+};
+
+template<typename S>
+NV_FORCE_INLINE StressVec3<S> stressLoad(const ExtStressVec3SoA& v, uint32_t i)
+{
+	const StressVec3<S> r = { S::load(v.x + i), S::load(v.y + i), S::load(v.z + i) };
+	return r;
+}
+
+template<typename S>
+NV_FORCE_INLINE void stressStore(const ExtStressVec3SoA& v, uint32_t i, const StressVec3<S>& a)
+{
+	S::store(v.x + i, a.x);
+	S::store(v.y + i, a.y);
+	S::store(v.z + i, a.z);
+}
+
+template<typename S>
+NV_FORCE_INLINE StressVec3<S> stressGather(const ExtStressVec3SoA& v, const uint32_t* indices)
+{
+	const StressVec3<S> r = { S::gather(v.x, indices), S::gather(v.y, indices), S::gather(v.z, indices) };
+	return r;
+}
+
+template<typename S>
+NV_FORCE_INLINE void stressScatter(const ExtStressVec3SoA& v, const uint32_t* indices, const StressVec3<S>& a)
+{
+	S::scatter(v.x, indices, a.x);
+	S::scatter(v.y, indices, a.y);
+	S::scatter(v.z, indices, a.z);
+}
+
+template<typename S>
+NV_FORCE_INLINE StressVec3<S> stressAdd(const StressVec3<S>& a, const StressVec3<S>& b)
+{
+	const StressVec3<S> r = { S::add(a.x, b.x), S::add(a.y, b.y), S::add(a.z, b.z) };
+	return r;
+}
+
+template<typename S>
+NV_FORCE_INLINE StressVec3<S> stressSub(const StressVec3<S>& a, const StressVec3<S>& b)
+{
+	const StressVec3<S> r = { S::sub(a.x, b.x), S::sub(a.y, b.y), S::sub(a.z, b.z) };
+	return r;
+}
+
+template<typename S>
+NV_FORCE_INLINE StressVec3<S> stressScale(const StressVec3<S>& a, typename S::Float f)
+{
+	const StressVec3<S> r = { S::mul(a.x, f), S::mul(a.y, f), S::mul(a.z, f) };
+	return r;
+}
+
+template<typename S>
+NV_FORCE_INLINE StressVec3<S> stressCross(const StressVec3<S>& a, const StressVec3<S>& b)
+{
+	const StressVec3<S> r = {
+		S::sub(S::mul(a.y, b.z), S::mul(a.z, b.y)),
+		S::sub(S::mul(a.z, b.x), S::mul(a.x, b.z)),
+		S::sub(S::mul(a.x, b.y), S::mul(a.y, b.x))
+	};
+	return r;
+}
+
+/**
+Solves S::WIDTH bonds starting at bond i, same math as SequentialImpulseSolver::solveBond.
+*/
+template<typename S>
+NV_FORCE_INLINE void solveStressBondBatch(const ExtStressBondsSoA& bonds, const ExtStressNodesSoA& nodes, uint32_t i)
+{
+	typedef typename S::Float Float;
+	typedef StressVec3<S> Vec3;
+
+	const uint32_t* node0 = bonds.node0 + i;
+	const uint32_t* node1 = bonds.node1 + i;
+
+	const Vec3 velocityLinear0 = stressGather<S>(nodes.velocityLinear, node0);
+	const Vec3 velocityLinear1 = stressGather<S>(nodes.velocityLinear, node1);
+	const Vec3 velocityAngular0 = stressGather<S>(nodes.velocityAngular, node0);
+	const Vec3 velocityAngular1 = stressGather<S>(nodes.velocityAngular, node1);
+
+	const Vec3 offset = stressLoad<S>(bonds.offset, i);
+	const Vec3 vA = stressSub<S>(velocityLinear0, stressCross<S>(velocityAngular0, offset));
+	const Vec3 vB = stressAdd<S>(velocityLinear1, stressCross<S>(velocityAngular1, offset));
+
+	const Vec3 vErrorLinear = stressSub<S>(vA, vB);
+	const Vec3 vErrorAngular = stressSub<S>(velocityAngular0, velocityAngular1);
+
+	const Float invM0 = S::gather(nodes.invMass, node0);
+	const Float invM1 = S::gather(nodes.invMass, node1);
+	const Float invI0 = S::gather(nodes.invI, node0);
+	const Float invI1 = S::gather(nodes.invI, node1);
+	const Float invOffsetSqrLength = S::load(bonds.invOffsetSqrLength + i);
+
+	const Float minusHalf = S::splat(-0.5f);
+	const Float weightedMass = S::div(minusHalf, S::add(invM0, invM1));
+	const Float weightedInertia = S::div(minusHalf, S::add(invI0, invI1));
+
+	const Vec3 outImpulseLinear = stressScale<S>(vErrorLinear, weightedMass);
+	const Vec3 outImpulseAngular = stressScale<S>(vErrorAngular, weightedInertia);
+
+	stressStore<S>(bonds.impulseLinear, i, stressAdd<S>(stressLoad<S>(bonds.impulseLinear, i), outImpulseLinear));
+	stressStore<S>(bonds.impulseAngular, i, stressAdd<S>(stressLoad<S>(bonds.impulseAngular, i), outImpulseAngular));
+
+	const Vec3 velocityLinearCorr0 = stressScale<S>(outImpulseLinear, invM0);
+	const Vec3 velocityLinearCorr1 = stressScale<S>(outImpulseLinear, invM1);
+
+	const Vec3 velocityAngularCorr0 = stressSub<S>(stressScale<S>(outImpulseAngular, invI0), stressScale<S>(stressCross<S>(offset, velocityLinearCorr0), invOffsetSqrLength));
+	const Vec3 velocityAngularCorr1 = stressAdd<S>(stressScale<S>(outImpulseAngular, invI1), stressScale<S>(stressCross<S>(offset, velocityLinearCorr1), invOffsetSqrLength));
+
+	stressScatter<S>(nodes.velocityLinear, node0, stressAdd<S>(velocityLinear0, velocityLinearCorr0));
+	stressScatter<S>(nodes.velocityLinear, node1, stressSub<S>(velocityLinear1, velocityLinearCorr1));
+
+	stressScatter<S>(nodes.velocityAngular, node0, stressAdd<S>(velocityAngular0, velocityAngularCorr0));
+	stressScatter<S>(nodes.velocityAngular, node1, stressSub<S>(velocityAngular1, velocityAngularCorr1));
+}
+
+/**
+Scalar 'SIMD' wrapper, used for the remainder of batched kernels and by the scalar kernel.
+*/
+struct StressSimdScalar
+{
+	typedef float Float;
+	enum { WIDTH = 1 };
+
+	static NV_FORCE_INLINE Float load(const float* p) { return *p; }
+	static NV_FORCE_INLINE void store(float* p, Float v) { *p = v; }
+	static NV_FORCE_INLINE Float gather(const float* base, const uint32_t* indices) { return base[indices[0]]; }
+	static NV_FORCE_INLINE void scatter(float* base, const uint32_t* indices, Float v) { base[indices[0]] = v; }
+	static NV_FORCE_INLINE Float splat(float f) { return f; }
+	static NV_FORCE_INLINE Float add(Float a, Float b) { return a + b; }
+	static NV_FORCE_INLINE Float sub(Float a, Float b) { return a - b; }
+	static NV_FORCE_INLINE Float mul(Float a, Float b) { return a * b; }
+	static NV_FORCE_INLINE Float div(Float a, Float b) { return a / b; }
+};
+
+template<typename S>
+void solveStressBonds(const ExtStressBondsSoA& bonds, const ExtStressNodesSoA& nodes, uint32_t first, uint32_t count)
+{
+	const uint32_t end = first + count;
+	uint32_t i = first;
+	for (; i + S::WIDTH <= end; i += S::WIDTH)
+	{
+		solveStressBondBatch<S>(bonds, nodes, i);
+	}
+	for (; i < end; ++i)
+	{
+		solveStressBondBatch<StressSimdScalar>(bonds, nodes, i);
+	}
+}
+
+} // anonymous namespace
+
+} // namespace Blast
+} // namespace Nv
+
+
+#endif // ifndef NVBLASTEXTSTRESSSOLVERKERNELS_H
@@ -0,0 +1,94 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+// This file is compiled with AVX2 code generation enabled (see NvBlastExtStress.cmake), only call into it after checking
+// the CPU supports AVX2.
+
+#include "NvBlastExtStressSolverKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+#if defined(__AVX2__)
+
+namespace
+{
+
+struct StressSimdAVX2
+{
+	typedef __m256 Float;
+	enum { WIDTH = 8 };
+
+	static NV_FORCE_INLINE Float load(const float* p) { return _mm256_loadu_ps(p); }
+	static NV_FORCE_INLINE void store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+	static NV_FORCE_INLINE Float gather(const float* base, const uint32_t* indices)
+	{
+		return _mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), 4);
+	}
+	static NV_FORCE_INLINE void scatter(float* base, const uint32_t* indices, Float v)
+	{
+		NV_ALIGN(32, float lanes[8]);
+		_mm256_storeu_ps(lanes, v);
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			base[indices[i]] = lanes[i];
+		}
+	}
+	static NV_FORCE_INLINE Float splat(float f) { return _mm256_set1_ps(f); }
+	static NV_FORCE_INLINE Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+	static NV_FORCE_INLINE Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+	static NV_FORCE_INLINE Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+	static NV_FORCE_INLINE Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+};
+
+} // anonymous namespace
+
+bool getStressBondKernelAVX2(ExtStressBondKernel& kernel)
+{
+	kernel.solveBonds = solveStressBonds<StressSimdAVX2>;
+	kernel.width = StressSimdAVX2::WIDTH;
+	return true;
+}
+
+#else
+
+bool getStressBondKernelAVX2(ExtStressBondKernel&)
+{
+	return false;
+}
+
+#endif // __AVX2__
+
+} // namespace Blast
+} // namespace Nv
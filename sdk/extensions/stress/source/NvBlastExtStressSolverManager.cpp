@@ -0,0 +1,283 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+
+#include "NvBlastExtStressSolverManager.h"
+#include "NvBlastGlobals.h"
+#include "NvBlastArray.h"
+#include "NvBlastWorkQueues.h"
+
+#include <algorithm>
+#include <string.h>
+
+
+namespace Nv
+{
+namespace Blast
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//										ExtStressSolverManagerImpl Definition
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ExtStressSolverManagerImpl final : public ExtStressSolverManager
+{
+	NV_NOCOPY(ExtStressSolverManagerImpl)
+
+public:
+	ExtStressSolverManagerImpl() : m_taskRunner(nullptr), m_generateFractureCommands(true), m_overstressedBondCount(0) {}
+
+
+	//////// ExtStressSolverManager interface ////////
+
+	virtual void									release() override;
+
+	virtual void									addSolver(ExtStressSolver& solver) override;
+
+	virtual void									removeSolver(ExtStressSolver& solver) override;
+
+	virtual uint32_t								getSolverCount() const override
+	{
+		return m_solvers.size();
+	}
+
+	virtual void									setTaskRunner(ExtStressSolverTaskRunner* taskRunner) override
+	{
+		m_taskRunner = taskRunner;
+	}
+
+	virtual void									update(bool generateFractureCommands) override;
+
+	virtual const ExtStressSolverManagerResult*		getResults(uint32_t& resultCount) const override
+	{
+		resultCount = m_results.size();
+		return m_results.begin();
+	}
+
+	virtual const NvBlastBondFractureData*			getBondFractures(uint32_t& bondFractureCount) const override
+	{
+		bondFractureCount = m_bondFractures.size();
+		return m_bondFractures.begin();
+	}
+
+	virtual uint32_t								getOverstressedBondCount() const override
+	{
+		return m_overstressedBondCount;
+	}
+
+private:
+	~ExtStressSolverManagerImpl() {}
+
+
+	//////// private methods ////////
+
+	void											updateSolver(uint32_t solverIndex);
+
+	void											dealSolvers(uint32_t queueCount);
+
+
+	//////// data ////////
+
+	class UpdateTasks : public ExtStressSolverTaskRunner::Tasks
+	{
+	public:
+		UpdateTasks(ExtStressSolverManagerImpl& manager) : m_manager(manager) {}
+
+		virtual void execute(uint32_t taskIndex) override;
+
+	private:
+		ExtStressSolverManagerImpl&	m_manager;
+	};
+
+	Array<ExtStressSolver*>::type					m_solvers;
+	ExtStressSolverTaskRunner*						m_taskRunner;
+	bool											m_generateFractureCommands;
+
+	Array<uint64_t>::type							m_solverCosts;
+	Array<uint32_t>::type							m_sortedSolvers;
+	WorkQueues										m_queues;
+	Array<NvBlastFractureBuffers>::type				m_solverCommands;
+	Array<uint32_t>::type							m_solverOverstressedBondCounts;
+
+	Array<ExtStressSolverManagerResult>::type		m_results;
+	Array<NvBlastBondFractureData>::type			m_bondFractures;
+	uint32_t										m_overstressedBondCount;
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Creation
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ExtStressSolverManager* ExtStressSolverManager::create()
+{
+	return NVBLAST_NEW(ExtStressSolverManagerImpl)();
+}
+
+void ExtStressSolverManagerImpl::release()
+{
+	NVBLAST_DELETE(this, ExtStressSolverManagerImpl);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Solvers
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExtStressSolverManagerImpl::addSolver(ExtStressSolver& solver)
+{
+	if (m_solvers.find(&solver) == m_solvers.end())
+	{
+		m_solvers.pushBack(&solver);
+	}
+}
+
+void ExtStressSolverManagerImpl::removeSolver(ExtStressSolver& solver)
+{
+	m_solvers.findAndReplaceWithLast(&solver);
+
+	// results can point to this solver
+	for (uint32_t i = 0; i < m_results.size(); ++i)
+	{
+		if (m_results[i].solver == &solver)
+		{
+			m_results.remove(i);
+			break;
+		}
+	}
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//													Update
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExtStressSolverManagerImpl::updateSolver(uint32_t solverIndex)
+{
+	ExtStressSolver* solver = m_solvers[solverIndex];
+	solver->update();
+
+	NvBlastFractureBuffers& commands = m_solverCommands[solverIndex];
+	commands.bondFractureCount = 0;
+	commands.chunkFractureCount = 0;
+
+	const uint32_t overstressedBondCount = solver->getOverstressedBondCount();
+	m_solverOverstressedBondCounts[solverIndex] = overstressedBondCount;
+	if (m_generateFractureCommands && overstressedBondCount > 0)
+	{
+		solver->generateFractureCommands(commands);
+	}
+}
+
+void ExtStressSolverManagerImpl::UpdateTasks::execute(uint32_t taskIndex)
+{
+	ExtStressSolverManagerImpl& manager = m_manager;
+	manager.m_queues.process(taskIndex, [&manager](uint32_t solverIndex) { manager.updateSolver(solverIndex); });
+}
+
+void ExtStressSolverManagerImpl::dealSolvers(uint32_t queueCount)
+{
+	const uint32_t solverCount = m_solvers.size();
+
+	// expected solver cost: bond count times iterations, the same as bondIterationsPerFrame unless clamped
+	m_solverCosts.resize(solverCount);
+	for (uint32_t i = 0; i < solverCount; ++i)
+	{
+		const ExtStressSolver* solver = m_solvers[i];
+		m_solverCosts[i] = (uint64_t)solver->getBondCount() * solver->getIterationsPerFrame();
+	}
+
+	m_sortedSolvers.resize(solverCount);
+	for (uint32_t i = 0; i < solverCount; ++i)
+	{
+		m_sortedSolvers[i] = i;
+	}
+	const uint64_t* costs = m_solverCosts.begin();
+	std::sort(m_sortedSolvers.begin(), m_sortedSolvers.end(), [costs](uint32_t a, uint32_t b) { return costs[a] > costs[b]; });
+
+	m_queues.deal(queueCount, solverCount, m_sortedSolvers.begin());
+}
+
+void ExtStressSolverManagerImpl::update(bool generateFractureCommands)
+{
+	const uint32_t solverCount = m_solvers.size();
+
+	m_generateFractureCommands = generateFractureCommands;
+	m_solverCommands.resize(solverCount);
+	m_solverOverstressedBondCounts.resize(solverCount);
+
+	const uint32_t taskCount = m_taskRunner ? std::min<uint32_t>(m_taskRunner->getMaxTaskCount(), solverCount) : 1;
+	if (taskCount > 1)
+	{
+		dealSolvers(taskCount);
+		UpdateTasks tasks(*this);
+		m_taskRunner->run(tasks, taskCount);
+	}
+	else
+	{
+		for (uint32_t i = 0; i < solverCount; ++i)
+		{
+			updateSolver(i);
+		}
+	}
+
+	// gather results in one contiguous buffer
+	m_results.clear();
+	m_bondFractures.clear();
+	m_overstressedBondCount = 0;
+	uint32_t bondFractureCount = 0;
+	for (uint32_t i = 0; i < solverCount; ++i)
+	{
+		m_overstressedBondCount += m_solverOverstressedBondCounts[i];
+		bondFractureCount += m_solverCommands[i].bondFractureCount;
+	}
+	m_bondFractures.resize(bondFractureCount);
+
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < solverCount; ++i)
+	{
+		const NvBlastFractureBuffers& commands = m_solverCommands[i];
+		if (commands.bondFractureCount == 0)
+		{
+			continue;
+		}
+
+		NvBlastBondFractureData* bondFractures = m_bondFractures.begin() + offset;
+		memcpy(bondFractures, commands.bondFractures, commands.bondFractureCount * sizeof(NvBlastBondFractureData));
+		offset += commands.bondFractureCount;
+
+		const ExtStressSolverManagerResult result = {
+			m_solvers[i],
+			{ commands.bondFractureCount, 0, bondFractures, nullptr },
+			m_solverOverstressedBondCounts[i]
+		};
+		m_results.pushBack(result);
+	}
+}
+
+} // namespace Blast
+} // namespace Nv
@@ -722,7 +722,7 @@ Creates fracture commands for the actor using a damage program and program param
 \param[in]		program				A NvBlastDamageProgram containing damage shaders.
 \param[in]		programParams		Parameters for the NvBlastDamageProgram.
 \param[in]		logFn				User-supplied message function (see NvBlastLog definition).  May be NULL.
-\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step, in profile build configurations.
+\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step.
 
 Interpretation of NvBlastFractureBuffers:
 As input:
@@ -755,7 +755,7 @@ Chunks damaged beyond their respective health fracture their children recursivel
 \param[in,out]	actor				The NvBlastActor to apply fracture to.
 \param[in]		commands			The fracture commands to process.
 \param[in]		logFn				User-supplied message function (see NvBlastLog definition).  May be NULL.
-\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step, in profile build configurations.
+\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step.
 
 Interpretation of NvBlastFractureBuffers:
 commands:
@@ -794,7 +794,7 @@ Releases the oldActor and creates its children newActors if necessary.
 \param[in]		newActorsMaxCount	Number of available NvBlastActor slots. In the worst case, one NvBlastActor may be created for every chunk in the asset.
 \param[in]		scratch				Scratch Memory used during processing. NvBlastActorGetRequiredScratchForSplit provides the necessary size.
 \param[in]		logFn				User-supplied message function (see NvBlastLog definition).  May be NULL.
-\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step, in profile build configurations
+\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step.
 
 \return	1..n:	new actors were created
 \return	0:		oldActor is unchanged
@@ -862,6 +862,155 @@ NVBLAST_API bool NvBlastActorIsSplitRequired(const NvBlastActor* actor, NvBlastL
 */
 NVBLAST_API bool NvBlastActorIsBoundToWorld(const NvBlastActor* actor, NvBlastLog logFn);
 
+
+/**
+Returns the number of bytes of scratch memory that the user must supply to NvBlastActorBatchFracture,
+based upon the batch entries that will be passed into that function.
+
+The scratch memory holds the temporary fracture commands and split data for the largest family referenced by the batch,
+so a buffer sized for a set of families may be reused for any batch over actors of those families.
+
+\param[in] damages		The batch entries that will be passed into NvBlastActorBatchFracture.
+\param[in] damageCount	The number of entries in the damages array.
+\param[in] logFn		User-supplied message function (see NvBlastLog definition).  May be NULL.
+
+\return	the number of bytes of scratch memory required for a call to NvBlastActorBatchFracture with those entries.
+*/
+NVBLAST_API size_t NvBlastActorBatchGetRequiredScratch(const NvBlastActorBatchDamage* damages, uint32_t damageCount, NvBlastLog logFn);
+
+
+/**
+Generates fracture commands, applies them and splits the damaged actors for a batch of (actor, damage program, params) entries
+in a single call.  This is equivalent to calling NvBlastActorGenerateFracture and NvBlastActorApplyFracture for every entry
+in order, followed by NvBlastActorSplit for every distinct damaged actor, but input validation is done once for the whole batch
+and the family data stays in cache while consecutive entries of the same family are processed.  Grouping entries by family
+is therefore recommended.
+
+Several entries may reference the same actor.  All damage of the batch is applied before any actor is split.  The split result
+of an actor is reported in the result of the first entry which references it, other entries report no new actors.
+
+\param[out]		results				User-supplied array of size damageCount, filled with the per-entry results.  The event buffers and
+									new actor lists of each result reference ranges of eventBuffers and newActors respectively.
+\param[in,out]	eventBuffers		Contiguous target buffers to hold the applied fracture events of all entries.  May be NULL, in which case
+									events are not reported.  As input the counters denote available entries, as output valid entries.
+\param[out]		newActors			User-supplied array to hold all actors created by splitting.  In the worst case, the sum of
+									NvBlastActorGetMaxActorCountForSplit for all distinct actors is required.
+\param[in]		newActorsMaxCount	The size of the newActors array.
+\param[in]		damages				The batch entries to process.
+\param[in]		damageCount			The number of entries in the damages and results arrays.
+\param[in]		scratch				Scratch memory used during processing.  NvBlastActorBatchGetRequiredScratch provides the necessary size.
+\param[in]		logFn				User-supplied message function (see NvBlastLog definition).  May be NULL.
+\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step.
+
+\return	the total number of new actors written to newActors.
+*/
+NVBLAST_API uint32_t NvBlastActorBatchFracture
+(
+	NvBlastActorBatchResult* results,
+	NvBlastFractureBuffers* eventBuffers,
+	NvBlastActor** newActors,
+	uint32_t newActorsMaxCount,
+	const NvBlastActorBatchDamage* damages,
+	uint32_t damageCount,
+	void* scratch,
+	NvBlastLog logFn,
+	NvBlastTimers* timers
+);
+
+
+/**
+Returns the number of bytes of scratch memory that the user must supply to NvBlastActorSplitTasksBegin,
+based upon the actor that will be passed into that function.
+
+\param[in] actor			The actor that will be passed into NvBlastActorSplitTasksBegin.
+\param[in] maxTaskCount	The maximum number of tasks per phase that will be passed into NvBlastActorSplitTasksBegin.
+\param[in] logFn			User-supplied message function (see NvBlastLog definition).  May be NULL.
+
+\return	the number of bytes of scratch memory required for a split of that actor in tasks.
+*/
+NVBLAST_API size_t NvBlastActorGetRequiredScratchForSplitTasks(const NvBlastActor* actor, uint32_t maxTaskCount, NvBlastLog logFn);
+
+
+/**
+Starts splitting an actor in tasks, which may be executed concurrently by a user's thread pool.  This is an alternative to
+NvBlastActorSplit for actors with many graph nodes, where a single thread would otherwise update the whole actor.
+
+The split is processed in phases.  Every phase consists of a number of tasks which may be executed in any order and concurrently,
+each exactly once, with NvBlastActorSplitTaskExecute.  After all tasks of a phase completed, NvBlastActorSplitTasksSync
+must be called (on a single thread) to start the next phase.  When no tasks are left, NvBlastActorSplitTasksEnd completes the split:
+
+	uint32_t taskCount = NvBlastActorSplitTasksBegin(&result, actor, newActorsMaxCount, maxTaskCount, scratch, logFn, timers);
+	while (taskCount > 0)
+	{
+		// execute NvBlastActorSplitTaskExecute(scratch, taskIndex) for every taskIndex in [0, taskCount) on the worker threads, and wait
+		taskCount = NvBlastActorSplitTasksSync(scratch);
+	}
+	const uint32_t newActorCount = NvBlastActorSplitTasksEnd(scratch, logFn, timers);
+
+The island search and the partitioning of the graph nodes into new actors are done in this function.  The tasks update
+the actor indices of the chunks and find the visible chunks of the new actors.
+
+The result does not depend on the number of tasks or on their execution order.  The same actors are created as with
+NvBlastActorSplit, the order of the visible chunks of the resulting actors may differ though.
+
+The actor's family must not be accessed by other functions until NvBlastActorSplitTasksEnd returned.
+
+\param[out]		result				The list of deleted and created NvBlastActor objects, valid after NvBlastActorSplitTasksEnd.
+\param[in]		actor				The actor to split.
+\param[in]		newActorsMaxCount	Number of available NvBlastActor slots. In the worst case, one NvBlastActor may be created for every chunk in the asset.
+\param[in]		maxTaskCount		The maximum number of tasks per phase, typically the number of worker threads.
+\param[in]		scratch				Scratch memory holding the split state until NvBlastActorSplitTasksEnd returned.  NvBlastActorGetRequiredScratchForSplitTasks
+									provides the necessary size.
+\param[in]		logFn				User-supplied message function (see NvBlastLog definition).  May be NULL.
+\param[in,out]	timers				If non-NULL this struct will be filled out with profiling information for the step.
+
+\return	the number of tasks of the first phase, 0 if no tasks need to be executed.  If the input is invalid, 0 is returned and,
+		provided scratch is not NULL, NvBlastActorSplitTasksEnd reports no new actors.
+*/
+NVBLAST_API uint32_t NvBlastActorSplitTasksBegin
+(
+	NvBlastActorSplitEvent* result,
+	NvBlastActor* actor,
+	uint32_t newActorsMaxCount,
+	uint32_t maxTaskCount,
+	void* scratch,
+	NvBlastLog logFn,
+	NvBlastTimers* timers
+);
+
+
+/**
+Executes one task of the current phase of a split started with NvBlastActorSplitTasksBegin.  Tasks of the same phase may run concurrently.
+
+\param[in]	scratch		The scratch memory passed into NvBlastActorSplitTasksBegin.
+\param[in]	taskIndex	The index of the task, in the range [0, task count of the current phase).
+*/
+NVBLAST_API void NvBlastActorSplitTaskExecute(void* scratch, uint32_t taskIndex);
+
+
+/**
+Starts the next phase of a split started with NvBlastActorSplitTasksBegin, after all tasks of the current phase have been executed.
+
+\param[in]	scratch		The scratch memory passed into NvBlastActorSplitTasksBegin.
+
+\return	the number of tasks of the next phase, 0 if all phases are done.
+*/
+NVBLAST_API uint32_t NvBlastActorSplitTasksSync(void* scratch);
+
+
+/**
+Completes a split started with NvBlastActorSplitTasksBegin, after all phases are done.  The result passed into
+NvBlastActorSplitTasksBegin is filled out.
+
+\param[in]		scratch		The scratch memory passed into NvBlastActorSplitTasksBegin.
+\param[in]		logFn		User-supplied message function (see NvBlastLog definition).  May be NULL.
+\param[in,out]	timers		If non-NULL this struct will be filled out with profiling information for the step.
+
+\return	1..n:	new actors were created
+\return	0:		the actor is unchanged
+*/
+NVBLAST_API uint32_t NvBlastActorSplitTasksEnd(void* scratch, NvBlastLog logFn, NvBlastTimers* timers);
+
 ///@} End NvBlastActor damage and fracturing functions
 
 
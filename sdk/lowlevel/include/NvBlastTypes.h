@@ -77,9 +77,10 @@ Time spent (in ticks) in various parts of Blast.
 These values may be filled in during the execution of various API functions.
 To convert to seconds, use NvBlastTicksToSeconds(ticks).
 
-In profile build configurations, if a pointer to an instance of this struct is passed into
-Blast functions with an NvBlastTimers argument, then Blast will add to appropriate fields
-the time measured in corresponding sections of code.  The user must clear the timer fields
+If a pointer to an instance of this struct is passed into Blast functions with an NvBlastTimers
+argument, then Blast will add to appropriate fields the time measured in corresponding sections
+of code.  This is available in all build configurations; the clock is only read when a non-NULL
+pointer is passed, so passing NULL costs nothing.  The user must clear the timer fields
 with NvBlastTimersReset to initialize or reset.
 */
 struct NvBlastTimers
@@ -588,6 +589,32 @@ struct NvBlastDamageProgram
 };
 
 
+/**
+A single entry of a batched fracture call: the actor to damage together with the damage program and its parameters.
+
+@see NvBlastActorBatchFracture
+*/
+struct NvBlastActorBatchDamage
+{
+	NvBlastActor*			actor;			//!<	actor to generate fracture for, apply fracture to and split
+	NvBlastDamageProgram	program;		//!<	damage program used to generate fracture commands
+	const void*				programParams;	//!<	parameters for the damage program
+};
+
+
+/**
+Result of a single NvBlastActorBatchDamage entry processed by NvBlastActorBatchFracture.
+
+All pointers reference the contiguous output buffers supplied to NvBlastActorBatchFracture.
+*/
+struct NvBlastActorBatchResult
+{
+	NvBlastFractureBuffers	events;			//!<	applied fracture events for this entry, a range of the batch's event buffers
+	NvBlastActorSplitEvent	splitEvent;		//!<	split result, newActors is a range of the batch's newActors array
+	uint32_t				newActorCount;	//!<	number of actors in splitEvent.newActors
+};
+
+
 ///@} End of types used for damage and fracturing
 
 
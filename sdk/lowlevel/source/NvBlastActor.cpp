@@ -202,11 +202,7 @@ void Actor::generateFracture(NvBlastFractureBuffers* commandBuffers, const NvBla
 	}
 #endif
 
-#if NV_PROFILE
-	Time time;
-#else
-	NV_UNUSED(timers);
-#endif
+	Time time(timers != nullptr);
 
 	const SupportGraph* graph = getGraph();
 
@@ -249,17 +245,77 @@ void Actor::generateFracture(NvBlastFractureBuffers* commandBuffers, const NvBla
 		commandBuffers->chunkFractureCount = 0;
 	}
 
-#if NV_PROFILE
 	if (timers != nullptr)
 	{
 		timers->material += time.getElapsedTicks();
 	}
-#endif
 }
 
 
 
 
+/**
+Removes actors without visible chunks from the list and returns them to the family.
+
+\return the number of actors left in the list.
+*/
+static uint32_t removeInvisibleActors(FamilyHeader* header, Actor** actors, uint32_t actorsCount)
+{
+	uint32_t actualActorsCount = 0;
+	for (uint32_t i = 0; i < actorsCount; ++i)
+	{
+		actors[actualActorsCount] = actors[i];
+		if (actors[actualActorsCount]->getVisibleChunkCount() > 0)
+		{
+			++actualActorsCount;
+		}
+		else
+		{
+			header->returnActor(*actors[actualActorsCount]);
+		}
+	}
+	return actualActorsCount;
+}
+
+
+/**
+Partitions the single lower-support chunk actors of the list which have no health left, replacing them with their children.
+
+\return the number of actors in the list.
+*/
+static uint32_t partitionBrittleActors(Actor** newActors, uint32_t actorsCount, uint32_t newActorsMaxCount, NvBlastLog logFn)
+{
+	for (uint32_t i = 0; i < actorsCount; ++i)
+	{
+		Actor* newActor = newActors[i];
+		float* chunkHealths = newActor->getLowerSupportChunkHealths();
+		uint32_t firstVisible = newActor->getFirstVisibleChunkIndex();
+		uint32_t firstSub = newActor->getFirstSubsupportChunkIndex();
+		uint32_t nodeCount = newActor->getGraph()->m_nodeCount;
+		uint32_t newActorIndex = newActor->getIndex();
+		uint32_t healthIndex = newActor->isSubSupportChunk() ? firstVisible - firstSub + nodeCount : newActorIndex;
+
+		if (newActors[i]->getGraphNodeCount() <= 1)
+		{
+			// this relies on visibility updated, subsupport actors only have m_firstVisibleChunkIndex to identify the chunk
+			if (chunkHealths[healthIndex] <= 0.0f)
+			{
+				uint32_t brittleActors = newActors[i]->partitionSingleLowerSupportChunk(&newActors[actorsCount], newActorsMaxCount - actorsCount, logFn);
+				actorsCount += brittleActors;
+
+				if (brittleActors > 0)
+				{
+					actorsCount--;
+					newActors[i] = newActors[actorsCount];
+					i--;
+				}
+			}
+		}
+	}
+	return actorsCount;
+}
+
+
 size_t Actor::splitRequiredScratch() const
 {
 	// Scratch is reused, just need the max of these two values
@@ -273,11 +329,7 @@ uint32_t Actor::split(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount
 	NVBLASTLL_CHECK(newActorsMaxCount > 0 && result->newActors != nullptr, logFn, "NvBlastActorSplit: no space for results provided.", return 0);
 	NVBLASTLL_CHECK(scratch != nullptr, logFn, "Actor::split: NULL scratch pointer input.", return 0);
 
-#if NV_PROFILE
-	Time time;
-#else
-	NV_UNUSED(timers);
-#endif
+	Time time(timers != nullptr);
 
 	Actor** newActors = reinterpret_cast<Actor**>(result->newActors);
 
@@ -317,23 +369,19 @@ uint32_t Actor::split(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount
 		}
 
 
-#if NV_PROFILE
 		if (timers != nullptr)
 		{
 			timers->partition += time.getElapsedTicks();
 		}
-#endif
 	}
 	else
 	{
 		findIslands(scratch);
 
-#if NV_PROFILE
 		if (timers != nullptr)
 		{
 			timers->island += time.getElapsedTicks();
 		}
-#endif
 
 		// Reuse scratch for node list
 		uint32_t* graphNodeIndexList = reinterpret_cast<uint32_t*>(scratch);
@@ -360,12 +408,10 @@ uint32_t Actor::split(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount
 
 		if (actorsCount > 1)
 		{
-#if NV_PROFILE
 			if (timers != nullptr)
 			{
 				timers->partition += time.getElapsedTicks();
 			}
-#endif
 
 			// Get various pointers and values to iterate 
 			const Asset* asset = getAsset();
@@ -390,74 +436,562 @@ uint32_t Actor::split(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount
 			}
 
 			// Remove actors with no visible chunks - this can happen if we've split such that the world node is by itself
-			uint32_t actualActorsCount = 0;
-			for (uint32_t i = 0; i < actorsCount; ++i)
+			actorsCount = removeInvisibleActors(header, newActors, actorsCount);
+
+			if (timers != nullptr)
+			{
+				timers->visibility += time.getElapsedTicks();
+			}
+
+			actorsCount = partitionBrittleActors(newActors, actorsCount, newActorsMaxCount, logFn);
+
+			if (timers != nullptr)
+			{
+				timers->partition += time.getElapsedTicks();
+			}
+		}
+		else
+		{
+			actorsCount = 0;
+		}
+	}
+
+	result->deletedActor = actorsCount == 0 ? nullptr : this;
+
+	return actorsCount;
+}
+
+
+/**
+Sizes of the temporary buffers used by Actor::batchFracture, large enough for the largest family referenced in a batch.
+*/
+struct BatchScratchSizes
+{
+	uint32_t	bondCommandCount;
+	uint32_t	chunkCommandCount;
+	size_t		splitScratchSize;
+
+	BatchScratchSizes(const NvBlastActorBatchDamage* damages, uint32_t damageCount) : bondCommandCount(0), chunkCommandCount(0), splitScratchSize(0)
+	{
+		for (uint32_t i = 0; i < damageCount; ++i)
+		{
+			const Actor* actor = static_cast<const Actor*>(damages[i].actor);
+			if (actor != nullptr && actor->isActive())
 			{
-				newActors[actualActorsCount] = newActors[i];
-				if (newActors[actualActorsCount]->getVisibleChunkCount() > 0)
+				const Asset* asset = actor->getAsset();
+				bondCommandCount = std::max(bondCommandCount, asset->getBondCount());
+				chunkCommandCount = std::max(chunkCommandCount, asset->getLowerSupportChunkCount());
+				splitScratchSize = std::max(splitScratchSize, actor->splitRequiredScratch());
+			}
+		}
+	}
+
+	size_t getBondCommandsSize() const
+	{
+		return align16(bondCommandCount * sizeof(NvBlastBondFractureData));
+	}
+
+	size_t getChunkCommandsSize() const
+	{
+		return align16(chunkCommandCount * sizeof(NvBlastChunkFractureData));
+	}
+
+	size_t getTotalSize() const
+	{
+		return getBondCommandsSize() + getChunkCommandsSize() + splitScratchSize;
+	}
+};
+
+
+size_t Actor::batchFractureRequiredScratch(const NvBlastActorBatchDamage* damages, uint32_t damageCount)
+{
+	return BatchScratchSizes(damages, damageCount).getTotalSize();
+}
+
+
+uint32_t Actor::batchFracture(NvBlastActorBatchResult* results, NvBlastFractureBuffers* eventBuffers, NvBlastActor** newActors, uint32_t newActorsMaxCount,
+	const NvBlastActorBatchDamage* damages, uint32_t damageCount, void* scratch, NvBlastLog logFn, NvBlastTimers* timers)
+{
+	NVBLASTLL_CHECK(damageCount == 0 || results != nullptr, logFn, "Actor::batchFracture: NULL results pointer input.", return 0);
+	NVBLASTLL_CHECK(damageCount == 0 || damages != nullptr, logFn, "Actor::batchFracture: NULL damages pointer input.", return 0);
+	NVBLASTLL_CHECK(newActorsMaxCount == 0 || newActors != nullptr, logFn, "Actor::batchFracture: NULL newActors pointer input with non-zero newActorsMaxCount.", return 0);
+	NVBLASTLL_CHECK(scratch != nullptr, logFn, "Actor::batchFracture: NULL scratch pointer input.", return 0);
+	NVBLASTLL_CHECK(eventBuffers == nullptr || isValid(eventBuffers), logFn, "Actor::batchFracture: eventBuffers memory is NULL but size is > 0.", return 0);
+
+	// Partition scratch: bond commands, chunk commands, split scratch
+	const BatchScratchSizes sizes(damages, damageCount);
+	NvBlastBondFractureData* bondCommands = reinterpret_cast<NvBlastBondFractureData*>(scratch);
+	NvBlastChunkFractureData* chunkCommands = pointerOffset<NvBlastChunkFractureData*>(scratch, sizes.getBondCommandsSize());
+	void* splitScratch = pointerOffset(scratch, sizes.getBondCommandsSize() + sizes.getChunkCommandsSize());
+
+	const uint32_t bondEventsSize = eventBuffers != nullptr ? eventBuffers->bondFractureCount : 0;
+	const uint32_t chunkEventsSize = eventBuffers != nullptr ? eventBuffers->chunkFractureCount : 0;
+	uint32_t bondEventCount = 0;
+	uint32_t chunkEventCount = 0;
+	bool eventsLost = false;
+
+	// Generate and apply fracture for all entries before any actor is split, so repeated entries for an actor remain valid
+	for (uint32_t i = 0; i < damageCount; ++i)
+	{
+		NvBlastActorBatchResult& result = results[i];
+		result.events.bondFractureCount = 0;
+		result.events.chunkFractureCount = 0;
+		result.events.bondFractures = eventBuffers != nullptr && eventBuffers->bondFractures != nullptr ? eventBuffers->bondFractures + bondEventCount : nullptr;
+		result.events.chunkFractures = eventBuffers != nullptr && eventBuffers->chunkFractures != nullptr ? eventBuffers->chunkFractures + chunkEventCount : nullptr;
+		result.splitEvent.deletedActor = nullptr;
+		result.splitEvent.newActors = nullptr;
+		result.newActorCount = 0;
+
+		Actor* actor = static_cast<Actor*>(damages[i].actor);
+		if (actor == nullptr || !actor->isActive())
+		{
+			NVBLASTLL_LOG_ERROR(logFn, "NvBlastActorBatchFracture: NULL or inactive actor in batch entry, entry is ignored.");
+			continue;
+		}
+
+		NvBlastFractureBuffers commands = { sizes.bondCommandCount, sizes.chunkCommandCount, bondCommands, chunkCommands };
+		actor->generateFracture(&commands, damages[i].program, damages[i].programParams, logFn, timers);
+
+		if (commands.bondFractureCount == 0 && commands.chunkFractureCount == 0)
+		{
+			continue;
+		}
+
+		NvBlastFractureBuffers* events = nullptr;
+		if (eventBuffers != nullptr)
+		{
+			result.events.bondFractureCount = result.events.bondFractures != nullptr ? bondEventsSize - bondEventCount : 0;
+			result.events.chunkFractureCount = result.events.chunkFractures != nullptr ? chunkEventsSize - chunkEventCount : 0;
+			if (result.events.bondFractureCount > 0 || result.events.chunkFractureCount > 0)
+			{
+				events = &result.events;
+			}
+			else
+			{
+				eventsLost = true;
+			}
+		}
+
+		actor->getFamilyHeader()->applyFracture(events, &commands, actor, logFn, timers);
+
+		bondEventCount += result.events.bondFractureCount;
+		chunkEventCount += result.events.chunkFractureCount;
+	}
+
+	if (eventsLost)
+	{
+		NVBLASTLL_LOG_WARNING(logFn, "NvBlastActorBatchFracture: eventBuffers too small. Fracture events were lost.");
+	}
+
+	if (eventBuffers != nullptr)
+	{
+		eventBuffers->bondFractureCount = bondEventCount;
+		eventBuffers->chunkFractureCount = chunkEventCount;
+	}
+
+	// Split every damaged actor once, reporting the result with the first entry referencing it
+	uint32_t newActorCount = 0;
+	for (uint32_t i = 0; i < damageCount; ++i)
+	{
+		NvBlastActorBatchResult& result = results[i];
+		result.splitEvent.newActors = newActors != nullptr ? newActors + newActorCount : nullptr;
+
+		Actor* actor = static_cast<Actor*>(damages[i].actor);
+		if (actor == nullptr || !actor->isActive() || !actor->isSplitRequired())
+		{
+			continue;
+		}
+
+		if (newActorCount >= newActorsMaxCount)
+		{
+			NVBLASTLL_LOG_WARNING(logFn, "NvBlastActorBatchFracture: newActors array is full, remaining actors are not split.");
+			break;
+		}
+
+		result.newActorCount = actor->split(&result.splitEvent, newActorsMaxCount - newActorCount, splitScratch, logFn, timers);
+		newActorCount += result.newActorCount;
+	}
+
+	return newActorCount;
+}
+
+
+/**
+State of a split executed in tasks (see Actor::splitTasksBegin), stored at the start of the user-supplied scratch memory.
+
+The split is executed in phases.  Each phase processes a contiguous range of items, evenly divided into tasks which
+only write data owned by their own items, so tasks of a phase may run concurrently in any order:
+
+SupportChunks:		items are the graph nodes of the split actor, every support chunk gets the index of its new actor.
+UpperSupportChunks:	items are the upper-support chunks above the support chunks of the split actor, one phase per hierarchy level
+					from the deepest to the top one.  Every chunk gets the index of its children's actor if uniform, otherwise invalid.
+VisibleChunks:		items are all chunks of the two previous phases, chunks which are visible in their actor are recorded.
+
+The recorded visible chunks are linked into the actors' visible chunk lists in item order, so the result does not depend on
+the task count or execution order.
+*/
+struct SplitTaskState
+{
+	enum Phase
+	{
+		SupportChunks,
+		UpperSupportChunks,
+		VisibleChunks,
+		Done
+	};
+
+	Actor*					actor;
+	FamilyHeader*			header;
+	const Asset*			asset;
+	NvBlastActorSplitEvent*	result;
+	uint32_t				newActorsMaxCount;
+	uint32_t				newActorCount;
+	uint32_t				maxTaskCount;
+	uint32_t				phase;
+	uint32_t				level;
+	uint32_t				itemStart;
+	uint32_t				itemCount;
+	uint32_t				taskCount;
+	uint32_t				graphNodeCount;
+	uint32_t				upperSupportChunkCount;
+	uint32_t				levelCount;
+	uint32_t*				items;				// graphNodeCount graph node indices, followed by upperSupportChunkCount chunk indices
+	uint32_t*				visibleChunkIndices;	// Per item, the visible chunk index or invalid
+	uint32_t*				levelStarts;		// levelCount + 1 offsets into the upper-support chunk items
+
+	/**
+	Sets the item range of the given phase (and level for UpperSupportChunks), and the task count to process it.
+	*/
+	void	setPhase(uint32_t newPhase, uint32_t newLevel)
+	{
+		phase = newPhase;
+		level = newLevel;
+		switch (phase)
+		{
+		case SupportChunks:
+			itemStart = 0;
+			itemCount = graphNodeCount;
+			break;
+		case UpperSupportChunks:
+			itemStart = graphNodeCount + levelStarts[level];
+			itemCount = levelStarts[level + 1] - levelStarts[level];
+			break;
+		case VisibleChunks:
+			itemStart = 0;
+			itemCount = graphNodeCount + upperSupportChunkCount;
+			break;
+		default:
+			itemStart = 0;
+			itemCount = 0;
+		}
+		taskCount = itemCount > 0 ? std::min(maxTaskCount, (itemCount + SplitTaskMinItemCount - 1) / SplitTaskMinItemCount) : 0;
+	}
+
+	/**
+	Advances to the next phase which has items to process, if any.
+
+	\return the number of tasks of the new phase, 0 if all phases are done.
+	*/
+	uint32_t	nextPhase()
+	{
+		do
+		{
+			if (phase == SupportChunks)
+			{
+				if (levelCount > 0)
 				{
-					++actualActorsCount;
+					setPhase(UpperSupportChunks, levelCount - 1);
 				}
 				else
 				{
-					header->returnActor(*newActors[actualActorsCount]);
+					setPhase(VisibleChunks, 0);
 				}
 			}
-			actorsCount = actualActorsCount;
-
-#if NV_PROFILE
-			if (timers != nullptr)
+			else if (phase == UpperSupportChunks && level > 0)
 			{
-				timers->visibility += time.getElapsedTicks();
+				setPhase(UpperSupportChunks, level - 1);
 			}
-#endif
-
-			for (uint32_t i = 0; i < actorsCount; ++i)
+			else
 			{
-				Actor* newActor = newActors[i];
-				float* chunkHealths = newActor->getLowerSupportChunkHealths();
-				uint32_t firstVisible = newActor->getFirstVisibleChunkIndex();
-				uint32_t firstSub = newActor->getFirstSubsupportChunkIndex();
-				uint32_t nodeCount = newActor->getGraph()->m_nodeCount;
-				uint32_t newActorIndex = newActor->getIndex();
-				uint32_t healthIndex = newActor->isSubSupportChunk() ? firstVisible - firstSub + nodeCount : newActorIndex;
+				setPhase(phase + 1, 0);
+			}
+		} while (phase != Done && taskCount == 0);
+
+		return taskCount;
+	}
+
+	/**
+	Tasks with fewer items are not worth the overhead.
+	*/
+	static const uint32_t SplitTaskMinItemCount = 64;
+};
+
+
+size_t Actor::splitTasksRequiredScratch(uint32_t maxTaskCount) const
+{
+	NV_UNUSED(maxTaskCount);	// The state does not depend on the task count
+
+	const uint32_t upperSupportChunkCount = getAsset()->getUpperSupportChunkCount();
+	const size_t itemsSize = align16((m_graphNodeCount + upperSupportChunkCount) * sizeof(uint32_t));
+	const size_t levelStartsSize = align16((upperSupportChunkCount + 1) * sizeof(uint32_t));
+
+	// Island search scratch is reused for the items
+	return align16(sizeof(SplitTaskState)) + std::max(splitRequiredScratch(), 2 * itemsSize + levelStartsSize);
+}
+
+
+void Actor::splitTasksInitDone(NvBlastActorSplitEvent* result, void* scratch)
+{
+	SplitTaskState* state = new (scratch) SplitTaskState();
+	state->result = result;
+	state->newActorCount = 0;
+	state->phase = SplitTaskState::Done;
+}
+
+
+uint32_t Actor::splitTasksBegin(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount, uint32_t maxTaskCount, void* scratch, NvBlastLog logFn, NvBlastTimers* timers)
+{
+	NVBLASTLL_CHECK(scratch != nullptr, logFn, "Actor::splitTasksBegin: NULL scratch pointer input.", return 0);
+
+	// Initialize the state as done, so splitTasksEnd reports no new actors if the split can't be started
+	splitTasksInitDone(result, scratch);
+	SplitTaskState* state = reinterpret_cast<SplitTaskState*>(scratch);
+
+	NVBLASTLL_CHECK(result != nullptr, logFn, "Actor::splitTasksBegin: NULL result pointer input.", return 0);
+	NVBLASTLL_CHECK(newActorsMaxCount > 0 && result->newActors != nullptr, logFn, "Actor::splitTasksBegin: no space for results provided.", return 0);
 
-				if (newActors[i]->getGraphNodeCount() <= 1)
+	result->deletedActor = nullptr;
+
+	if (!isActive())
+	{
+		NVBLASTLL_LOG_ERROR(logFn, "Actor::splitTasksBegin: actor is not active.");
+		return 0;
+	}
+
+	state->actor = this;
+	state->header = getFamilyHeader();
+	state->asset = getAsset();
+	state->result = result;
+	state->newActorsMaxCount = newActorsMaxCount;
+	state->maxTaskCount = std::max(maxTaskCount, 1u);
+
+	// Single lower-support chunk actors have no graph to process, there is nothing to gain from tasks
+	if (getGraphNodeCount() <= 1)
+	{
+		state->newActorCount = split(result, newActorsMaxCount, pointerOffset(scratch, align16(sizeof(SplitTaskState))), logFn, timers);
+		return 0;
+	}
+
+	Time time(timers != nullptr);
+
+	void* splitScratch = pointerOffset(scratch, align16(sizeof(SplitTaskState)));
+	findIslands(splitScratch);
+
+	if (timers != nullptr)
+	{
+		timers->island += time.getElapsedTicks();
+	}
+
+	FamilyHeader* header = state->header;
+	const Asset* asset = state->asset;
+	const uint32_t upperSupportChunkCount = asset->getUpperSupportChunkCount();
+	const uint32_t* chunkToGraphNodeMap = asset->getChunkToGraphNodeMap();
+	const NvBlastChunk* chunks = asset->getChunks();
+
+	// Lay out the item arrays on the scratch, now that the island search is done
+	state->items = reinterpret_cast<uint32_t*>(splitScratch);
+	state->visibleChunkIndices = pointerOffset<uint32_t*>(splitScratch, align16((m_graphNodeCount + upperSupportChunkCount) * sizeof(uint32_t)));
+	state->levelStarts = pointerOffset<uint32_t*>(splitScratch, 2 * align16((m_graphNodeCount + upperSupportChunkCount) * sizeof(uint32_t)));
+
+	// Record nodes in this actor before splitting
+	const uint32_t* graphNodeIndexLinks = header->getGraphNodeIndexLinks();
+	for (uint32_t graphNodeIndex = m_firstGraphNodeIndex; !isInvalidIndex(graphNodeIndex) && state->graphNodeCount < m_graphNodeCount; graphNodeIndex = graphNodeIndexLinks[graphNodeIndex])
+	{
+		state->items[state->graphNodeCount++] = graphNodeIndex;
+	}
+
+	// Record the upper-support chunks above the support chunks, level by level.  They all lie under the visible chunks of this actor.
+	uint32_t* upperSupportChunks = state->items + state->graphNodeCount;
+	for (uint32_t chunkIndex = m_firstVisibleChunkIndex; !isInvalidIndex(chunkIndex); chunkIndex = header->getVisibleChunkIndexLinks()[chunkIndex].m_adj[1])
+	{
+		if (chunkIndex < upperSupportChunkCount && isInvalidIndex(chunkToGraphNodeMap[chunkIndex]))
+		{
+			upperSupportChunks[state->upperSupportChunkCount++] = chunkIndex;
+		}
+	}
+	uint32_t levelStop = 0;
+	while (levelStop < state->upperSupportChunkCount)
+	{
+		const uint32_t levelStart = levelStop;
+		levelStop = state->upperSupportChunkCount;
+		state->levelStarts[state->levelCount++] = levelStart;
+		for (uint32_t i = levelStart; i < levelStop; ++i)
+		{
+			const NvBlastChunk& chunk = chunks[upperSupportChunks[i]];
+			for (uint32_t childIndex = chunk.firstChildIndex; childIndex < chunk.childIndexStop; ++childIndex)
+			{
+				if (childIndex < upperSupportChunkCount && isInvalidIndex(chunkToGraphNodeMap[childIndex]))
 				{
-					// this relies on visibility updated, subsupport actors only have m_firstVisibleChunkIndex to identify the chunk
-					if (chunkHealths[healthIndex] <= 0.0f)
-					{
-						uint32_t brittleActors = newActors[i]->partitionSingleLowerSupportChunk(&newActors[actorsCount], newActorsMaxCount - actorsCount, logFn);
-						actorsCount += brittleActors;
-
-						if (brittleActors > 0)
-						{
-							actorsCount--;
-							newActors[i] = newActors[actorsCount];
-							i--;
-						}
-					}
+					upperSupportChunks[state->upperSupportChunkCount++] = childIndex;
 				}
 			}
+		}
+	}
+	state->levelStarts[state->levelCount] = state->upperSupportChunkCount;
 
-#if NV_PROFILE
-			if (timers != nullptr)
+	state->newActorCount = partitionMultipleGraphNodes(reinterpret_cast<Actor**>(result->newActors), newActorsMaxCount, logFn);
+
+	if (timers != nullptr)
+	{
+		timers->partition += time.getElapsedTicks();
+	}
+
+	if (state->newActorCount <= 1)
+	{
+		state->newActorCount = 0;
+		return 0;
+	}
+
+	// The visible chunk lists are rebuilt by the tasks, empty this actor's list (already done if it was released)
+	IndexDLink<uint32_t>* visibleChunkIndexLinks = header->getVisibleChunkIndexLinks();
+	while (!isInvalidIndex(m_firstVisibleChunkIndex))
+	{
+		IndexDList<uint32_t>().removeListHead(m_firstVisibleChunkIndex, visibleChunkIndexLinks);
+	}
+	m_visibleChunkCount = 0;
+
+	state->setPhase(SplitTaskState::SupportChunks, 0);
+	return state->taskCount > 0 ? state->taskCount : state->nextPhase();
+}
+
+
+void Actor::splitTaskExecute(void* scratch, uint32_t taskIndex)
+{
+	SplitTaskState* state = reinterpret_cast<SplitTaskState*>(scratch);
+	NVBLAST_ASSERT(taskIndex < state->taskCount);
+
+	const uint32_t* items = state->items + state->itemStart;
+	const uint32_t itemStart = static_cast<uint32_t>((uint64_t)state->itemCount * taskIndex / state->taskCount);
+	const uint32_t itemStop = static_cast<uint32_t>((uint64_t)state->itemCount * (taskIndex + 1) / state->taskCount);
+
+	uint32_t* chunkActorIndices = state->header->getChunkActorIndices();
+	const uint32_t* graphChunkIndices = state->asset->m_graph.getChunkIndices();
+	const NvBlastChunk* chunks = state->asset->getChunks();
+
+	switch (state->phase)
+	{
+	case SplitTaskState::SupportChunks:
+	{
+		const uint32_t* islandIds = state->header->getFamilyGraph()->getIslandIds();
+		for (uint32_t i = itemStart; i < itemStop; ++i)
+		{
+			const uint32_t supportChunkIndex = graphChunkIndices[items[i]];
+			if (!isInvalidIndex(supportChunkIndex))	// Invalid if this is the world chunk
 			{
-				timers->partition += time.getElapsedTicks();
+				chunkActorIndices[supportChunkIndex] = islandIds[items[i]];
 			}
-#endif
 		}
-		else
+	}
+	break;
+	case SplitTaskState::UpperSupportChunks:
+	{
+		for (uint32_t i = itemStart; i < itemStop; ++i)
 		{
-			actorsCount = 0;
+			// All children belong to the same actor, or the chunk belongs to no actor
+			const NvBlastChunk& chunk = chunks[items[i]];
+			uint32_t actorIndex = chunkActorIndices[chunk.firstChildIndex];
+			for (uint32_t childIndex = chunk.firstChildIndex + 1; !isInvalidIndex(actorIndex) && childIndex < chunk.childIndexStop; ++childIndex)
+			{
+				if (chunkActorIndices[childIndex] != actorIndex)
+				{
+					actorIndex = invalidIndex<uint32_t>();
+				}
+			}
+			chunkActorIndices[items[i]] = actorIndex;
 		}
 	}
+	break;
+	case SplitTaskState::VisibleChunks:
+	{
+		for (uint32_t i = itemStart; i < itemStop; ++i)
+		{
+			const uint32_t chunkIndex = i < state->graphNodeCount ? graphChunkIndices[items[i]] : items[i];
+			uint32_t visibleChunkIndex = invalidIndex<uint32_t>();
+			if (!isInvalidIndex(chunkIndex) && !isInvalidIndex(chunkActorIndices[chunkIndex]))
+			{
+				const uint32_t parentChunkIndex = chunks[chunkIndex].parentChunkIndex;
+				if (isInvalidIndex(parentChunkIndex) || chunkActorIndices[parentChunkIndex] != chunkActorIndices[chunkIndex])
+				{
+					visibleChunkIndex = chunkIndex;
+				}
+			}
+			state->visibleChunkIndices[i] = visibleChunkIndex;
+		}
+	}
+	break;
+	default:
+		NVBLAST_ASSERT(false);
+	}
+}
+
+
+uint32_t Actor::splitTasksSync(void* scratch)
+{
+	SplitTaskState* state = reinterpret_cast<SplitTaskState*>(scratch);
+	return state->phase != SplitTaskState::Done ? state->nextPhase() : 0;
+}
 
-	result->deletedActor = actorsCount == 0 ? nullptr : this;
+
+uint32_t Actor::splitTasksEnd(void* scratch, NvBlastLog logFn, NvBlastTimers* timers)
+{
+	SplitTaskState* state = reinterpret_cast<SplitTaskState*>(scratch);
+	NVBLASTLL_CHECK(state->phase == SplitTaskState::Done, logFn, "Actor::splitTasksEnd: not all split task phases were executed.", return 0);
+
+	if (state->graphNodeCount == 0 || state->newActorCount == 0)
+	{
+		// Split done in splitTasksBegin, or no split at all
+		return state->newActorCount;
+	}
+
+	Time time(timers != nullptr);
+
+	// Link visible chunks in reverse item order so the lists follow the item order
+	FamilyHeader* header = state->header;
+	Actor* actors = header->getActors();
+	IndexDLink<uint32_t>* visibleChunkIndexLinks = header->getVisibleChunkIndexLinks();
+	const uint32_t* chunkActorIndices = header->getChunkActorIndices();
+	for (uint32_t i = state->graphNodeCount + state->upperSupportChunkCount; i-- > 0;)
+	{
+		const uint32_t chunkIndex = state->visibleChunkIndices[i];
+		if (!isInvalidIndex(chunkIndex))
+		{
+			Actor& actor = actors[chunkActorIndices[chunkIndex]];
+			IndexDList<uint32_t>().insertListHead(actor.m_firstVisibleChunkIndex, visibleChunkIndexLinks, chunkIndex);
+			++actor.m_visibleChunkCount;
+		}
+	}
+
+	// Remove actors with no visible chunks - this can happen if we've split such that the world node is by itself
+	Actor** newActors = reinterpret_cast<Actor**>(state->result->newActors);
+	uint32_t actorsCount = removeInvisibleActors(header, newActors, state->newActorCount);
+
+	if (timers != nullptr)
+	{
+		timers->visibility += time.getElapsedTicks();
+	}
+
+	actorsCount = partitionBrittleActors(newActors, actorsCount, state->newActorsMaxCount, logFn);
+
+	if (timers != nullptr)
+	{
+		timers->partition += time.getElapsedTicks();
+	}
+
+	state->result->deletedActor = actorsCount == 0 ? nullptr : state->actor;
 
 	return actorsCount;
 }
-	
+
 	
 uint32_t Actor::findIslands(void* scratch)
 {
@@ -1002,6 +1536,97 @@ bool NvBlastActorCanFracture(const NvBlastActor* actor, NvBlastLog logFn)
 }
 
 
+size_t NvBlastActorBatchGetRequiredScratch(const NvBlastActorBatchDamage* damages, uint32_t damageCount, NvBlastLog logFn)
+{
+	NVBLASTLL_CHECK(damageCount == 0 || damages != nullptr, logFn, "NvBlastActorBatchGetRequiredScratch: NULL damages pointer input.", return 0);
+
+	return Nv::Blast::Actor::batchFractureRequiredScratch(damages, damageCount);
+}
+
+
+uint32_t NvBlastActorBatchFracture
+(
+	NvBlastActorBatchResult* results,
+	NvBlastFractureBuffers* eventBuffers,
+	NvBlastActor** newActors,
+	uint32_t newActorsMaxCount,
+	const NvBlastActorBatchDamage* damages,
+	uint32_t damageCount,
+	void* scratch,
+	NvBlastLog logFn,
+	NvBlastTimers* timers
+)
+{
+	NVBLASTLL_CHECK(damageCount == 0 || results != nullptr, logFn, "NvBlastActorBatchFracture: NULL results pointer input.", return 0);
+	NVBLASTLL_CHECK(damageCount == 0 || damages != nullptr, logFn, "NvBlastActorBatchFracture: NULL damages pointer input.", return 0);
+	NVBLASTLL_CHECK(scratch != nullptr, logFn, "NvBlastActorBatchFracture: NULL scratch pointer input.", return 0);
+
+	return Nv::Blast::Actor::batchFracture(results, eventBuffers, newActors, newActorsMaxCount, damages, damageCount, scratch, logFn, timers);
+}
+
+
+size_t NvBlastActorGetRequiredScratchForSplitTasks(const NvBlastActor* actor, uint32_t maxTaskCount, NvBlastLog logFn)
+{
+	NVBLASTLL_CHECK(actor != nullptr, logFn, "NvBlastActorGetRequiredScratchForSplitTasks: NULL actor input.", return 0);
+
+	const Nv::Blast::Actor& a = *static_cast<const Nv::Blast::Actor*>(actor);
+
+	if (!a.isActive())
+	{
+		NVBLASTLL_LOG_ERROR(logFn, "NvBlastActorGetRequiredScratchForSplitTasks: actor is not active.");
+		return 0;
+	}
+
+	return a.splitTasksRequiredScratch(maxTaskCount);
+}
+
+
+uint32_t NvBlastActorSplitTasksBegin
+(
+	NvBlastActorSplitEvent* result,
+	NvBlastActor* actor,
+	uint32_t newActorsMaxCount,
+	uint32_t maxTaskCount,
+	void* scratch,
+	NvBlastLog logFn,
+	NvBlastTimers* timers
+)
+{
+	NVBLASTLL_CHECK(scratch != nullptr, logFn, "NvBlastActorSplitTasksBegin: NULL scratch pointer input.", return 0);
+
+	// NvBlastActorSplitTasksEnd reports no new actors if the input is invalid
+	Nv::Blast::Actor::splitTasksInitDone(result, scratch);
+
+	NVBLASTLL_CHECK(result != nullptr, logFn, "NvBlastActorSplitTasksBegin: NULL result pointer input.", return 0);
+	NVBLASTLL_CHECK(newActorsMaxCount > 0 && result->newActors != nullptr, logFn, "NvBlastActorSplitTasksBegin: no space for results provided.", return 0);
+	NVBLASTLL_CHECK(actor != nullptr, logFn, "NvBlastActorSplitTasksBegin: NULL actor pointer input.", return 0);
+
+	Nv::Blast::Actor& a = *static_cast<Nv::Blast::Actor*>(actor);
+
+	return a.splitTasksBegin(result, newActorsMaxCount, maxTaskCount, scratch, logFn, timers);
+}
+
+
+void NvBlastActorSplitTaskExecute(void* scratch, uint32_t taskIndex)
+{
+	Nv::Blast::Actor::splitTaskExecute(scratch, taskIndex);
+}
+
+
+uint32_t NvBlastActorSplitTasksSync(void* scratch)
+{
+	return Nv::Blast::Actor::splitTasksSync(scratch);
+}
+
+
+uint32_t NvBlastActorSplitTasksEnd(void* scratch, NvBlastLog logFn, NvBlastTimers* timers)
+{
+	NVBLASTLL_CHECK(scratch != nullptr, logFn, "NvBlastActorSplitTasksEnd: NULL scratch pointer input.", return 0);
+
+	return Nv::Blast::Actor::splitTasksEnd(scratch, logFn, timers);
+}
+
+
 bool NvBlastActorIsBoundToWorld(const NvBlastActor* actor, NvBlastLog logFn)
 {
 	NVBLASTLL_CHECK(actor != nullptr, logFn, "NvBlastActorIsBoundToWorld: NULL actor input.", return false);
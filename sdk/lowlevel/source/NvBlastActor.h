@@ -365,6 +365,57 @@ public:
 	*/
 	uint32_t			split(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount, void* scratch, NvBlastLog logFn, NvBlastTimers* timers);
 
+	/**
+	The scratch space required to call the batchFracture function, in bytes.
+
+	\param[in] damages		The batch entries that will be passed into batchFracture.
+	\param[in] damageCount	The number of entries in the damages array.
+
+	\return the number of bytes required.
+	*/
+	static size_t		batchFractureRequiredScratch(const NvBlastActorBatchDamage* damages, uint32_t damageCount);
+
+	/**
+	See NvBlastActorBatchFracture
+	*/
+	static uint32_t		batchFracture(NvBlastActorBatchResult* results, NvBlastFractureBuffers* eventBuffers, NvBlastActor** newActors, uint32_t newActorsMaxCount,
+									  const NvBlastActorBatchDamage* damages, uint32_t damageCount, void* scratch, NvBlastLog logFn, NvBlastTimers* timers);
+
+	/**
+	The scratch space required to call the splitTasksBegin function, in bytes.
+
+	\param[in] maxTaskCount	The maximum number of tasks per phase that will be passed into splitTasksBegin.
+
+	\return the number of bytes required.
+	*/
+	size_t				splitTasksRequiredScratch(uint32_t maxTaskCount) const;
+
+	/**
+	See NvBlastActorSplitTasksBegin
+	*/
+	uint32_t			splitTasksBegin(NvBlastActorSplitEvent* result, uint32_t newActorsMaxCount, uint32_t maxTaskCount, void* scratch, NvBlastLog logFn, NvBlastTimers* timers);
+
+	/**
+	Initializes the split state in scratch as done with no new actors, so that splitTasksSync and splitTasksEnd are safe to call
+	when the split can't be started.
+	*/
+	static void			splitTasksInitDone(NvBlastActorSplitEvent* result, void* scratch);
+
+	/**
+	See NvBlastActorSplitTaskExecute
+	*/
+	static void			splitTaskExecute(void* scratch, uint32_t taskIndex);
+
+	/**
+	See NvBlastActorSplitTasksSync
+	*/
+	static uint32_t		splitTasksSync(void* scratch);
+
+	/**
+	See NvBlastActorSplitTasksEnd
+	*/
+	static uint32_t		splitTasksEnd(void* scratch, NvBlastLog logFn, NvBlastTimers* timers);
+
 	/**
 	Perform islands search.  Bonds which are broken when their health values drop to zero (or below) may lead
 	to new islands of chunks which need to be split into new actors.  This function labels all nodes in the instance
@@ -458,11 +458,7 @@ void FamilyHeader::applyFracture(NvBlastFractureBuffers* eventBuffers, const NvB
 	}
 #endif
 
-#if NV_PROFILE
-	Time time;
-#else
-	NV_UNUSED(timers);
-#endif
+	Time time(timers != nullptr);
 
 	//
 	// Chunk Fracture
@@ -569,12 +565,10 @@ void FamilyHeader::applyFracture(NvBlastFractureBuffers* eventBuffers, const NvB
 		}
 	}
 
-#if NV_PROFILE
 	if (timers != nullptr)
 	{
 		timers->fracture += time.getElapsedTicks();
 	}
-#endif
 
 }
 
@@ -135,7 +135,32 @@ void FamilyGraph::addToDirtyNodeList(ActorIndex actorIndex, NodeIndex node)
 
 
 /**
-Removes fast routes and marks involved nodes as dirty
+Fast routes of all nodes form a spanning forest of the graph: every island is a tree with island root node as its root.
+Removing an edge which is not part of this forest can't disconnect an island, so only tree edge removal breaks fast route
+and requires findIslands() to search for a new one. Returns true if edge was a tree edge.
+*/
+bool FamilyGraph::removeFastRouteEdge(NodeIndex node0, NodeIndex node1)
+{
+	NodeIndex* fastRoute = getFastRoute();
+
+	// broke fast route if it goes through this edge:
+	if (fastRoute[node0] == node1)
+	{
+		fastRoute[node0] = invalidIndex<uint32_t>();
+		return true;
+	}
+	if (fastRoute[node1] == node0)
+	{
+		fastRoute[node1] = invalidIndex<uint32_t>();
+		return true;
+	}
+
+	return false;
+}
+
+
+/**
+Removes fast routes and marks involved nodes as dirty if removed edge was a tree edge
 */
 bool FamilyGraph::notifyEdgeRemoved(ActorIndex actorIndex, NodeIndex node0, NodeIndex node1, const SupportGraph* graph)
 {
@@ -143,7 +168,6 @@ bool FamilyGraph::notifyEdgeRemoved(ActorIndex actorIndex, NodeIndex node0, Node
 	NVBLAST_ASSERT(node1 < graph->m_nodeCount);
 
 	// used internal data pointers
-	NodeIndex* fastRoute = getFastRoute();
 	const uint32_t* adjacencyPartition = graph->getAdjacencyPartition();
 	const uint32_t* adjacentBondIndices = graph->getAdjacentBondIndices();
 
@@ -158,15 +182,13 @@ bool FamilyGraph::notifyEdgeRemoved(ActorIndex actorIndex, NodeIndex node0, Node
 			// remove bond
 			getIsEdgeRemoved()->set(bondIndex);
 
-			// broke fast route if it goes through this edge:
-			if (fastRoute[node0] == node1)
-				fastRoute[node0] = invalidIndex<uint32_t>();
-			if (fastRoute[node1] == node0)
-				fastRoute[node1] = invalidIndex<uint32_t>();
-
-			// mark nodes dirty (add to list if doesn't exist)
-			addToDirtyNodeList(actorIndex, node0);
-			addToDirtyNodeList(actorIndex, node1);
+			// mark nodes dirty (add to list if doesn't exist) only if edge was part of fast route spanning forest,
+			// otherwise island is still connected through the forest and no search is needed
+			if (removeFastRouteEdge(node0, node1))
+			{
+				addToDirtyNodeList(actorIndex, node0);
+				addToDirtyNodeList(actorIndex, node1);
+			}
 
 			// we don't expect to be more than one bond between 2 nodes
 			return true;
@@ -184,18 +206,12 @@ bool FamilyGraph::notifyEdgeRemoved(ActorIndex actorIndex, NodeIndex node0, Node
 
 	getIsEdgeRemoved()->set(bondIndex);
 
-
-	NodeIndex* fastRoute = getFastRoute();
-
-	// broke fast route if it goes through this edge:
-	if (fastRoute[node0] == node1)
-		fastRoute[node0] = invalidIndex<uint32_t>();
-	if (fastRoute[node1] == node0)
-		fastRoute[node1] = invalidIndex<uint32_t>();
-
-	// mark nodes dirty (add to list if doesn't exist)
-	addToDirtyNodeList(actorIndex, node0);
-	addToDirtyNodeList(actorIndex, node1);
+	// mark nodes dirty (add to list if doesn't exist) only if edge was part of fast route spanning forest
+	if (removeFastRouteEdge(node0, node1))
+	{
+		addToDirtyNodeList(actorIndex, node0);
+		addToDirtyNodeList(actorIndex, node1);
+	}
 
 	return true;
 }
@@ -205,7 +221,6 @@ bool FamilyGraph::notifyNodeRemoved(ActorIndex actorIndex, NodeIndex nodeIndex,
 	NVBLAST_ASSERT(nodeIndex < graph->m_nodeCount);
 
 	// used internal data pointers
-	NodeIndex* fastRoute = getFastRoute();
 	const uint32_t* adjacencyPartition = graph->getAdjacencyPartition();
 	const uint32_t* adjacentBondIndices = graph->getAdjacentBondIndices();
 
@@ -218,12 +233,10 @@ bool FamilyGraph::notifyNodeRemoved(ActorIndex actorIndex, NodeIndex nodeIndex,
 			const uint32_t bondIndex = adjacentBondIndices[adjacencyIndex];
 			getIsEdgeRemoved()->set(bondIndex);
 
-			if (fastRoute[adjacentNodeIndex] == nodeIndex)
-				fastRoute[adjacentNodeIndex] = invalidIndex<uint32_t>();
-			if (fastRoute[nodeIndex] == adjacentNodeIndex)
-				fastRoute[nodeIndex] = invalidIndex<uint32_t>();
-
-			addToDirtyNodeList(actorIndex, adjacentNodeIndex);
+			if (removeFastRouteEdge(adjacentNodeIndex, nodeIndex))
+			{
+				addToDirtyNodeList(actorIndex, adjacentNodeIndex);
+			}
 		}
 	}
 	addToDirtyNodeList(actorIndex, nodeIndex);
@@ -94,7 +94,8 @@ public:
 	void			initialize(ActorIndex actorIndex, const SupportGraph* graph);
 
 	/**
-	Function to notify graph about removed edges. These nodes will be added to dirty list for this actor. Returns true if bond as removed.
+	Function to notify graph about removed edges. These nodes will be added to dirty list for this actor only if removed edge was part of
+	fast route spanning forest (see getFastRoute), other edges lie on cycles and can't disconnect an island. Returns true if bond as removed.
 
 	\param[in] actorIndex	The index of the actor from which the edge is removed. Must be in the range [0, m_nodeCount).
 	\param[in] node0		The index of the first node of removed edge. Must be in the range [0, m_nodeCount).
@@ -150,6 +151,7 @@ public:
 
 	/**
 	Utility function to get the start of the fast route array. This is an array of size nodeCount.
+	Every node's fast route points to the next node on its path to the island root node, so together they form a spanning forest of the graph.
 	*/
 	NvBlastBlockData(NodeIndex, m_fastRouteOffset, getFastRoute);
 
@@ -278,6 +280,12 @@ private:
 	*/
 	void			addToDirtyNodeList(ActorIndex actorIndex, NodeIndex node);
 
+	/**
+	Function to break fast route going through edge (node0, node1). Returns true if the edge was part of fast route spanning forest,
+	only then its removal can disconnect an island.
+	*/
+	bool			removeFastRouteEdge(NodeIndex node0, NodeIndex node1);
+
 	/**
 	Function used to get adjacentNode using index from adjacencyPartition with check for bondHealths (if it's not removed already)
 	*/
@@ -171,6 +171,9 @@ public:
 
 	It's the user's responsibility to keep programParams pointer alive until the group endProcess() call.
 
+	This function is not thread-safe and cannot be called while the group is processing.  To damage actors from other threads,
+	see TkGroup::submitDamage.
+
 	\param[in] program				A NvBlastDamageProgram containing damage shaders.
 	\param[in] programParams		Parameters for the NvBlastDamageProgram.
 	*/
@@ -71,10 +71,25 @@ struct TkEvent
 		FractureCommand,	//!< Sent when a TkActor generated fracture commands using TkActor::generateFracture.
 		FractureEvent,		//!< Sent when a TkActor is fractured using TkActor::applyFracture.
 		JointUpdate,		//!< Sent when TkJoints change their attachment state.  See TkJointUpdateEvent.
+		JointUpdateBatch,	//!< Sent instead of JointUpdate events by groups batching joint updates.  See TkJointUpdateBatchEvent.
 
 		TypeCount
 	};
 
+	/**
+	Event type bits, combined into the type mask of listeners to receive only some event types.  See TkFamily::addListener.
+	*/
+	enum TypeBit
+	{
+		SplitBit			= 1 << Split,
+		FractureCommandBit	= 1 << FractureCommand,
+		FractureEventBit	= 1 << FractureEvent,
+		JointUpdateBit		= 1 << JointUpdate,
+		JointUpdateBatchBit	= 1 << JointUpdateBatch,
+
+		AllTypes			= (1 << TypeCount) - 1
+	};
+
 	// Data
 	const void*	payload;	//!< Type-dependent payload data
 	Type		type;		//!< See the Type enum, above
@@ -89,6 +104,25 @@ struct TkEvent
 };
 
 
+/**
+Flat description of the children of a TkSplitEvent, see TkGroup::setSplitChildData.
+The arrays are only valid during the TkEventListener::receive call reporting the split event.
+
+For the child i, in [0, numChildren), its visible chunk indices are visibleChunkIndices[visibleChunkOffsets[i]]
+to visibleChunkIndices[visibleChunkOffsets[i+1]-1], and its graph node indices are graphNodeIndices[graphNodeOffsets[i]]
+to graphNodeIndices[graphNodeOffsets[i+1]-1].  They are given in the order TkActor::getVisibleChunkIndices and
+TkActor::getGraphNodeIndices would report them.
+*/
+struct TkSplitChildData
+{
+	const uint32_t*	childIndices;			//!< The indices of the children within their TkFamily, see TkActor::getIndex
+	const uint32_t*	visibleChunkOffsets;	//!< numChildren+1 offsets of every child's range in visibleChunkIndices
+	const uint32_t*	visibleChunkIndices;	//!< The visible chunk indices of all children, contiguous per child
+	const uint32_t*	graphNodeOffsets;		//!< numChildren+1 offsets of every child's range in graphNodeIndices
+	const uint32_t*	graphNodeIndices;		//!< The graph node indices of all children, contiguous per child
+};
+
+
 /**
 Payload for TkEvent::Split events
 
@@ -103,6 +137,8 @@ struct TkSplitEvent
 	TkActorData	parentData;		//!< The data of parent TkActor that was split
 	uint32_t	numChildren;	//!< The number of children into which the parent TkActor was split
 	TkActor**	children;		//!< An array of pointers to the children into which the TkActor was split
+
+	TkSplitChildData	childData;	//!< The children's indices, visible chunks and graph nodes in flat arrays, all NULL unless enabled with TkGroup::setSplitChildData
 };
 
 
@@ -161,6 +197,21 @@ struct TkJointUpdateEvent
 };
 
 
+/**
+Payload for the TkEvent::JointUpdateBatch events
+
+Sent by a TkGroup batching joint updates (see TkGroup::setJointUpdateEventBatching) once per family, holding all joint updates
+reported to the family in the group's processing, in place of individual TkJointUpdateEvent events.
+*/
+struct TkJointUpdateBatchEvent
+{
+	enum { EVENT_TYPE = TkEvent::JointUpdateBatch };
+
+	uint32_t					jointUpdateCount;	//!< The number of joint updates
+	const TkJointUpdateEvent*	jointUpdates;		//!< The joint updates, as they would be reported by individual TkJointUpdateEvent events
+};
+
+
 /**
 Interface for a listener of TkEvent data.  The user must implement this interface and pass it
 to the object which will dispatch the events.
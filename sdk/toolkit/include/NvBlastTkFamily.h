@@ -92,9 +92,15 @@ public:
 	all split and fracture events generated by TkActor objects in this family.  They will also receive joint update events
 	when TkJoint objects are updated that are (or were) associated with a TkActor in this family.
 
+	A listener may restrict the events it receives to some types with a mask of TkEvent::TypeBit values.  The events are then
+	sorted by type once per dispatch for all such listeners, and each of them receives contiguous spans of the types it
+	listens to, in TkEvent::Type order.  Events of the same type keep their order.  Listeners of all types receive all events
+	in their original order, in a single call.
+
 	\param[in]	l			The event listener to add.
+	\param[in]	typeMask	The event types to send to the listener, a combination of TkEvent::TypeBit values.
 	*/
-	virtual void					addListener(TkEventListener& l) = 0;
+	virtual void					addListener(TkEventListener& l, uint32_t typeMask = TkEvent::AllTypes) = 0;
 
 	/**
 	Remove a TkEventReciever from this family's list of listeners.
@@ -30,6 +30,7 @@
 #define NVBLASTTKGROUP_H
 
 #include "NvBlastTkIdentifiable.h"
+#include "NvBlastTypes.h"
 
 
 namespace Nv
@@ -52,14 +53,73 @@ struct TkGroupDesc
 
 
 /**
-Used to collect internal counters using TkGroup::getStats (for profile builds only)
-@see TkGroup::getStats()
+Time spent processing a subset of a group's actors, split in phases.  Units are ticks, see NvBlastTimers.
+@see TkGroupStats
+*/
+struct TkGroupPhaseStats
+{
+	NvBlastTimers	timers;			//!< Time spent in blast low-level functions: material, fracture, island, partition and visibility
+	int64_t			eventFill;		//!< Time spent filling fracture command, fracture and split events
+	int64_t			splitMemory;	//!< Time spent reserving memory for the new actors of splits
+	int64_t			total;			//!< Time spent processing the actors, including the phases above
+	uint32_t		actorCount;		//!< Number of processed actors
+};
+
+
+/**
+Used to collect internal counters using TkGroup::getStats, filled when phase timers are enabled.
+@see TkGroup::getStats(), TkGroup::setPhaseTimers()
 */
 struct TkGroupStats
 {
 	NvBlastTimers	timers;					//!< Accumulated time spent in blast low-level functions, see NvBlastTimers
 	uint32_t		processedActorsCount;	//!< Accumulated number of processed actors in all TkWorker
-	int64_t			workerTime;				//!< Accumulated time spent executing TkWorker::run. Unit is ticks, see NvBlastTimers.
+	int64_t			workerTime;				//!< Accumulated time spent processing actors in all TkWorker. Unit is ticks, see NvBlastTimers.
+	int64_t			eventFill;				//!< Accumulated time spent filling events, see TkGroupPhaseStats::eventFill
+	int64_t			splitMemory;			//!< Accumulated time spent reserving split memory, see TkGroupPhaseStats::splitMemory
+
+	enum { SizeBucketCount = 8 };
+
+	/**
+	Phase times per actor size, where actors are bucketed by their graph node count when processed:
+	bucket i holds the actors with [4^i, 4^(i+1)) graph nodes, bucket 0 includes the actors without graph nodes
+	and the last bucket all the larger actors.  See getSizeBucket().
+	*/
+	TkGroupPhaseStats			sizeBuckets[SizeBucketCount];
+
+	const TkGroupPhaseStats*	workers;		//!< Phase times of each worker, valid until the group is released or the worker count changes
+	uint32_t					workerCount;	//!< Number of entries in workers
+
+	/**
+	\param[in]	graphNodeCount	The number of graph nodes of an actor.
+
+	\return the index of the sizeBuckets entry an actor with graphNodeCount graph nodes is accounted in.
+	*/
+	static uint32_t	getSizeBucket(uint32_t graphNodeCount)
+	{
+		uint32_t bucket = 0;
+		while (graphNodeCount >= 4 && bucket < SizeBucketCount - 1)
+		{
+			graphNodeCount >>= 2;
+			bucket++;
+		}
+		return bucket;
+	}
+};
+
+
+/**
+Counters describing the memory pooled by a group for processing, available in all builds.
+@see TkGroup::getMemoryStats()
+*/
+struct TkGroupMemoryStats
+{
+	uint32_t		arenaBlockCount;		//!< Memory blocks kept by the workers for fracture event data, beyond the group's preallocated blocks
+	size_t			arenaSize;				//!< Size in bytes of the blocks kept by the workers
+	size_t			arenaUsedSize;			//!< Size in bytes of the worker blocks used by the last processing
+	uint32_t		arenaAllocationCount;	//!< Number of worker blocks allocated by the last processing, zero once the pool has grown to fit
+	uint32_t		newActorCount;			//!< Number of entries used in the families' preallocated split buffers by the last processing
+	size_t			eventDataPoolSize;		//!< Size in bytes of event payload memory kept by the families in this group, see TkGroup::setEventDataPoolLimit
 };
 
 
@@ -83,6 +143,49 @@ public:
 };
 
 
+/**
+Task interface used by TkGroup::process(TkGroupTaskRunner&) to run group jobs on the user's threads.
+*/
+class TkGroupTaskRunner
+{
+public:
+	/**
+	Work split in tasks, implemented by the group.
+	*/
+	class Tasks
+	{
+	public:
+		/**
+		Execute one task.  Must be called exactly once for every taskIndex in [0, taskCount) of the run() call.
+
+		\param[in]	taskIndex		The index of the task to execute.
+		*/
+		virtual void	execute(uint32_t taskIndex) = 0;
+
+	protected:
+		virtual			~Tasks() {}
+	};
+
+	/**
+	The maximum number of tasks to be passed into a single run() call, typically the number of worker threads.
+
+	\return the maximum task count.
+	*/
+	virtual uint32_t	getMaxTaskCount() const = 0;
+
+	/**
+	Execute tasks, possibly concurrently, and return after all of them completed.
+
+	\param[in]	tasks			The tasks to execute.
+	\param[in]	taskCount		The number of tasks, at most getMaxTaskCount().
+	*/
+	virtual void		run(Tasks& tasks, uint32_t taskCount) = 0;
+
+protected:
+	virtual				~TkGroupTaskRunner() {}
+};
+
+
 /**
 A group is a processing unit, to which the user may add TkActors.  New actors generated from splitting a TkActor
 are automatically put into the same group.  However, any actor may be removed from its group and placed into
@@ -97,6 +200,10 @@ Each concurrent thread uses an acquired TkGroupWorker to process the jobs.
 Over the whole procedure, each job must be processed once and only once.  
 Jobs can be processed in any order.  TkGroupWorkers can be returned and acquired later by another task.
 After processing every job and returning all the workers to the group, endProcess concludes the procedure.
+
+Jobs are ordered by decreasing estimated cost (see getJobCost), so that handing out job ids in increasing order
+starts the most expensive actors first.  Alternatively, process(TkGroupTaskRunner&) does all of the above, distributing
+the jobs over the runner's tasks.
 */
 class TkGroup : public TkIdentifiable
 {
@@ -148,6 +255,17 @@ public:
 	*/
 	virtual bool			endProcess() = 0;
 
+	/**
+	The estimated cost of processing a job, available between startProcess() and endProcess().
+	The estimate is the actor's graph node count times the number of damage requests queued on it.
+	Jobs are ordered by decreasing cost.
+
+	\param[in]	jobId	a job id in the range [0, startProcess())
+
+	\return the estimated cost of the job, or 0 if jobId is not valid.
+	*/
+	virtual uint64_t		getJobCost(uint32_t jobId) const = 0;
+
 	/**
 	Set the expected number of concurrent worker threads that will process this group concurrently.
 	*/
@@ -158,6 +276,110 @@ public:
 	*/
 	virtual uint32_t		getWorkerCount() const = 0;
 
+	/**
+	Limit the event payload memory kept for reuse by this group between processing cycles, per family in the group.
+	Payload memory is recycled across startProcess()/endProcess() cycles to avoid allocations in steady state.
+	Memory exceeding the limit is freed at the end of each cycle.
+
+	\param[in]	limit	The limit in bytes. A limit of 0 (default) keeps all memory.
+	*/
+	virtual void			setEventDataPoolLimit(size_t limit) = 0;
+
+	/**
+	\return The event payload memory limit set with setEventDataPoolLimit().
+	*/
+	virtual size_t			getEventDataPoolLimit() const = 0;
+
+	/**
+	Enable or disable damage coalescing, disabled by default.
+
+	Without coalescing, every damage request queued on an actor with TkActor::damage is fractured separately, and reported
+	with its own TkFractureCommands and TkFractureEvents.  With coalescing, consecutive damage requests on an actor using
+	the same damage program are merged: the fracture commands of all of them are generated on the actor as it was before
+	any is applied, the damage is summed per bond and chunk, and the result is applied once and reported with a single
+	TkFractureCommands and TkFractureEvents pair.
+
+	\param[in]	enabled	true to coalesce damage on the actors processed by this group.
+	*/
+	virtual void			setDamageCoalescing(bool enabled) = 0;
+
+	/**
+	\return true if damage coalescing is enabled, see setDamageCoalescing().
+	*/
+	virtual bool			getDamageCoalescing() const = 0;
+
+	/**
+	Submit damage to an actor in this group.  Unlike TkActor::damage, this function is thread-safe and lock-free, and it may be
+	called at any time, including while the group is processing.
+
+	Submitted damage is collected in the group's damage inbox and queued on the actors at the next startProcess(), in the order
+	it was submitted.  Damage submitted while the group is processing is therefore fractured in the next processing cycle.
+	Damage on an actor which is inactive or not in this group anymore by then is discarded.  Actors may be split in the meantime,
+	in which case the damage goes to the new actor which inherited the submitted actor's index.  The group pools the memory of
+	submitted damage, growing the pool at startProcess() when it ran out, so submitting does not allocate once the pool fits a frame.
+
+	It's the user's responsibility to keep the actor's family alive until the damage is queued or discarded, and to keep the
+	programParams pointer alive until the endProcess() call following the startProcess() which queued the damage.
+
+	\param[in]	actor			The actor to damage, which must be in this group.
+	\param[in]	program			A NvBlastDamageProgram containing damage shaders.
+	\param[in]	programParams	Parameters for the NvBlastDamageProgram.
+	*/
+	virtual void			submitDamage(TkActor& actor, const NvBlastDamageProgram& program, const void* programParams) = 0;
+
+	/**
+	Enable or disable batched joint update events, disabled by default.
+
+	Without batching, the joints of each actor split by this group are updated after the actor in endProcess(), and every joint
+	change is reported with a TkJointUpdateEvent to the split actor's family.  With batching, the joints attached to all the split
+	actors are updated together, each joint once, the new actors they attach to are found in parallel when the group is processed
+	with process(TkGroupTaskRunner&), and the changes are reported with a single TkJointUpdateBatchEvent per family instead.
+
+	\param[in]	enabled	true to report joint updates with TkJointUpdateBatchEvent.
+	*/
+	virtual void			setJointUpdateEventBatching(bool enabled) = 0;
+
+	/**
+	\return true if joint update events are batched, see setJointUpdateEventBatching().
+	*/
+	virtual bool			getJointUpdateEventBatching() const = 0;
+
+	/**
+	Enable or disable the flat split child data, disabled by default.
+
+	When enabled, the TkSplitEvent of every actor split by this group's workers carries TkSplitChildData: the children's
+	indices, visible chunk indices and graph node indices in contiguous arrays, gathered by the workers while splitting.
+	This saves consumers of many split events from querying every child with TkActor::getVisibleChunkIndices and
+	TkActor::getGraphNodeIndices.  The arrays are only valid during the TkEventListener::receive call reporting the split
+	event: the workers recycle their memory as soon as endProcess() has dispatched the events.  Copy what is needed later.
+
+	Split events sent by TkFamily::reinitialize do not carry this data.
+
+	\param[in]	enabled	true to fill TkSplitEvent::childData.
+	*/
+	virtual void			setSplitChildData(bool enabled) = 0;
+
+	/**
+	\return true if split events carry flat child data, see setSplitChildData().
+	*/
+	virtual bool			getSplitChildData() const = 0;
+
+	/**
+	Enable or disable the phase timers reported by getStats(), enabled by default in profile builds only.
+
+	When enabled, the workers time the phases of every actor they process (material, fracture, island, partition,
+	visibility, event fill and split memory) and endProcess() accumulates them in total, per worker and per actor size.
+	This is available in all builds.  The cost is a few clock reads per processed actor; when disabled no clock is read.
+
+	\param[in]	enabled	true to time the processing phases.
+	*/
+	virtual void			setPhaseTimers(bool enabled) = 0;
+
+	/**
+	\return true if the processing phases are timed, see setPhaseTimers().
+	*/
+	virtual bool			getPhaseTimers() const = 0;
+
 	/**
 	Acquire one worker to process the group concurrently on a thread.
 	The worker must be returned with returnWorker() before endProcess() is called on its group.
@@ -179,12 +401,32 @@ public:
             void			process();
 
 	/**
-	For profile builds only, request stats of the last successful processing. Inactive in other builds.
-	The times and counters reported account for all the TkWorker (accumulated) taking part in the processing.
+	Process the group with the tasks of a task runner, from startProcess() to endProcess().
+	The jobs are dealt to the tasks most expensive first, and tasks running out of jobs take over jobs dealt to other tasks.
+	The worker count is raised to the number of tasks used if it is smaller.
+
+	\param[in]	taskRunner	The task runner executing the group's tasks.
+
+	\return the number of jobs processed.
+	*/
+	virtual uint32_t		process(TkGroupTaskRunner& taskRunner) = 0;
+
+	/**
+	Request stats of the last successful processing with phase timers enabled, see setPhaseTimers().
+	The times and counters reported account for all the TkWorker (accumulated) taking part in the processing,
+	and are broken down per worker and per actor size.
 
 	\param[in]	stats	The struct to be filled in.
 	*/
 	virtual void			getStats(TkGroupStats& stats) const = 0;
+
+	/**
+	Request the counters of the memory pooled by this group, as of the last processing.
+	Unlike getStats(), this does not require phase timers.
+
+	\param[in]	stats	The struct to be filled in.
+	*/
+	virtual void			getMemoryStats(TkGroupMemoryStats& stats) const = 0;
 };
 
 } // namespace Blast
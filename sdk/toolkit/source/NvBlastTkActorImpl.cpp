@@ -101,9 +101,7 @@ TkActorImpl::TkActorImpl()
 	, m_flags(0)
 	, m_jointCount(0)
 {
-#if NV_PROFILE
 	NvBlastTimersReset(&m_timers);
-#endif
 }
 
 
@@ -315,7 +313,8 @@ void TkActorImpl::generateFracture(NvBlastFractureBuffers* commands, const NvBla
 	}
 
 	// const context, must make m_timers mutable otherwise
-	NvBlastActorGenerateFracture(commands, m_actorLL, program, programParams, logLL, const_cast<NvBlastTimers*>(&m_timers));
+	NvBlastTimers* timers = m_group != nullptr && m_group->getPhaseTimers() ? const_cast<NvBlastTimers*>(&m_timers) : nullptr;
+	NvBlastActorGenerateFracture(commands, m_actorLL, program, programParams, logLL, timers);
 }
 
 
@@ -329,7 +328,8 @@ void TkActorImpl::applyFracture(NvBlastFractureBuffers* eventBuffers, const NvBl
 		return;
 	}
 
-	NvBlastActorApplyFracture(eventBuffers, m_actorLL, commands, logLL, &m_timers);
+	NvBlastTimers* timers = m_group != nullptr && m_group->getPhaseTimers() ? &m_timers : nullptr;
+	NvBlastActorApplyFracture(eventBuffers, m_actorLL, commands, logLL, timers);
 
 	if (commands->chunkFractureCount > 0 || commands->bondFractureCount > 0)
 	{
@@ -244,9 +244,7 @@ private:
 	uint32_t								m_jointCount;		  //!< The number of joints referenced in m_jointList
 	DList									m_jointList;		  //!< A doubly-linked list of joint references
 
-//#if NV_PROFILE
-	NvBlastTimers							m_timers;			//!< If profiling, each actor stores timing data
-//#endif
+	NvBlastTimers							m_timers;			//!< With the group's phase timers, each actor stores timing data of direct fractures
 
 	friend class TkWorker;					// m_damageBuffer and m_flags 
 	friend class TkGroupImpl;
@@ -57,11 +57,20 @@ Typical usage:
 
 - continue adding events and payload on main thread if necessary like above (allocations are safe here)
 eventually dispatch, or reset if dispatched by proxy
+
+Payload memory is kept in pages which are recycled by reset() rather than freed. Newly allocated pages are sized to at least
+the largest amount of payload data seen in a single cycle (high-water mark), so that in steady state every cycle is served
+by pages allocated in earlier cycles. setDataPoolLimit() optionally caps the memory retained between cycles.
 */
 class TkEventQueue
 {
 public:
-	TkEventQueue() : m_currentEvent(0), m_poolCapacity(0), m_pool(nullptr), m_allowAllocs(true) {}
+	TkEventQueue() : m_currentEvent(0), m_currentData(0), m_poolCapacity(0), m_pool(nullptr), m_usedDataSize(0), m_highWaterMark(0), m_dataPoolLimit(0), m_allowAllocs(true) {}
+
+	~TkEventQueue()
+	{
+		releaseData();
+	}
 
 	/**
 	Peek events queue for dispatch.
@@ -92,21 +101,74 @@ public:
 
 	/**
 	Restores initial state.
-	Data memory is currently not being reused. To be improved.
+	Payload pages used in this cycle are kept for reuse, see setDataPoolLimit().
 	*/
 	void reset()
 	{
 		m_events.clear();
 		m_currentEvent = 0;
-		for (void* mem : m_memory)
+
+		retirePool();
+		m_highWaterMark = std::max(m_highWaterMark, m_usedDataSize);
+		m_usedDataSize = 0;
+		if (m_usedPages.size() > 1)
 		{
-			NVBLAST_FREE(mem);
+			// The payload overflowed into several pages, replace them by a single page of high-water mark size later.
+			for (const DataPage& page : m_usedPages)
+			{
+				NVBLAST_FREE(page.memory);
+			}
 		}
-		m_memory.clear();
-		m_currentData = 0;
+		else
+		{
+			for (const DataPage& page : m_usedPages)
+			{
+				m_freePages.pushBack(page);
+			}
+		}
+		m_usedPages.clear();
+		if (m_dataPoolLimit > 0)
+		{
+			trimFreePages(m_dataPoolLimit);
+		}
+
 		m_allowAllocs = true;
-		m_poolCapacity = 0;
-		m_pool = nullptr;
+	}
+
+	/**
+	Free all payload pages and forget the high-water mark.
+	Must not be called while payload data is still referenced.
+	*/
+	void releaseData()
+	{
+		NVBLAST_ASSERT(m_allowAllocs);
+		reset();
+		trimFreePages(0);
+		m_freePages.reset();
+		m_usedPages.reset();
+		m_sortedEvents.reset();
+		m_highWaterMark = 0;
+	}
+
+	/**
+	Limit the amount of payload memory (in bytes) kept for reuse between cycles.
+	Pages exceeding the limit are freed on reset(). A limit of 0 (default) keeps all pages.
+	*/
+	void setDataPoolLimit(size_t limit)
+	{
+		m_dataPoolLimit = limit;
+		if (limit > 0)
+		{
+			trimFreePages(limit);
+		}
+	}
+
+	/**
+	The amount of payload memory (in bytes) currently owned by this queue, in use or pooled.
+	*/
+	size_t getDataPoolSize() const
+	{
+		return getPagesSize(m_usedPages) + getPagesSize(m_freePages);
 	}
 
 	/**
@@ -132,36 +194,42 @@ public:
 	}
 
 	/**
-	Request storage for payload.
+	Request storage for payload, an array of count elements.
 	*/
 	template<typename T>
-	T* allocData()
+	T* allocData(uint32_t count = 1)
 	{
-		uint32_t index = m_currentData.fetch_add(sizeof(T));
+		const uint32_t size = count * sizeof(T);
+		uint32_t index = m_currentData.fetch_add(size);
 		if (m_currentData <= m_poolCapacity)
 		{
 			return reinterpret_cast<T*>(&m_pool[index]);
 		}
 		else
 		{
-			// Could do larger block allocation here.
-			reserveData(sizeof(T));
+			// The new page is sized to the high-water mark, subsequent requests will fit.
+			reserveData(size);
 			// Account for the requested size.
-			m_currentData = sizeof(T);
+			m_currentData = size;
 			return reinterpret_cast<T*>(&m_pool[0]);
 		}
 	}
 
 	/**
-	Preallocate a memory block of size Bytes for payload data.
-	Note that this will inevitably allocate a new memory block.
+	Provide a memory block of at least size Bytes for payload data.
+	A pooled page is used if one is large enough, otherwise a new page is allocated.
 	Subsequent calls to allocData will use this memory piecewise.
 	*/
 	void reserveData(size_t size)
 	{
 		NVBLAST_ASSERT(m_allowAllocs);
-		m_pool = reinterpret_cast<uint8_t*>(allocDataBySize(size));
-		m_poolCapacity = size;
+		retirePool();
+		if (size > 0)
+		{
+			const DataPage& page = acquirePage(size);
+			m_pool = page.memory;
+			m_poolCapacity = page.size;
+		}
 		m_currentData = 0;
 	}
 
@@ -175,11 +243,12 @@ public:
 	}
 
 	/**
-	Add a listener to dispatch to.
+	Add a listener to dispatch the event types of typeMask to, see TkEvent::TypeBit.
 	*/
-	void addListener(TkEventListener& l)
+	void addListener(TkEventListener& l, uint32_t typeMask = TkEvent::AllTypes)
 	{
-		m_listeners.pushBack(&l);
+		Listener listener = { &l, typeMask & TkEvent::AllTypes };
+		m_listeners.pushBack(listener);
 	}
 
 	/**
@@ -187,7 +256,14 @@ public:
 	*/
 	void removeListener(TkEventListener& l)
 	{
-		m_listeners.findAndReplaceWithLast(&l);
+		for (uint32_t i = 0; i < m_listeners.size(); i++)
+		{
+			if (m_listeners[i].listener == &l)
+			{
+				m_listeners.replaceWithLast(i);
+				return;
+			}
+		}
 	}
 
 	/**
@@ -202,43 +278,202 @@ public:
 
 	/**
 	Proxy function to dispatch events to this queue's listeners.
+	Listeners of all types receive the events as they are. The events are sorted by type once for the other listeners,
+	which receive the spans of the types they listen to.
 	*/
-	void dispatch(const Array<TkEvent>::type& events) const
+	void dispatch(const Array<TkEvent>::type& events)
 	{
 		if (events.size())
 		{
-			for (TkEventListener* l : m_listeners)
+			uint32_t typeOffsets[TkEvent::TypeCount + 1];
+			bool sorted = false;
+
+			for (const Listener& l : m_listeners)
 			{
 				BLAST_PROFILE_SCOPE_M("TkEventQueue::dispatch");
-				l->receive(events.begin(), events.size());
+
+				if (l.typeMask == TkEvent::AllTypes)
+				{
+					l.listener->receive(events.begin(), events.size());
+					continue;
+				}
+
+				if (!sorted)
+				{
+					sortByType(events, typeOffsets);
+					sorted = true;
+				}
+
+				// merge the spans of the listener's types, separated by empty spans only
+				uint32_t spanBegin = 0, spanEnd = 0;
+				for (uint32_t type = 0; type < TkEvent::TypeCount; type++)
+				{
+					if (l.typeMask & (1 << type))
+					{
+						if (spanBegin == spanEnd)
+						{
+							spanBegin = typeOffsets[type];
+						}
+						spanEnd = typeOffsets[type + 1];
+					}
+					else if (typeOffsets[type] < typeOffsets[type + 1])
+					{
+						if (spanBegin < spanEnd)
+						{
+							l.listener->receive(&m_sortedEvents[spanBegin], spanEnd - spanBegin);
+						}
+						spanBegin = spanEnd = 0;
+					}
+				}
+				if (spanBegin < spanEnd)
+				{
+					l.listener->receive(&m_sortedEvents[spanBegin], spanEnd - spanBegin);
+				}
 			}
 		}
 	}
 
 private:
 	/**
-	Allocates and stores a block of size Bytes of payload data.
+	A registered listener and the event types it receives.
 	*/
-	void* allocDataBySize(size_t size)
+	struct Listener
 	{
-		void* memory = nullptr;
-		if (size > 0)
+		TkEventListener*	listener;
+		uint32_t			typeMask;
+	};
+
+	/**
+	Stable sort of events by type into m_sortedEvents.
+	The events of type t are found in [typeOffsets[t], typeOffsets[t+1]).
+	*/
+	void sortByType(const Array<TkEvent>::type& events, uint32_t* typeOffsets)
+	{
+		memset(typeOffsets, 0, (TkEvent::TypeCount + 1) * sizeof(uint32_t));
+		for (const TkEvent& e : events)
+		{
+			typeOffsets[e.type + 1]++;
+		}
+		for (uint32_t type = 0; type < TkEvent::TypeCount; type++)
+		{
+			typeOffsets[type + 1] += typeOffsets[type];
+		}
+
+		uint32_t insertOffsets[TkEvent::TypeCount];
+		memcpy(insertOffsets, typeOffsets, TkEvent::TypeCount * sizeof(uint32_t));
+		m_sortedEvents.resizeUninitialized(events.size());
+		for (const TkEvent& e : events)
+		{
+			m_sortedEvents[insertOffsets[e.type]++] = e;
+		}
+	}
+
+	/**
+	A block of payload memory.
+	*/
+	struct DataPage
+	{
+		uint8_t*	memory;
+		size_t		size;
+	};
+
+	/**
+	Stop using the current memory block, accounting for the data it holds.
+	*/
+	void retirePool()
+	{
+		if (m_pool != nullptr)
+		{
+			m_usedDataSize += std::min<size_t>(m_currentData, m_poolCapacity);
+		}
+		m_pool = nullptr;
+		m_poolCapacity = 0;
+		m_currentData = 0;
+	}
+
+	/**
+	Move the smallest pooled page of at least size Bytes to the used pages,
+	or allocate a new one sized to the high-water mark if none fits. Outgrown pooled pages are freed in this case.
+	*/
+	const DataPage& acquirePage(size_t size)
+	{
+		uint32_t bestIndex = m_freePages.size();
+		for (uint32_t i = 0; i < m_freePages.size(); i++)
+		{
+			if (m_freePages[i].size >= size && (bestIndex == m_freePages.size() || m_freePages[i].size < m_freePages[bestIndex].size))
+			{
+				bestIndex = i;
+			}
+		}
+
+		if (bestIndex < m_freePages.size())
+		{
+			m_usedPages.pushBack(m_freePages[bestIndex]);
+			m_freePages.replaceWithLast(bestIndex);
+		}
+		else
+		{
+			for (const DataPage& page : m_freePages)
+			{
+				NVBLAST_FREE(page.memory);
+			}
+			m_freePages.clear();
+
+			DataPage page;
+			page.size = std::max(size, m_highWaterMark);
+			page.memory = reinterpret_cast<uint8_t*>(NVBLAST_ALLOC_NAMED(page.size, "TkEventQueue Data"));
+			m_usedPages.pushBack(page);
+		}
+
+		return m_usedPages.back();
+	}
+
+	/**
+	Free pooled pages, smallest first, until the pooled memory does not exceed limit Bytes.
+	*/
+	void trimFreePages(size_t limit)
+	{
+		size_t pooledSize = getPagesSize(m_freePages);
+		while (m_freePages.size() > 0 && pooledSize > limit)
+		{
+			uint32_t smallest = 0;
+			for (uint32_t i = 1; i < m_freePages.size(); i++)
+			{
+				if (m_freePages[i].size < m_freePages[smallest].size)
+				{
+					smallest = i;
+				}
+			}
+			pooledSize -= m_freePages[smallest].size;
+			NVBLAST_FREE(m_freePages[smallest].memory);
+			m_freePages.replaceWithLast(smallest);
+		}
+	}
+
+	static size_t getPagesSize(const Array<DataPage>::type& pages)
+	{
+		size_t size = 0;
+		for (const DataPage& page : pages)
 		{
-			memory = NVBLAST_ALLOC_NAMED(size, "TkEventQueue Data");
-			m_memory.pushBack(memory);
+			size += page.size;
 		}
-		return memory;
+		return size;
 	}
 
 
 	Array<TkEvent>::type					m_events;		//!< holds events
-	Array<void*>::type						m_memory;		//!< holds allocated data memory blocks
+	Array<TkEvent>::type					m_sortedEvents;	//!< events sorted by type, for listeners of some types
+	Array<DataPage>::type					m_usedPages;	//!< payload pages handed out since the last reset
+	Array<DataPage>::type					m_freePages;	//!< payload pages available for reuse
 	std::atomic<uint32_t>					m_currentEvent;	//!< reference index for event insertion
 	std::atomic<uint32_t>					m_currentData;	//!< reference index for data insertion
 	size_t									m_poolCapacity;	//!< size of the currently active memory block (m_pool)
 	uint8_t*								m_pool;			//!< the current memory block allocData() uses
+	size_t									m_usedDataSize;	//!< payload bytes used in retired blocks since the last reset
+	size_t									m_highWaterMark;//!< largest payload size used in a single cycle, minimum size for new pages
+	size_t									m_dataPoolLimit;//!< maximum size of pooled pages kept over reset, 0 for unlimited
 	bool									m_allowAllocs;	//!< assert guard
-	InlineArray<TkEventListener*,4>::type	m_listeners;	//!< objects to dispatch to
+	InlineArray<Listener,4>::type			m_listeners;	//!< objects to dispatch to
 };
 
 }	// namespace Blast
@@ -212,6 +212,7 @@ void TkFamilyImpl::reinitialize(const NvBlastFamily* newFamily, TkGroup* group)
 	Array<TkActor*>::type children(actorCount);
 	children.resizeUninitialized(0);
 	newActorsSplitEvent->children = children.begin();
+	memset(&newActorsSplitEvent->childData, 0, sizeof(TkSplitChildData));
 
 	// scratch
 	Array<uint32_t>::type scratch(m_asset->getChunkCount());
@@ -233,6 +234,7 @@ void TkFamilyImpl::reinitialize(const NvBlastFamily* newFamily, TkGroup* group)
 				removeSplitEvent->numChildren = 0;
 				removeSplitEvent->parentData.userData = tkActor.userData;
 				removeSplitEvent->parentData.index = tkActor.getIndex();
+				memset(&removeSplitEvent->childData, 0, sizeof(TkSplitChildData));
 				getQueue().addEvent(removeSplitEvent);
 			}
 
@@ -276,6 +278,7 @@ void TkFamilyImpl::reinitialize(const NvBlastFamily* newFamily, TkGroup* group)
 			removeSplitEvent->numChildren = 0;
 			removeSplitEvent->parentData.userData = tkActor.userData;
 			removeSplitEvent->parentData.index = tkActor.getIndex();
+			memset(&removeSplitEvent->childData, 0, sizeof(TkSplitChildData));
 			getQueue().addEvent(removeSplitEvent);
 
 			tkActor.m_actorLL = nullptr;
@@ -422,25 +425,18 @@ void TkFamilyImpl::applyFractureInternal(const NvBlastFractureBuffers* commands)
 void TkFamilyImpl::updateJoints(TkActorImpl* actor, TkEventQueue* alternateQueue)
 {
 	// Copy joint array for safety against implementation of joint->setActor
-	TkJointImpl** joints = reinterpret_cast<TkJointImpl**>(NvBlastAlloca(sizeof(TkJointImpl*)*actor->getJointCountInternal()));
-	TkJointImpl** stop = joints + actor->getJointCountInternal();
-	TkJointImpl** jointHandle = joints;
+	// the copy is local to the call, an actor's joints usually fit in the inline storage
+	InlineArray<TkJointImpl*, 16>::type joints;
+	joints.reserve(actor->getJointCountInternal());
 	for (TkActorImpl::JointIt j(*actor); (bool)j; ++j)
 	{
-		*jointHandle++ = *j;
+		joints.pushBack(*j);
 	}
-	jointHandle = joints;
-	while (jointHandle < stop)
+	for (TkJointImpl* joint : joints)
 	{
-		TkJointImpl* joint = *jointHandle++;
-		
-		const TkJointData& data = joint->getDataInternal();
-
-		TkActorImpl* actor0 = data.actors[0] != nullptr ?
-			static_cast<TkActorImpl&>(*data.actors[0]).getFamilyImpl().getActorByChunk(data.chunkIndices[0]) : nullptr;
-
-		TkActorImpl* actor1 = data.actors[1] != nullptr ?
-			static_cast<TkActorImpl&>(*data.actors[1]).getFamilyImpl().getActorByChunk(data.chunkIndices[1]) : nullptr;
+		TkActorImpl* actor0;
+		TkActorImpl* actor1;
+		joint->findSplitActors(actor0, actor1);
 
 		joint->setActors(actor0, actor1, alternateQueue);
 	}
@@ -73,7 +73,7 @@ public:
 
 	virtual uint32_t				getActors(TkActor** buffer, uint32_t bufferSize, uint32_t indexStart = 0) const override;
 
-	virtual void					addListener(TkEventListener& l) override { m_queue.addListener(l); }
+	virtual void					addListener(TkEventListener& l, uint32_t typeMask) override { m_queue.addListener(l, typeMask); }
 
 	virtual void					removeListener(TkEventListener& l) override { m_queue.removeListener(l); }
 
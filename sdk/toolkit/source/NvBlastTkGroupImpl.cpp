@@ -36,11 +36,13 @@
 #include "NvBlastTkActorImpl.h"
 #include "NvBlastTkFamilyImpl.h"
 #include "NvBlastTkAssetImpl.h"
+#include "NvBlastTkJointImpl.h"
 #include "NvBlastTkTaskImpl.h"
 
 #undef max
 #undef min
 #include <algorithm>
+#include <new>
 
 using namespace physx;
 
@@ -57,11 +59,13 @@ NVBLASTTK_DEFINE_TYPE_IDENTIFIABLE(Group);
 
 //////// Member functions ////////
 
-TkGroupImpl::TkGroupImpl() : m_actorCount(0), m_isProcessing(false)
+TkGroupImpl::TkGroupImpl() : m_actorCount(0), m_isProcessing(false), m_eventDataPoolLimit(0), m_damageCoalescing(false),
+	m_damageInbox(nullptr), m_damagePoolBlockCount(0), m_damageFreeList(invalidIndex<uint32_t>()), m_damagePoolMisses(0),
+	m_submittedDamage(nullptr), m_submittedDamageTail(nullptr),
+	m_jointUpdateEventBatching(false), m_taskRunner(nullptr), m_splitChildData(false), m_phaseTimers(NV_PROFILE != 0)
 {
-#if NV_PROFILE
 	memset(&m_stats, 0, sizeof(TkGroupStats)); 
-#endif
+	memset(&m_memoryStats, 0, sizeof(TkGroupMemoryStats));
 }
 
 
@@ -69,6 +73,7 @@ TkGroupImpl::~TkGroupImpl()
 {
 	NVBLAST_ASSERT(getActorCount() == 0);
 	NVBLAST_ASSERT(m_sharedMemory.size() == 0);
+	NVBLAST_ASSERT(m_damageInbox.load() == nullptr && m_submittedDamage == nullptr);
 }
 
 
@@ -98,6 +103,16 @@ void TkGroupImpl::release()
 	}
 	m_sharedMemory.clear();
 
+	discardSubmittedDamage(nullptr);
+
+	for (uint32_t i = 0; i < m_damagePoolBlockCount; i++)
+	{
+		NVBLAST_FREE(m_damagePoolBlocks[i]);
+	}
+	m_damagePoolBlockCount = 0;
+
+	releaseWorkerMemory();
+
 	m_bondTempDataBlock.release();
 	m_chunkTempDataBlock.release();
 	m_bondEventDataBlock.release();
@@ -160,6 +175,7 @@ bool TkGroupImpl::addActor(TkActor& actor)
 		BLAST_PROFILE_ZONE_BEGIN("family memory");
 		mem = NVBLAST_NEW(SharedMemory);
 		mem->allocate(family);
+		mem->m_events.setDataPoolLimit(m_eventDataPoolLimit);
 		m_sharedMemory[&family] = mem;
 		BLAST_PROFILE_ZONE_END("family memory");
 
@@ -267,6 +283,9 @@ void TkGroupImpl::releaseSharedMemory(TkFamilyImpl* fam, SharedMemory* mem)
 	mem->release();
 	m_sharedMemory.erase(fam);
 	NVBLAST_DELETE(mem, SharedMemory);
+
+	// the family may be released next, submitted damage must not refer to it anymore
+	discardSubmittedDamage(fam);
 }
 
 
@@ -341,6 +360,7 @@ void TkGroupImpl::setWorkerCount(uint32_t workerCount)
 
 	if (workerCount != m_workers.size())
 	{
+		releaseWorkerMemory();
 		m_workers.resize(workerCount);
 
 		uint32_t workerId = 0;
@@ -382,10 +402,31 @@ NV_INLINE uint32_t TkGroupImpl::getWorkerCount() const
 }
 
 
+void TkGroupImpl::setEventDataPoolLimit(size_t limit)
+{
+	if (isProcessing())
+	{
+		NVBLAST_LOG_WARNING("TkGroup::setEventDataPoolLimit: Group is still processing, call TkGroup::endProcess first.");
+		return;
+	}
+
+	m_eventDataPoolLimit = limit;
+	for (auto it = m_sharedMemory.getIterator(); !it.done(); ++it)
+	{
+		it->second->m_events.setDataPoolLimit(limit);
+	}
+}
+
+
 uint32_t TkGroupImpl::startProcess()
 {
 	BLAST_PROFILE_SCOPE_L("TkGroup::startProcess");
 
+	if (!isProcessing())
+	{
+		queueSubmittedDamage();
+	}
+
 	if (!setProcessing(true))
 	{
 		NVBLAST_LOG_WARNING("TkGroup::process: Group is still processing, call TkGroup::endProcess first.");
@@ -397,7 +438,7 @@ uint32_t TkGroupImpl::startProcess()
 		BLAST_PROFILE_ZONE_BEGIN("task setup");
 
 		BLAST_PROFILE_ZONE_BEGIN("setup job queue");
-		for (const auto& job : m_jobs)
+		for (auto& job : m_jobs)
 		{
 			const TkActorImpl* a = job.m_tkActor;
 			SharedMemory* mem = getSharedMemory(&a->getFamilyImpl());
@@ -417,9 +458,22 @@ uint32_t TkGroupImpl::startProcess()
 			// collect the amount of event entries to preallocate for TkWorkers
 			// (two TkFracture* events per damage plus one TkSplitEvent)
 			mem->m_eventsCount += 2 * damageCount + 1;
+
+			// every damage program visits the actor's graph, split work is proportional to it too
+			const uint32_t graphNodeCount = a->getGraphNodeCount();
+			job.m_cost = (uint64_t)(graphNodeCount > 0 ? graphNodeCount : 1) * (damageCount > 0 ? damageCount : 1);
 		}
 		BLAST_PROFILE_ZONE_END("setup job queue");
 
+		BLAST_PROFILE_ZONE_BEGIN("sort job queue");
+		// most expensive jobs first, to avoid a long tail when jobs are handed out in order
+		std::sort(m_jobs.begin(), m_jobs.end(), [](const TkWorkerJob& a, const TkWorkerJob& b) { return a.m_cost > b.m_cost; });
+		for (uint32_t i = 0; i < m_jobs.size(); i++)
+		{
+			m_jobs[i].m_tkActor->m_groupJobIndex = i;
+		}
+		BLAST_PROFILE_ZONE_END("sort job queue");
+
 		BLAST_PROFILE_ZONE_BEGIN("memory protect");
 		for (auto it = m_sharedMemory.getIterator(); !it.done(); ++it)
 		{
@@ -466,23 +520,32 @@ bool TkGroupImpl::endProcess()
 
 		if (m_jobs.size() > 0)
 		{
-#if NV_PROFILE
-			BLAST_PROFILE_ZONE_BEGIN("accumulate timers");
-			NvBlastTimers accumulated;
-			NvBlastTimersReset(&accumulated);
-			uint32_t jobCount = 0;
-			int64_t workerTime = 0;
-			for (TkWorker& worker : m_workers)
+			if (m_phaseTimers)
 			{
-				accumulated += worker.m_stats.timers;
-				jobCount += worker.m_stats.processedActorsCount;
-				workerTime += worker.m_stats.workerTime;
+				BLAST_PROFILE_ZONE_BEGIN("accumulate timers");
+				memset(&m_stats, 0, sizeof(TkGroupStats));
+				m_workerStats.resize(m_workers.size());
+				for (uint32_t i = 0; i < m_workers.size(); i++)
+				{
+					const TkWorker& worker = m_workers[i];
+					m_workerStats[i] = worker.m_stats;
+					m_stats.timers += worker.m_stats.timers;
+					m_stats.processedActorsCount += worker.m_stats.actorCount;
+					m_stats.workerTime += worker.m_stats.total;
+					m_stats.eventFill += worker.m_stats.eventFill;
+					m_stats.splitMemory += worker.m_stats.splitMemory;
+					for (uint32_t bucket = 0; bucket < TkGroupStats::SizeBucketCount; bucket++)
+					{
+						m_stats.sizeBuckets[bucket] += worker.m_sizeBucketStats[bucket];
+					}
+				}
+				m_stats.workers = m_workerStats.begin();
+				m_stats.workerCount = m_workerStats.size();
+				BLAST_PROFILE_ZONE_END("accumulate timers");
 			}
-			m_stats.timers = accumulated;
-			m_stats.processedActorsCount = jobCount;
-			m_stats.workerTime = workerTime;
-			BLAST_PROFILE_ZONE_END("accumulate timers");
-#endif
+
+			m_memoryStats.newActorCount = 0;
+			m_memoryStats.eventDataPoolSize = 0;
 
 			BLAST_PROFILE_ZONE_BEGIN("job update");
 			for (auto& j : m_jobs)
@@ -498,11 +561,19 @@ bool TkGroupImpl::endProcess()
 					addActorsInternal(j.m_newActors, j.m_newActorsCount);
 					mem->addReference(j.m_newActorsCount);
 					
-					// Update joints
 					mem->m_events.protect(false); // allow allocations again
-					BLAST_PROFILE_ZONE_BEGIN("updateJoints");
-					fam->updateJoints(j.m_tkActor, &mem->m_events);
-					BLAST_PROFILE_ZONE_END("updateJoints");
+					if (m_jointUpdateEventBatching)
+					{
+						// Joints are updated after all jobs
+						collectJointUpdates(*j.m_tkActor);
+					}
+					else
+					{
+						// Update joints, reported to each split actor's family
+						BLAST_PROFILE_ZONE_BEGIN("updateJoints");
+						fam->updateJoints(j.m_tkActor, &mem->m_events);
+						BLAST_PROFILE_ZONE_END("updateJoints");
+					}
 				}
 
 				// virtually dequeue the actor
@@ -516,6 +587,10 @@ bool TkGroupImpl::endProcess()
 			m_jobs.clear();
 			BLAST_PROFILE_ZONE_END("job update");
 
+			BLAST_PROFILE_ZONE_BEGIN("updateJoints");
+			updateJoints();
+			BLAST_PROFILE_ZONE_END("updateJoints");
+
 			BLAST_PROFILE_ZONE_BEGIN("event dispatch");
 			for (auto it = m_sharedMemory.getIterator(); !it.done(); ++it)
 			{
@@ -533,18 +608,34 @@ bool TkGroupImpl::endProcess()
 
 				family->getQueue().dispatch(mem->m_events);
 
+				m_memoryStats.newActorCount += (uint32_t)mem->getNewActorCount();
+
 				mem->m_events.reset();
 				mem->reset();
+
+				m_memoryStats.eventDataPoolSize += mem->m_events.getDataPoolSize();
 			}
 			BLAST_PROFILE_ZONE_END("event dispatch");
 
-			BLAST_PROFILE_ZONE_BEGIN("event memory release");
+			BLAST_PROFILE_ZONE_BEGIN("event memory reset");
+			m_memoryStats.arenaBlockCount = 0;
+			m_memoryStats.arenaSize = 0;
+			m_memoryStats.arenaUsedSize = 0;
+			m_memoryStats.arenaAllocationCount = 0;
 			for (auto& worker : m_workers)
 			{
-				worker.m_bondBuffer.clear();
-				worker.m_chunkBuffer.clear();
+				m_memoryStats.arenaUsedSize += worker.m_bondBuffer.getUsedBlockSize() + worker.m_chunkBuffer.getUsedBlockSize() + worker.m_splitDataBuffer.getUsedBlockSize();
+				m_memoryStats.arenaAllocationCount += worker.m_bondBuffer.getAllocationCount() + worker.m_chunkBuffer.getAllocationCount() + worker.m_splitDataBuffer.getAllocationCount();
+
+				// keep the blocks for the next processing
+				worker.m_bondBuffer.reset();
+				worker.m_chunkBuffer.reset();
+				worker.m_splitDataBuffer.reset();
+
+				m_memoryStats.arenaBlockCount += worker.m_bondBuffer.getBlockCount() + worker.m_chunkBuffer.getBlockCount() + worker.m_splitDataBuffer.getBlockCount();
+				m_memoryStats.arenaSize += worker.m_bondBuffer.getBlockSize() + worker.m_chunkBuffer.getBlockSize() + worker.m_splitDataBuffer.getBlockSize();
 			}
-			BLAST_PROFILE_ZONE_END("event memory release");
+			BLAST_PROFILE_ZONE_END("event memory reset");
 		}
 
 		bool success = setProcessing(false);
@@ -556,6 +647,248 @@ bool TkGroupImpl::endProcess()
 }
 
 
+void TkGroupImpl::collectJointUpdates(TkActorImpl& tkActor)
+{
+	TkFamilyImpl* family = &tkActor.getFamilyImpl();
+	for (TkActorImpl::JointIt j(tkActor); (bool)j; ++j)
+	{
+		JointUpdate update = { *j, family, m_jointUpdates.size(), 0, { nullptr, nullptr } };
+		m_jointUpdates.pushBack(update);
+	}
+}
+
+
+void TkGroupImpl::updateJoints()
+{
+	if (m_jointUpdates.size() == 0)
+	{
+		return;
+	}
+
+	// families are ordered by their first update, to keep the event order independent of memory addresses
+	m_jointUpdateFamilyOrders.clear();
+	for (JointUpdate& update : m_jointUpdates)
+	{
+		const auto entry = m_jointUpdateFamilyOrders.find(update.family);
+		if (entry != nullptr)
+		{
+			update.familyOrder = entry->second;
+		}
+		else
+		{
+			update.familyOrder = update.order;
+			m_jointUpdateFamilyOrders[update.family] = update.order;
+		}
+	}
+
+	// a joint attached to two split actors was collected twice, update it once, from its first collection
+	// the joint addresses only group its updates, the order is restored from the stable keys below
+	std::sort(m_jointUpdates.begin(), m_jointUpdates.end(), [](const JointUpdate& a, const JointUpdate& b)
+	{
+		return a.joint != b.joint ? a.joint < b.joint : a.order < b.order;
+	});
+	uint32_t updateCount = 0;
+	for (uint32_t i = 0; i < m_jointUpdates.size(); i++)
+	{
+		if (updateCount == 0 || m_jointUpdates[updateCount - 1].joint != m_jointUpdates[i].joint)
+		{
+			m_jointUpdates[updateCount++] = m_jointUpdates[i];
+		}
+	}
+	m_jointUpdates.resizeUninitialized(updateCount);
+
+	// keep the joints reported to a family together, in collection order
+	std::sort(m_jointUpdates.begin(), m_jointUpdates.end(), [](const JointUpdate& a, const JointUpdate& b)
+	{
+		return a.familyOrder != b.familyOrder ? a.familyOrder < b.familyOrder : a.order < b.order;
+	});
+
+	// finding the new actors only reads the families, it can be done in parallel
+	const uint32_t taskCount = m_taskRunner != nullptr ? std::min(m_taskRunner->getMaxTaskCount(), updateCount / JOINT_UPDATES_PER_TASK) : 0;
+	if (taskCount > 1)
+	{
+		JointTasks tasks(*this, taskCount);
+		m_taskRunner->run(tasks, taskCount);
+	}
+	else
+	{
+		for (JointUpdate& update : m_jointUpdates)
+		{
+			update.joint->findSplitActors(update.actors[0], update.actors[1]);
+		}
+	}
+
+	// changing the joints' actors modifies the actors' joint lists
+	for (uint32_t i = 0; i < updateCount; i++)
+	{
+		const JointUpdate& update = m_jointUpdates[i];
+		TkEventQueue& events = getSharedMemory(update.family)->m_events;
+
+		TkJointUpdateEvent jointEvent;
+		TkFamilyImpl* jointEventFamily;
+		if (update.joint->setActors(update.actors[0], update.actors[1], jointEvent, jointEventFamily))
+		{
+			m_jointUpdateEvents.pushBack(jointEvent);
+		}
+
+		// the last joint of this family
+		if ((i + 1 == updateCount || m_jointUpdates[i + 1].family != update.family) && m_jointUpdateEvents.size() > 0)
+		{
+			TkJointUpdateBatchEvent* batchEvent = events.allocData<TkJointUpdateBatchEvent>();
+			TkJointUpdateEvent* jointEvents = events.allocData<TkJointUpdateEvent>(m_jointUpdateEvents.size());
+			memcpy(jointEvents, m_jointUpdateEvents.begin(), m_jointUpdateEvents.size() * sizeof(TkJointUpdateEvent));
+			batchEvent->jointUpdateCount = m_jointUpdateEvents.size();
+			batchEvent->jointUpdates = jointEvents;
+			events.addEvent(batchEvent);
+			m_jointUpdateEvents.clear();
+		}
+	}
+
+	m_jointUpdates.clear();
+}
+
+
+void TkGroupImpl::JointTasks::execute(uint32_t taskIndex)
+{
+	const uint32_t updateCount = m_group.m_jointUpdates.size();
+	const uint32_t start = (uint32_t)((uint64_t)updateCount * taskIndex / m_taskCount);
+	const uint32_t end = (uint32_t)((uint64_t)updateCount * (taskIndex + 1) / m_taskCount);
+	for (uint32_t i = start; i < end; i++)
+	{
+		JointUpdate& update = m_group.m_jointUpdates[i];
+		update.joint->findSplitActors(update.actors[0], update.actors[1]);
+	}
+}
+
+
+void TkGroupImpl::setJointUpdateEventBatching(bool enabled)
+{
+	if (isProcessing())
+	{
+		NVBLAST_LOG_WARNING("TkGroup::setJointUpdateEventBatching: Group is still processing, call TkGroup::endProcess first.");
+		return;
+	}
+
+	m_jointUpdateEventBatching = enabled;
+}
+
+
+void TkGroupImpl::setSplitChildData(bool enabled)
+{
+	if (isProcessing())
+	{
+		NVBLAST_LOG_WARNING("TkGroup::setSplitChildData: Group is still processing, call TkGroup::endProcess first.");
+		return;
+	}
+
+	m_splitChildData = enabled;
+}
+
+
+void TkGroupImpl::setPhaseTimers(bool enabled)
+{
+	if (isProcessing())
+	{
+		NVBLAST_LOG_WARNING("TkGroup::setPhaseTimers: Group is still processing, call TkGroup::endProcess first.");
+		return;
+	}
+
+	m_phaseTimers = enabled;
+}
+
+
+void TkGroupImpl::setDamageCoalescing(bool enabled)
+{
+	if (isProcessing())
+	{
+		NVBLAST_LOG_WARNING("TkGroup::setDamageCoalescing: Group is still processing, call TkGroup::endProcess first.");
+		return;
+	}
+
+	m_damageCoalescing = enabled;
+}
+
+
+uint32_t TkGroupImpl::process(TkGroupTaskRunner& taskRunner)
+{
+	BLAST_PROFILE_SCOPE_L("TkGroup::process");
+
+	if (isProcessing())
+	{
+		NVBLAST_LOG_WARNING("TkGroup::process: Group is still processing, call TkGroup::endProcess first.");
+		return 0;
+	}
+
+	// the submitted damage makes jobs too, count them before sizing the workers
+	queueSubmittedDamage();
+
+	// no more tasks than jobs, every task needs its own worker
+	const uint32_t maxTaskCount = taskRunner.getMaxTaskCount();
+	uint32_t workerCount = maxTaskCount < m_jobs.size() ? maxTaskCount : m_jobs.size();
+	workerCount = workerCount > 0 ? workerCount : 1;
+	if (getWorkerCount() < workerCount)
+	{
+		setWorkerCount(workerCount);
+	}
+
+	const uint32_t jobCount = startProcess();
+	if (jobCount == 0)
+	{
+		return 0;
+	}
+
+	// damage submitted meanwhile may have added jobs, but not workers
+	uint32_t taskCount = maxTaskCount < jobCount ? maxTaskCount : jobCount;
+	taskCount = taskCount < getWorkerCount() ? taskCount : getWorkerCount();
+
+	if (taskCount > 1)
+	{
+		// jobs are sorted by decreasing cost
+		m_jobQueues.deal(taskCount, jobCount);
+		ProcessTasks tasks(*this);
+		taskRunner.run(tasks, taskCount);
+	}
+	else
+	{
+		TkGroupWorker* worker = acquireWorker();
+		for (uint32_t i = 0; i < jobCount; i++)
+		{
+			worker->process(i);
+		}
+		returnWorker(worker);
+	}
+
+	// joints are updated with the task runner too
+	m_taskRunner = &taskRunner;
+	endProcess();
+	m_taskRunner = nullptr;
+
+	return jobCount;
+}
+
+
+void TkGroupImpl::ProcessTasks::execute(uint32_t taskIndex)
+{
+	TkGroupWorker* worker = m_group.acquireWorker();
+	NVBLAST_ASSERT(worker != nullptr);
+
+	m_group.m_jobQueues.process(taskIndex, [worker](uint32_t jobId) { worker->process(jobId); });
+
+	m_group.returnWorker(worker);
+}
+
+
+void TkGroupImpl::releaseWorkerMemory()
+{
+	for (auto& worker : m_workers)
+	{
+		worker.m_bondBuffer.clear();
+		worker.m_chunkBuffer.clear();
+		worker.m_splitDataBuffer.clear();
+	}
+}
+
+
 bool TkGroupImpl::setProcessing(bool value)
 {
 	bool expected = !value;
@@ -563,6 +896,179 @@ bool TkGroupImpl::setProcessing(bool value)
 }
 
 
+void TkGroupImpl::submitDamage(TkActor& actor, const NvBlastDamageProgram& program, const void* programParams)
+{
+	SubmittedDamage* damage = acquireSubmittedDamage();
+	damage->actor = static_cast<TkActorImpl*>(&actor);
+	damage->program = program;
+	damage->programParams = programParams;
+
+	// the inbox is only ever emptied as a whole, so a plain compare-and-swap push is safe from ABA
+	SubmittedDamage* head = m_damageInbox.load(std::memory_order_relaxed);
+	do
+	{
+		damage->next = head;
+	} while (!m_damageInbox.compare_exchange_weak(head, damage, std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+void TkGroupImpl::collectSubmittedDamage()
+{
+	SubmittedDamage* damage = m_damageInbox.exchange(nullptr, std::memory_order_acquire);
+	if (damage == nullptr)
+	{
+		return;
+	}
+
+	// the inbox is last in first out, reverse it
+	SubmittedDamage* first = nullptr;
+	SubmittedDamage* last = damage;
+	while (damage != nullptr)
+	{
+		SubmittedDamage* next = damage->next;
+		damage->next = first;
+		first = damage;
+		damage = next;
+	}
+
+	if (m_submittedDamage != nullptr)
+	{
+		m_submittedDamageTail->next = first;
+	}
+	else
+	{
+		m_submittedDamage = first;
+	}
+	m_submittedDamageTail = last;
+}
+
+
+void TkGroupImpl::queueSubmittedDamage()
+{
+	BLAST_PROFILE_SCOPE_L("TkGroup::queueSubmittedDamage");
+
+	collectSubmittedDamage();
+
+	SubmittedDamage* damage = m_submittedDamage;
+	m_submittedDamage = m_submittedDamageTail = nullptr;
+
+	while (damage != nullptr)
+	{
+		TkActorImpl* tkActor = damage->actor;
+		if (tkActor->isActive() && tkActor->m_group == this && NvBlastActorCanFracture(tkActor->m_actorLL, logLL))
+		{
+			tkActor->m_damageBuffer.pushBack(TkActorImpl::DamageData{ damage->program, damage->programParams });
+			tkActor->makePending();
+		}
+
+		SubmittedDamage* next = damage->next;
+		releaseSubmittedDamage(damage);
+		damage = next;
+	}
+
+	growDamagePool();
+}
+
+
+void TkGroupImpl::discardSubmittedDamage(const TkFamilyImpl* family)
+{
+	collectSubmittedDamage();
+
+	SubmittedDamage* damage = m_submittedDamage;
+	m_submittedDamage = m_submittedDamageTail = nullptr;
+
+	while (damage != nullptr)
+	{
+		SubmittedDamage* next = damage->next;
+		if (family == nullptr || damage->actor->m_family == family)
+		{
+			releaseSubmittedDamage(damage);
+		}
+		else
+		{
+			damage->next = nullptr;
+			if (m_submittedDamage != nullptr)
+			{
+				m_submittedDamageTail->next = damage;
+			}
+			else
+			{
+				m_submittedDamage = damage;
+			}
+			m_submittedDamageTail = damage;
+		}
+		damage = next;
+	}
+}
+
+
+TkGroupImpl::SubmittedDamage* TkGroupImpl::acquireSubmittedDamage()
+{
+	// the tag is bumped by every pop, a pop based on a stale head fails even if the same node is on top again
+	uint64_t head = m_damageFreeList.load(std::memory_order_acquire);
+	for (;;)
+	{
+		const uint32_t index = (uint32_t)head;
+		if (isInvalidIndex(index))
+		{
+			m_damagePoolMisses.fetch_add(1, std::memory_order_relaxed);
+			SubmittedDamage* damage = reinterpret_cast<SubmittedDamage*>(NVBLAST_ALLOC_NAMED(sizeof(SubmittedDamage), "TkGroupImpl::submitDamage"));
+			damage->poolIndex = invalidIndex<uint32_t>();
+			return damage;
+		}
+
+		// blocks are never freed while the group lives, a stale node is still safe to read
+		SubmittedDamage* damage = m_damagePoolBlocks[index / DAMAGE_POOL_BLOCK_SIZE] + index % DAMAGE_POOL_BLOCK_SIZE;
+		const uint64_t next = ((head >> 32) + 1) << 32 | damage->nextFree.load(std::memory_order_relaxed);
+		if (m_damageFreeList.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+		{
+			return damage;
+		}
+	}
+}
+
+
+void TkGroupImpl::releaseSubmittedDamage(SubmittedDamage* damage)
+{
+	if (isInvalidIndex(damage->poolIndex))
+	{
+		NVBLAST_FREE(damage);
+		return;
+	}
+
+	uint64_t head = m_damageFreeList.load(std::memory_order_relaxed);
+	uint64_t next;
+	do
+	{
+		damage->nextFree.store((uint32_t)head, std::memory_order_relaxed);
+		next = (head & 0xFFFFFFFF00000000ULL) | damage->poolIndex;
+	} while (!m_damageFreeList.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+void TkGroupImpl::growDamagePool()
+{
+	const uint32_t misses = m_damagePoolMisses.exchange(0, std::memory_order_relaxed);
+	uint32_t blockCount = (misses + DAMAGE_POOL_BLOCK_SIZE - 1) / DAMAGE_POOL_BLOCK_SIZE;
+	blockCount = std::min(blockCount, DAMAGE_POOL_MAX_BLOCK_COUNT - m_damagePoolBlockCount);
+
+	for (uint32_t b = 0; b < blockCount; b++)
+	{
+		SubmittedDamage* block = reinterpret_cast<SubmittedDamage*>(NVBLAST_ALLOC_NAMED(DAMAGE_POOL_BLOCK_SIZE * sizeof(SubmittedDamage), "TkGroupImpl::growDamagePool"));
+		const uint32_t firstIndex = m_damagePoolBlockCount * DAMAGE_POOL_BLOCK_SIZE;
+		m_damagePoolBlocks[m_damagePoolBlockCount++] = block;
+
+		// the block's pointer is published with the release push of its nodes
+		for (uint32_t i = 0; i < DAMAGE_POOL_BLOCK_SIZE; i++)
+		{
+			SubmittedDamage* damage = new (block + i) SubmittedDamage;
+			damage->poolIndex = firstIndex + i;
+			releaseSubmittedDamage(damage);
+		}
+	}
+}
+
+
 void TkGroupImpl::enqueue(TkActorImpl* tkActor)
 {
 	NVBLAST_ASSERT(tkActor->getGroupImpl() != nullptr);
@@ -33,6 +33,7 @@
 #include "NvBlastTkTaskImpl.h"
 #include "NvBlastTkGroup.h"
 #include "NvBlastTkTypeImpl.h"
+#include "NvBlastWorkQueues.h"
 
 
 namespace Nv
@@ -42,6 +43,7 @@ namespace Blast
 
 class TkActorImpl;
 class TkFamilyImpl;
+class TkJointImpl;
 
 NVBLASTTK_IMPL_DECLARE(Group)
 {
@@ -64,13 +66,37 @@ public:
 	virtual uint32_t		startProcess() override;
 	virtual bool			endProcess() override;
 
+	virtual uint64_t		getJobCost(uint32_t jobId) const override;
+
 	virtual void			getStats(TkGroupStats& stats) const override;
 
+	virtual void			getMemoryStats(TkGroupMemoryStats& stats) const override;
+
 	virtual void			setWorkerCount(uint32_t workerCount) override;
 	virtual uint32_t		getWorkerCount() const override;
 
+	virtual void			setEventDataPoolLimit(size_t limit) override;
+	virtual size_t			getEventDataPoolLimit() const override;
+
+	virtual void			setDamageCoalescing(bool enabled) override;
+	virtual bool			getDamageCoalescing() const override;
+
+	virtual void			submitDamage(TkActor& actor, const NvBlastDamageProgram& program, const void* programParams) override;
+
+	virtual void			setJointUpdateEventBatching(bool enabled) override;
+	virtual bool			getJointUpdateEventBatching() const override;
+
+	virtual void			setSplitChildData(bool enabled) override;
+	virtual bool			getSplitChildData() const override;
+
+	virtual void			setPhaseTimers(bool enabled) override;
+	virtual bool			getPhaseTimers() const override;
+
 	virtual TkGroupWorker*	acquireWorker() override;
 	virtual void			returnWorker(TkGroupWorker*) override;
+
+	using TkGroup::process;
+	virtual uint32_t		process(TkGroupTaskRunner& taskRunner) override;
 	// End TkGroup
 
 	// TkGroupImpl API
@@ -119,6 +145,110 @@ private:
 	void					addActorsInternal(TkActorImpl** actors, uint32_t numActors);
 	void					removeActorInternal(TkActorImpl& tkActor);
 
+	/**
+	Free the memory blocks kept by the workers.
+	*/
+	void					releaseWorkerMemory();
+
+	/**
+	Collect the joints attached to a split actor, to be updated by updateJoints().  Only used with joint update event batching.
+	*/
+	void					collectJointUpdates(TkActorImpl& tkActor);
+
+	/**
+	Update the collected joints once each, and report the changes to the split actors' families.
+	*/
+	void					updateJoints();
+
+	/**
+	A joint attached to an actor split in the current processing.
+	*/
+	struct JointUpdate
+	{
+		TkJointImpl*	joint;			//!< the joint to update
+		TkFamilyImpl*	family;			//!< the split actor's family, reporting the update
+		uint32_t		order;			//!< position in the collection order
+		uint32_t		familyOrder;	//!< position of the family's first update in the collection order
+		TkActorImpl*	actors[2];		//!< the actors now holding the joint's chunks
+	};
+
+	/**
+	Tasks run by updateJoints() to find the actors holding the joints' chunks, each on a range of m_jointUpdates.
+	*/
+	class JointTasks : public TkGroupTaskRunner::Tasks
+	{
+	public:
+		JointTasks(TkGroupImpl& group, uint32_t taskCount) : m_group(group), m_taskCount(taskCount) {}
+
+		virtual void execute(uint32_t taskIndex) override;
+
+	private:
+		TkGroupImpl&	m_group;
+		uint32_t		m_taskCount;
+	};
+
+	static const uint32_t	JOINT_UPDATES_PER_TASK = 256;	//!< the least joint updates for each JointTasks task
+
+	/**
+	Damage submitted with submitDamage().
+	*/
+	struct SubmittedDamage
+	{
+		SubmittedDamage*		next;
+		TkActorImpl*			actor;
+		NvBlastDamageProgram	program;
+		const void*				programParams;
+		uint32_t				poolIndex;	//!< index in the damage pool, invalid if allocated because the pool was empty
+		std::atomic<uint32_t>	nextFree;	//!< next node in the damage pool's free list
+	};
+
+	static const uint32_t	DAMAGE_POOL_BLOCK_SIZE = 1024;		//!< SubmittedDamage nodes in each block of the damage pool
+	static const uint32_t	DAMAGE_POOL_MAX_BLOCK_COUNT = 64;	//!< the damage pool's most blocks, submissions beyond are allocated
+
+	/**
+	Take a node from the damage pool, or allocate one if the pool is empty.  Thread-safe and lock-free.
+	*/
+	SubmittedDamage*		acquireSubmittedDamage();
+
+	/**
+	Return a node to the damage pool, or free it if it was allocated.
+	*/
+	void					releaseSubmittedDamage(SubmittedDamage* damage);
+
+	/**
+	Add blocks to the damage pool for the submissions which found it empty since the last call.  Only called by the owning thread.
+	*/
+	void					growDamagePool();
+
+	/**
+	Move the damage submitted so far from the inbox to the end of m_submittedDamage, restoring submission order.
+	*/
+	void					collectSubmittedDamage();
+
+	/**
+	Queue the submitted damage on the actors, see submitDamage().
+	*/
+	void					queueSubmittedDamage();
+
+	/**
+	Discard the submitted damage on the actors of a family, or all of it if family is nullptr.
+	*/
+	void					discardSubmittedDamage(const TkFamilyImpl* family);
+
+	/**
+	Tasks run by process(TkGroupTaskRunner&), each using one worker.
+	*/
+	class ProcessTasks : public TkGroupTaskRunner::Tasks
+	{
+	public:
+		ProcessTasks(TkGroupImpl& group) : m_group(group) {}
+
+		virtual void execute(uint32_t taskIndex) override;
+
+	private:
+		TkGroupImpl&	m_group;
+	};
+
 
 	uint32_t										m_actorCount;			//!< number of actors in this group
 
@@ -133,13 +263,38 @@ private:
 
 	std::atomic<bool>								m_isProcessing;			//!< true while workers are processing
 
+	size_t											m_eventDataPoolLimit;	//!< event payload memory kept for reuse per family, 0 for unlimited
+
+	bool											m_damageCoalescing;		//!< merge consecutive damage with the same program into one fracture
+
+	std::atomic<SubmittedDamage*>					m_damageInbox;			//!< lock-free stack of damage submitted by any thread
+	SubmittedDamage*								m_damagePoolBlocks[DAMAGE_POOL_MAX_BLOCK_COUNT];	//!< the damage pool's node blocks, never moved
+	uint32_t										m_damagePoolBlockCount;	//!< used elements of m_damagePoolBlocks
+	std::atomic<uint64_t>							m_damageFreeList;		//!< index of the first free pooled node, tagged in the high 32 bits against ABA
+	std::atomic<uint32_t>							m_damagePoolMisses;		//!< submissions which found the damage pool empty since it was last grown
+	SubmittedDamage*								m_submittedDamage;		//!< collected damage in submission order, only used by the owning thread
+	SubmittedDamage*								m_submittedDamageTail;	//!< last element of m_submittedDamage
+
 	Array<TkWorker>::type							m_workers;				//!< this group's workers
 
 	Array<TkWorkerJob>::type						m_jobs;					//!< this group's process jobs
 
-//#if NV_PROFILE
+	WorkQueues										m_jobQueues;			//!< per task job queues for process(TkGroupTaskRunner&)
+
 	TkGroupStats									m_stats;				//!< accumulated group's worker stats
-//#endif
+	Array<TkGroupPhaseStats>::type					m_workerStats;			//!< per worker stats, pointed to by m_stats
+
+	TkGroupMemoryStats								m_memoryStats;			//!< pooled memory counters of the last processing
+
+	bool											m_jointUpdateEventBatching;	//!< report joint updates with one event per family
+	Array<JointUpdate>::type						m_jointUpdates;			//!< joints to update in endProcess
+	HashMap<TkFamilyImpl*, uint32_t>::type			m_jointUpdateFamilyOrders;	//!< JointUpdate::familyOrder of the families in m_jointUpdates
+	Array<TkJointUpdateEvent>::type					m_jointUpdateEvents;	//!< changes of one family's joints, for its batch event
+	TkGroupTaskRunner*								m_taskRunner;			//!< the task runner of process(TkGroupTaskRunner&) while it runs
+
+	bool											m_splitChildData;		//!< fill TkSplitEvent::childData in the workers
+
+	bool											m_phaseTimers;			//!< time the workers' processing phases
 
 	std::mutex	m_workerMtx;
 
@@ -155,11 +310,49 @@ NV_INLINE bool TkGroupImpl::isProcessing() const
 
 NV_INLINE void TkGroupImpl::getStats(TkGroupStats& stats) const
 {
-#if NV_PROFILE
 	memcpy(&stats, &m_stats, sizeof(TkGroupStats));
-#else
-	NV_UNUSED(stats);
-#endif
+}
+
+
+NV_INLINE void TkGroupImpl::getMemoryStats(TkGroupMemoryStats& stats) const
+{
+	stats = m_memoryStats;
+}
+
+
+NV_INLINE size_t TkGroupImpl::getEventDataPoolLimit() const
+{
+	return m_eventDataPoolLimit;
+}
+
+
+NV_INLINE bool TkGroupImpl::getDamageCoalescing() const
+{
+	return m_damageCoalescing;
+}
+
+
+NV_INLINE bool TkGroupImpl::getJointUpdateEventBatching() const
+{
+	return m_jointUpdateEventBatching;
+}
+
+
+NV_INLINE bool TkGroupImpl::getSplitChildData() const
+{
+	return m_splitChildData;
+}
+
+
+NV_INLINE bool TkGroupImpl::getPhaseTimers() const
+{
+	return m_phaseTimers;
+}
+
+
+NV_INLINE uint64_t TkGroupImpl::getJobCost(uint32_t jobId) const
+{
+	return jobId < m_jobs.size() ? m_jobs[jobId].m_cost : 0;
 }
 
 
@@ -181,12 +374,22 @@ NV_FORCE_INLINE void operator +=(NvBlastTimers& lhs, const NvBlastTimers& rhs)
 {
 	lhs.material += rhs.material;
 	lhs.fracture += rhs.fracture;
-	lhs.island += rhs.fracture;
+	lhs.island += rhs.island;
 	lhs.partition += rhs.partition;
 	lhs.visibility += rhs.visibility;
 }
 
 
+NV_FORCE_INLINE void operator +=(TkGroupPhaseStats& lhs, const TkGroupPhaseStats& rhs)
+{
+	lhs.timers += rhs.timers;
+	lhs.eventFill += rhs.eventFill;
+	lhs.splitMemory += rhs.splitMemory;
+	lhs.total += rhs.total;
+	lhs.actorCount += rhs.actorCount;
+}
+
+
 } // namespace Blast
 } // namespace Nv
 
@@ -86,6 +86,20 @@ void TkJointImpl::release()
 
 
 void TkJointImpl::setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkEventQueue* alternateQueue)
+{
+	TkJointUpdateEvent update;
+	TkFamilyImpl* family;
+	if (setActors(actor0, actor1, update, family))
+	{
+		TkEventQueue* q = alternateQueue == nullptr ? &family->getQueue() : alternateQueue;
+		TkJointUpdateEvent* e = q->allocData<TkJointUpdateEvent>();
+		*e = update;
+		q->addEvent(e);
+	}
+}
+
+
+bool TkJointImpl::setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkJointUpdateEvent& update, TkFamilyImpl*& family)
 {
 	NVBLAST_ASSERT(m_data.actors[0] != nullptr || m_data.actors[1] != nullptr);
 
@@ -115,9 +129,7 @@ void TkJointImpl::setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkEventQue
 
 	const uint32_t familyToUse = m_data.actors[0] != actor0 ? 0 : 1;
 
-	TkEventQueue* q = alternateQueue == nullptr ?
-		&static_cast<TkActorImpl*>(m_data.actors[familyToUse])->getFamilyImpl().getQueue()
-		: alternateQueue;
+	family = &static_cast<TkActorImpl*>(m_data.actors[familyToUse])->getFamilyImpl();
 
 	const bool jointWasInternal = m_data.actors[0] == m_data.actors[1];
 
@@ -130,12 +142,11 @@ void TkJointImpl::setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkEventQue
 	if (!jointWasInternal || actor0 != actor1)
 	{
 		// The original actors were different, or they are now, signal a joint update
-		TkJointUpdateEvent* e = q->allocData<TkJointUpdateEvent>();
-		e->joint = this;
-		e->subtype = unreferenced ? TkJointUpdateEvent::Unreferenced : (jointWasInternal ? TkJointUpdateEvent::External : TkJointUpdateEvent::Changed);
+		update.joint = this;
+		update.subtype = unreferenced ? TkJointUpdateEvent::Unreferenced : (jointWasInternal ? TkJointUpdateEvent::External : TkJointUpdateEvent::Changed);
 		m_data.actors[0] = actor0;
 		m_data.actors[1] = actor1;
-		q->addEvent(e);
+		return true;
 	}
 	else
 	if (jointWasInternal)
@@ -143,6 +154,18 @@ void TkJointImpl::setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkEventQue
 		// The joint was originally created within the same actor and now it remains within the same actor.  
 		m_data.actors[0] = m_data.actors[1] = actor0;
 	}
+
+	return false;
+}
+
+
+void TkJointImpl::findSplitActors(TkActorImpl*& actor0, TkActorImpl*& actor1) const
+{
+	actor0 = m_data.actors[0] != nullptr ?
+		static_cast<TkActorImpl&>(*m_data.actors[0]).getFamilyImpl().getActorByChunk(m_data.chunkIndices[0]) : nullptr;
+
+	actor1 = m_data.actors[1] != nullptr ?
+		static_cast<TkActorImpl&>(*m_data.actors[1]).getFamilyImpl().getActorByChunk(m_data.chunkIndices[1]) : nullptr;
 }
 
 
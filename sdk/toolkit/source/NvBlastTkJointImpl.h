@@ -50,6 +50,7 @@ class TkActorImpl;
 class TkJointImpl;
 class TkFamilyImpl;
 class TkEventQueue;
+struct TkJointUpdateEvent;
 
 
 /**
@@ -116,6 +117,27 @@ public:
 	*/
 	void						setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkEventQueue* alternateQueue = nullptr);
 
+	/**
+	Set the actors that this joint attaches to, as setActors above, but return the event to signal the change instead of queueing it.
+
+	\param[in]	actor0		The new TkActor to replace the first attached actor.
+	\param[in]	actor1		The new TkActor to replace the second attached actor.
+	\param[out]	update		The event signaling the change, if any.
+	\param[out]	family		The family whose event queue setActors would use for the event.
+
+	\return true if the change must be signaled with update.
+	*/
+	bool						setActors(TkActorImpl* actor0, TkActorImpl* actor1, TkJointUpdateEvent& update, TkFamilyImpl*& family);
+
+	/**
+	Find the actors now holding the chunks this joint attaches to, after its attached actors were split.
+	The result is passed to setActors.  This function only reads the attached actors' families.
+
+	\param[out]	actor0		The TkActor holding the first chunk, or NULL if the first attached actor is NULL.
+	\param[out]	actor1		The TkActor holding the second chunk, or NULL if the second attached actor is NULL.
+	*/
+	void						findSplitActors(TkActorImpl*& actor0, TkActorImpl*& actor1) const;
+
 	/**
 	Ensures that any attached actors no longer refer to this joint.
 	*/
@@ -32,6 +32,11 @@
 #include "NvBlastTkFamilyImpl.h"
 #include "NvBlastTkAssetImpl.h"
 #include "NvBlastTkGroupImpl.h"
+#include "NvBlastTime.h"
+
+#undef max
+#undef min
+#include <algorithm>
 
 
 using namespace Nv::Blast;
@@ -50,6 +55,28 @@ void SharedMemory::allocate(TkFamilyImpl& tkFamily)
 }
 
 
+/**
+Adds the ticks elapsed in its scope to a phase timer, reads no clock when the timer is null.
+*/
+class PhaseTimer
+{
+public:
+	PhaseTimer(int64_t* ticks) : m_ticks(ticks), m_time(ticks != nullptr) {}
+
+	~PhaseTimer()
+	{
+		if (m_ticks != nullptr)
+		{
+			*m_ticks += m_time.peekElapsedTicks();
+		}
+	}
+
+private:
+	int64_t*	m_ticks;
+	Time		m_time;
+};
+
+
 /**
 Creates a TkEvent::FractureCommand according to the input buffer for tkActor
 into events queue using the LocalBuffers to store the actual event data.
@@ -144,16 +171,43 @@ void TkWorker::initialize()
 	m_bondBuffer.initialize(m_group->m_bondEventDataBlock.getBlock(m_id), m_group->m_bondEventDataBlock.numElementsPerBlock());
 	m_chunkBuffer.initialize(m_group->m_chunkEventDataBlock.getBlock(m_id), m_group->m_chunkEventDataBlock.numElementsPerBlock());
 
-#if NV_PROFILE
-	NvBlastTimersReset(&m_stats.timers);
-	m_stats.processedActorsCount = 0;
-#endif
+	// split child data has no preallocated memory, its blocks are allocated on demand and kept across cycles
+	m_splitDataBuffer.initialize(nullptr, 0);
+
+	memset(&m_stats, 0, sizeof(TkGroupPhaseStats));
+	memset(m_sizeBucketStats, 0, sizeof(m_sizeBucketStats));
 }
 
 void TkWorker::process(TkWorkerJob& j)
 {
-	NvBlastTimers* timers = nullptr;
+	if (!m_group->getPhaseTimers())
+	{
+		NvBlastTimersReset(&j.m_tkActor->m_timers);
+		processActor(j, nullptr);
+		return;
+	}
+
+	// the actor's phases are timed into actorStats, then accounted in the worker's and size bucket's stats
+	TkGroupPhaseStats actorStats;
+	memset(&actorStats, 0, sizeof(TkGroupPhaseStats));
+	actorStats.timers += j.m_tkActor->m_timers;
+	NvBlastTimersReset(&j.m_tkActor->m_timers);
+	actorStats.actorCount = 1;
+
+	const uint32_t sizeBucket = TkGroupStats::getSizeBucket(NvBlastActorGetGraphNodeCount(j.m_tkActor->getActorLLInternal(), logLL));
+
+	{
+		PhaseTimer timer(&actorStats.total);
+		processActor(j, &actorStats);
+	}
+
+	m_stats += actorStats;
+	m_sizeBucketStats[sizeBucket] += actorStats;
+}
 
+
+void TkWorker::processActor(TkWorkerJob& j, TkGroupPhaseStats* stats)
+{
 	BLAST_PROFILE_SCOPE_M("TkActor");
 
 	TkActorImpl* tkActor = j.m_tkActor;
@@ -166,26 +220,47 @@ void TkWorker::process(TkWorkerJob& j)
 	NVBLAST_ASSERT(tkActor->getGroupImpl() == m_group);
 	NVBLAST_ASSERT(tkActor->m_flags.isSet(TkActorFlag::PENDING));
 
-#if NV_PROFILE
-	timers = &m_stats.timers;
-	*timers += tkActor->m_timers;
-	NvBlastTimersReset(&tkActor->m_timers);
-	m_stats.processedActorsCount++;
-#endif
+	NvBlastTimers* timers = stats != nullptr ? &stats->timers : nullptr;
+	int64_t* eventFillTicks = stats != nullptr ? &stats->eventFill : nullptr;
+	int64_t* splitMemoryTicks = stats != nullptr ? &stats->splitMemory : nullptr;
 
 	// generate and apply fracture for all damage requested on this actor
 	// and queue events accordingly
-	for (const auto& damage : tkActor->m_damageBuffer)
+	const uint32_t damageCount = tkActor->m_damageBuffer.size();
+	for (uint32_t damageIndex = 0; damageIndex < damageCount;)
 	{
 		NvBlastFractureBuffers commandBuffer = m_tempBuffer;
 
-		BLAST_PROFILE_ZONE_BEGIN("Material");
-		NvBlastActorGenerateFracture(&commandBuffer, actorLL, damage.program, damage.programParams, logLL, timers);
-		BLAST_PROFILE_ZONE_END("Material");
+		// with damage coalescing, consecutive damage using the same program is fractured at once
+		uint32_t damageEnd = damageIndex + 1;
+		if (m_group->getDamageCoalescing())
+		{
+			const NvBlastDamageProgram& program = tkActor->m_damageBuffer[damageIndex].program;
+			while (damageEnd < damageCount
+				&& tkActor->m_damageBuffer[damageEnd].program.graphShaderFunction == program.graphShaderFunction
+				&& tkActor->m_damageBuffer[damageEnd].program.subgraphShaderFunction == program.subgraphShaderFunction)
+			{
+				damageEnd++;
+			}
+		}
+
+		if (damageEnd - damageIndex > 1)
+		{
+			generateCoalescedFracture(commandBuffer, tkActor, damageIndex, damageEnd, timers);
+		}
+		else
+		{
+			const TkActorImpl::DamageData& damage = tkActor->m_damageBuffer[damageIndex];
+			BLAST_PROFILE_ZONE_BEGIN("Material");
+			NvBlastActorGenerateFracture(&commandBuffer, actorLL, damage.program, damage.programParams, logLL, timers);
+			BLAST_PROFILE_ZONE_END("Material");
+		}
+		damageIndex = damageEnd;
 
 		if (commandBuffer.chunkFractureCount > 0 || commandBuffer.bondFractureCount > 0)
 		{
 			BLAST_PROFILE_SCOPE_M("Fill Command Events");
+			PhaseTimer timer(eventFillTicks);
 			reportFractureCommands(commandBuffer, m_bondBuffer, m_chunkBuffer, events, tkActor);
 		}
 
@@ -198,6 +273,7 @@ void TkWorker::process(TkWorkerJob& j)
 		if (eventBuffer.chunkFractureCount > 0 || eventBuffer.bondFractureCount > 0)
 		{
 			BLAST_PROFILE_SCOPE_M("Fill Fracture Events");
+			PhaseTimer timer(eventFillTicks);
 			tkActor->m_flags |= (TkActorFlag::DAMAGED);
 			reportFractureEvents(eventBuffer, m_bondBuffer, m_chunkBuffer, events, tkActor);
 		}
@@ -210,10 +286,13 @@ void TkWorker::process(TkWorkerJob& j)
 	NvBlastActorSplitEvent splitEvent = { nullptr, nullptr };
 	if (tkActor->isDamaged())
 	{
-		BLAST_PROFILE_ZONE_BEGIN("Split Memory");
-		uint32_t maxActorCount = NvBlastActorGetMaxActorCountForSplit(actorLL, logLL);
-		splitEvent.newActors = mem->reserveNewActors(maxActorCount);
-		BLAST_PROFILE_ZONE_END("Split Memory");
+		uint32_t maxActorCount;
+		{
+			BLAST_PROFILE_SCOPE_M("Split Memory");
+			PhaseTimer timer(splitMemoryTicks);
+			maxActorCount = NvBlastActorGetMaxActorCountForSplit(actorLL, logLL);
+			splitEvent.newActors = mem->reserveNewActors(maxActorCount);
+		}
 		BLAST_PROFILE_ZONE_BEGIN("Split");
 		j.m_newActorsCount = NvBlastActorSplit(&splitEvent, actorLL, maxActorCount, m_splitScratch, logLL, timers);
 		BLAST_PROFILE_ZONE_END("Split");
@@ -235,7 +314,10 @@ void TkWorker::process(TkWorkerJob& j)
 
 		auto tkSplitEvent = events.allocData<TkSplitEvent>();
 
-		tkSplitEvent->children = mem->reserveNewTkActors(j.m_newActorsCount);
+		{
+			PhaseTimer timer(splitMemoryTicks);
+			tkSplitEvent->children = mem->reserveNewTkActors(j.m_newActorsCount);
+		}
 		tkSplitEvent->numChildren = j.m_newActorsCount;
 
 		tkSplitEvent->parentData.family = &family;
@@ -255,6 +337,17 @@ void TkWorker::process(TkWorkerJob& j)
 		j.m_newActors = reinterpret_cast<TkActorImpl**>(tkSplitEvent->children);
 		BLAST_PROFILE_ZONE_END("create new actors");
 
+		PhaseTimer timer(eventFillTicks);
+
+		if (m_group->getSplitChildData())
+		{
+			fillSplitChildData(*tkSplitEvent);
+		}
+		else
+		{
+			memset(&tkSplitEvent->childData, 0, sizeof(TkSplitChildData));
+		}
+
 		BLAST_PROFILE_ZONE_BEGIN("split event");
 		events.addEvent(tkSplitEvent);
 		BLAST_PROFILE_ZONE_END("split event");
@@ -264,6 +357,121 @@ void TkWorker::process(TkWorkerJob& j)
 }
 
 
+void TkWorker::fillSplitChildData(TkSplitEvent& splitEvent)
+{
+	BLAST_PROFILE_SCOPE_M("Split Child Data");
+
+	const uint32_t childCount = splitEvent.numChildren;
+
+	uint32_t visibleChunkCount = 0;
+	uint32_t graphNodeCount = 0;
+	for (uint32_t i = 0; i < childCount; ++i)
+	{
+		const NvBlastActor* actorLL = static_cast<TkActorImpl*>(splitEvent.children[i])->getActorLLInternal();
+		visibleChunkCount += NvBlastActorGetVisibleChunkCount(actorLL, logLL);
+		graphNodeCount += NvBlastActorGetGraphNodeCount(actorLL, logLL);
+	}
+
+	// one block for all arrays: child indices, both offset arrays and both index arrays
+	uint32_t* childIndices = m_splitDataBuffer.allocate(3 * childCount + 2 + visibleChunkCount + graphNodeCount);
+	uint32_t* visibleChunkOffsets = childIndices + childCount;
+	uint32_t* graphNodeOffsets = visibleChunkOffsets + childCount + 1;
+	uint32_t* visibleChunkIndices = graphNodeOffsets + childCount + 1;
+	uint32_t* graphNodeIndices = visibleChunkIndices + visibleChunkCount;
+
+	visibleChunkOffsets[0] = 0;
+	graphNodeOffsets[0] = 0;
+	for (uint32_t i = 0; i < childCount; ++i)
+	{
+		const TkActorImpl* child = static_cast<TkActorImpl*>(splitEvent.children[i]);
+		const NvBlastActor* actorLL = child->getActorLLInternal();
+		childIndices[i] = child->getIndex();
+		visibleChunkOffsets[i + 1] = visibleChunkOffsets[i] + NvBlastActorGetVisibleChunkIndices(visibleChunkIndices + visibleChunkOffsets[i], visibleChunkCount - visibleChunkOffsets[i], actorLL, logLL);
+		graphNodeOffsets[i + 1] = graphNodeOffsets[i] + NvBlastActorGetGraphNodeIndices(graphNodeIndices + graphNodeOffsets[i], graphNodeCount - graphNodeOffsets[i], actorLL, logLL);
+	}
+
+	splitEvent.childData.childIndices = childIndices;
+	splitEvent.childData.visibleChunkOffsets = visibleChunkOffsets;
+	splitEvent.childData.visibleChunkIndices = visibleChunkIndices;
+	splitEvent.childData.graphNodeOffsets = graphNodeOffsets;
+	splitEvent.childData.graphNodeIndices = graphNodeIndices;
+}
+
+
+void TkWorker::generateCoalescedFracture(NvBlastFractureBuffers& commandBuffer, const TkActorImpl* tkActor, uint32_t damageStart, uint32_t damageEnd, NvBlastTimers* timers)
+{
+	BLAST_PROFILE_SCOPE_M("Coalesce Damage");
+
+	const NvBlastActor* actorLL = tkActor->getActorLLInternal();
+
+	// every damage is evaluated on the actor as it is before any of them is applied
+	m_coalescedBonds.clear();
+	m_coalescedChunks.clear();
+	for (uint32_t damageIndex = damageStart; damageIndex < damageEnd; damageIndex++)
+	{
+		const TkActorImpl::DamageData& damage = tkActor->m_damageBuffer[damageIndex];
+		NvBlastFractureBuffers buffer = m_tempBuffer;
+
+		BLAST_PROFILE_ZONE_BEGIN("Material");
+		NvBlastActorGenerateFracture(&buffer, actorLL, damage.program, damage.programParams, logLL, timers);
+		BLAST_PROFILE_ZONE_END("Material");
+
+		for (uint32_t i = 0; i < buffer.bondFractureCount; i++)
+		{
+			m_coalescedBonds.pushBack(buffer.bondFractures[i]);
+		}
+		for (uint32_t i = 0; i < buffer.chunkFractureCount; i++)
+		{
+			m_coalescedChunks.pushBack(buffer.chunkFractures[i]);
+		}
+	}
+
+	// sum the damage per bond, regardless of the order of its nodes in the commands
+	std::sort(m_coalescedBonds.begin(), m_coalescedBonds.end(), [](const NvBlastBondFractureData& a, const NvBlastBondFractureData& b)
+	{
+		const uint32_t a0 = std::min(a.nodeIndex0, a.nodeIndex1), b0 = std::min(b.nodeIndex0, b.nodeIndex1);
+		return a0 != b0 ? a0 < b0 : std::max(a.nodeIndex0, a.nodeIndex1) < std::max(b.nodeIndex0, b.nodeIndex1);
+	});
+	uint32_t bondCount = 0;
+	for (uint32_t i = 0; i < m_coalescedBonds.size(); i++)
+	{
+		const NvBlastBondFractureData& command = m_coalescedBonds[i];
+		NvBlastBondFractureData* last = bondCount > 0 ? &commandBuffer.bondFractures[bondCount - 1] : nullptr;
+		if (last != nullptr
+			&& std::min(last->nodeIndex0, last->nodeIndex1) == std::min(command.nodeIndex0, command.nodeIndex1)
+			&& std::max(last->nodeIndex0, last->nodeIndex1) == std::max(command.nodeIndex0, command.nodeIndex1))
+		{
+			last->health += command.health;
+		}
+		else if (bondCount < commandBuffer.bondFractureCount)
+		{
+			commandBuffer.bondFractures[bondCount++] = command;
+		}
+	}
+	commandBuffer.bondFractureCount = bondCount;
+
+	// sum the damage per chunk
+	std::sort(m_coalescedChunks.begin(), m_coalescedChunks.end(), [](const NvBlastChunkFractureData& a, const NvBlastChunkFractureData& b)
+	{
+		return a.chunkIndex < b.chunkIndex;
+	});
+	uint32_t chunkCount = 0;
+	for (uint32_t i = 0; i < m_coalescedChunks.size(); i++)
+	{
+		const NvBlastChunkFractureData& command = m_coalescedChunks[i];
+		if (chunkCount > 0 && commandBuffer.chunkFractures[chunkCount - 1].chunkIndex == command.chunkIndex)
+		{
+			commandBuffer.chunkFractures[chunkCount - 1].health += command.health;
+		}
+		else if (chunkCount < commandBuffer.chunkFractureCount)
+		{
+			commandBuffer.chunkFractures[chunkCount++] = command;
+		}
+	}
+	commandBuffer.chunkFractureCount = chunkCount;
+}
+
+
 void TkWorker::process(uint32_t jobID)
 {
 	TkWorkerJob& j = m_group->m_jobs[jobID];
@@ -62,6 +62,7 @@ struct TkWorkerJob
 	TkActorImpl*	m_tkActor;			//!< the actor to process
 	TkActorImpl**	m_newActors;		//!< list of child actors created by splitting
 	uint32_t		m_newActorsCount;	//!< the number of child actors created
+	uint64_t		m_cost;				//!< estimated processing cost, see TkGroup::getJobCost
 };
 
 
@@ -165,6 +166,14 @@ public:
 		m_used = 0;
 	}
 
+	/**
+	The number of elements reserved since the last reset.
+	*/
+	size_t used() const
+	{
+		return m_used;
+	}
+
 	/**
 	Frees the preallocated array.
 	*/
@@ -186,20 +195,24 @@ private:
 /**
 Allocates from a preallocated, externally owned memory block initialized with.
 When blocks run out of space, new ones are allocated and owned by this class.
+Owned blocks are kept by reset() and allocated from again in the following cycles, so that in steady state no allocation takes place.
 */
 template<typename T>
 class LocalBuffer
 {
 public:
+	LocalBuffer() : m_currentBlock(nullptr), m_used(0), m_capacity(0), m_nextBlock(0), m_usedBlockCount(0), m_usedBlockSize(0), m_allocationCount(0) {}
+
 	/**
 	Returns the pointer to the first element of an array of n elements.
-	Allocates a new block of memory when exhausted, its size being the larger of n and capacity set with initialize().
+	Moves on to the next owned block when exhausted, or allocates a new block if none fits,
+	its size being the larger of n, the current block's capacity and the owned capacity used so far.
 	*/
 	T* allocate(size_t n)
 	{
 		if (m_used + n > m_capacity)
 		{
-			allocateNewBlock(n > m_capacity ? n : m_capacity);
+			nextBlock(n);
 		}
 
 		size_t index = m_used;
@@ -208,16 +221,17 @@ public:
 	}
 
 	/**
-	Release the additionally allocated memory blocks.
+	Release the additionally allocated memory blocks, which are not freed otherwise.
 	The externally owned memory block remains untouched.
 	*/
 	void clear()
 	{
-		for (void* block : m_memoryBlocks)
+		for (const Block& block : m_memoryBlocks)
 		{
-			NVBLAST_FREE(block);
+			NVBLAST_FREE(block.memory);
 		}
 		m_memoryBlocks.clear();
+		m_nextBlock = 0;
 	}
 
 	/**
@@ -229,25 +243,123 @@ public:
 		m_currentBlock = block;
 		m_capacity = capacity;
 		m_used = 0;
+		m_nextBlock = 0;
+		m_usedBlockCount = 0;
+		m_usedBlockSize = 0;
+		m_allocationCount = 0;
+	}
+
+	/**
+	Keep the owned blocks for the next cycle, started with initialize().
+	Where more than one owned block was needed, they are replaced by a single block of their combined size.
+	*/
+	void reset()
+	{
+		if (m_usedBlockCount > 1)
+		{
+			const size_t capacity = m_usedBlockSize;
+			clear();
+			allocateNewBlock(capacity);
+		}
+	}
+
+	/**
+	The number of owned blocks.
+	*/
+	uint32_t getBlockCount() const
+	{
+		return m_memoryBlocks.size();
+	}
+
+	/**
+	The size in bytes of the owned blocks.
+	*/
+	size_t getBlockSize() const
+	{
+		size_t size = 0;
+		for (const Block& block : m_memoryBlocks)
+		{
+			size += block.capacity * sizeof(T);
+		}
+		return size;
+	}
+
+	/**
+	The size in bytes of the owned blocks used since initialize().
+	*/
+	size_t getUsedBlockSize() const
+	{
+		return m_usedBlockSize * sizeof(T);
+	}
+
+	/**
+	The number of blocks allocated since initialize().
+	*/
+	uint32_t getAllocationCount() const
+	{
+		return m_allocationCount;
 	}
 
 private:
+	struct Block
+	{
+		T*		memory;
+		size_t	capacity;
+	};
+
+	/**
+	Continue in the next owned block with room for n elements, or in a new one.
+	*/
+	void nextBlock(size_t n)
+	{
+		while (m_nextBlock < m_memoryBlocks.size())
+		{
+			const Block& block = m_memoryBlocks[m_nextBlock++];
+			if (block.capacity >= n)
+			{
+				useBlock(block);
+				return;
+			}
+		}
+
+		size_t capacity = n > m_capacity ? n : m_capacity;
+		capacity = capacity > m_usedBlockSize ? capacity : m_usedBlockSize;
+		allocateNewBlock(capacity);
+		m_nextBlock = m_memoryBlocks.size();
+		useBlock(m_memoryBlocks.back());
+	}
+
 	/**
 	Allocates space for capacity elements.
 	*/
 	void allocateNewBlock(size_t capacity)
 	{
 		BLAST_PROFILE_SCOPE_L("Local Buffer allocation");
-		m_capacity = capacity;
-		m_currentBlock = static_cast<T*>(NVBLAST_ALLOC_NAMED(capacity*sizeof(T), "Blast LocalBuffer"));
-		m_memoryBlocks.pushBack(m_currentBlock);
+		Block block = { static_cast<T*>(NVBLAST_ALLOC_NAMED(capacity*sizeof(T), "Blast LocalBuffer")), capacity };
+		m_memoryBlocks.pushBack(block);
+		m_allocationCount++;
+	}
+
+	/**
+	Allocate from the beginning of block.
+	*/
+	void useBlock(const Block& block)
+	{
+		m_currentBlock = block.memory;
+		m_capacity = block.capacity;
 		m_used = 0;
+		m_usedBlockCount++;
+		m_usedBlockSize += block.capacity;
 	}
 
-	InlineArray<void*, 4>::type		m_memoryBlocks; //!< storage for memory blocks
-	T*								m_currentBlock;	//!< memory block used to allocate from
-	size_t							m_used;			//!< elements used in current block
-	size_t							m_capacity;		//!< elements available in current block
+	typename InlineArray<Block, 4>::type	m_memoryBlocks;		//!< storage for memory blocks
+	T*										m_currentBlock;		//!< memory block used to allocate from
+	size_t									m_used;				//!< elements used in current block
+	size_t									m_capacity;			//!< elements available in current block
+	uint32_t								m_nextBlock;		//!< next owned block to continue in
+	uint32_t								m_usedBlockCount;	//!< owned blocks used since initialize()
+	size_t									m_usedBlockSize;	//!< elements in the owned blocks used since initialize()
+	uint32_t								m_allocationCount;	//!< blocks allocated since initialize()
 };
 
 
@@ -290,6 +402,14 @@ public:
 		m_newTkActorBuffers.reset();
 	}
 
+	/**
+	The number of new actor entries reserved since the last reset.
+	*/
+	size_t getNewActorCount() const
+	{
+		return m_newTkActorBuffers.used();
+	}
+
 	/**
 	Increments the reference count.
 	*/
@@ -325,6 +445,7 @@ public:
 	{
 		m_newActorBuffers.release();
 		m_newTkActorBuffers.release();
+		m_events.releaseData();
 	}
 
 	TkEventQueue				m_events;				//!< event queue shared across a group's actors of the same family
@@ -353,19 +474,38 @@ public:
 
 	void		process(TkWorkerJob& job);
 
+	/**
+	Fracture and split the job's actor.  With non-null stats, the processing phases are timed into it.
+	*/
+	void		processActor(TkWorkerJob& job, TkGroupPhaseStats* stats);
+
+	/**
+	Generate the fracture commands of the damage in [damageStart, damageEnd) of tkActor's damage buffer,
+	merged into a single command per bond and chunk by summing the damage.
+	*/
+	void		generateCoalescedFracture(NvBlastFractureBuffers& commandBuffer, const TkActorImpl* tkActor, uint32_t damageStart, uint32_t damageEnd, NvBlastTimers* timers);
+
+	/**
+	Gather the indices, visible chunks and graph nodes of the split event's children into m_splitDataBuffer.
+	*/
+	void		fillSplitChildData(TkSplitEvent& splitEvent);
+
 	uint32_t								m_id;			//!< this worker's id
 	TkGroupImpl*							m_group;		//!< the group owning this worker
 
 	LocalBuffer<NvBlastChunkFractureData>	m_chunkBuffer;	//!< memory manager for chunk event data
 	LocalBuffer<NvBlastBondFractureData>	m_bondBuffer;	//!< memory manager for bonds event data
+	LocalBuffer<uint32_t>					m_splitDataBuffer;	//!< memory manager for split child data
+
+	Array<NvBlastBondFractureData>::type	m_coalescedBonds;	//!< bond commands of all coalesced damage, before merging
+	Array<NvBlastChunkFractureData>::type	m_coalescedChunks;	//!< chunk commands of all coalesced damage, before merging
 
 	void*									m_splitScratch;
 	NvBlastFractureBuffers					m_tempBuffer;
 	bool									m_isBusy;
 
-#if NV_PROFILE
-	TkGroupStats	m_stats;
-#endif
+	TkGroupPhaseStats						m_stats;		//!< phase times of the actors processed, when the group's phase timers are enabled
+	TkGroupPhaseStats						m_sizeBucketStats[TkGroupStats::SizeBucketCount];	//!< m_stats per actor size
 };
 }
 }
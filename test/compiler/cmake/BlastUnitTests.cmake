@@ -10,6 +10,7 @@ SET(SHAREDUTILS_SOURCE_DIR ${BLAST_ROOT_DIR}/shared/utils)
 
 SET(COMMON_SOURCE_DIR ${BLAST_ROOT_DIR}/sdk/common)
 SET(SOLVER_SOURCE_DIR ${BLAST_ROOT_DIR}/sdk/lowlevel/source)
+SET(STRESS_SOURCE_DIR ${BLAST_ROOT_DIR}/sdk/extensions/stress/source)
 
 
 
@@ -28,6 +29,7 @@ SET(UNITTEST_SOURCE_FILES
 	${UNITTEST_SOURCE_DIR}/CoreTests.cpp
 	${UNITTEST_SOURCE_DIR}/FamilyGraphTests.cpp
 	${UNITTEST_SOURCE_DIR}/MultithreadingTests.cpp
+	${UNITTEST_SOURCE_DIR}/StressSolverTests.cpp
 	${UNITTEST_SOURCE_DIR}/SyncTests.cpp
 	${UNITTEST_SOURCE_DIR}/TkCompositeTests.cpp
 	${UNITTEST_SOURCE_DIR}/TkTests.cpp
@@ -76,6 +78,13 @@ SET(SDK_SOLVER_FILES
 	${SOLVER_SOURCE_DIR}/NvBlastFamily.h
 )
 
+# The bond kernels are internal to NvBlastExtStress, built in to be tested one by one
+SET(SDK_STRESS_FILES
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernels.cpp
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernels.h
+	${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernelsAVX2.cpp
+)
+
 SET(UTILS_SOURCE_FILES
 	${SHAREDUTILS_SOURCE_DIR}/AssetGenerator.cpp
 	${SHAREDUTILS_SOURCE_DIR}/AssetGenerator.h
@@ -93,6 +102,7 @@ ADD_EXECUTABLE(BlastUnitTests
 	
 	${SDK_COMMON_FILES}
 	${SDK_SOLVER_FILES}
+	${SDK_STRESS_FILES}
 )
 
 set_target_properties(BlastUnitTests 
@@ -108,6 +118,10 @@ SOURCE_GROUP("Source" FILES ${UNITTEST_SOURCE_FILES})
 SOURCE_GROUP("Utils" FILES ${UTILS_SOURCE_FILES})
 SOURCE_GROUP("Sdk\\common" FILES ${SDK_COMMON_FILES})
 SOURCE_GROUP("Sdk\\solver" FILES ${SDK_SOLVER_FILES})
+SOURCE_GROUP("Sdk\\stress" FILES ${SDK_STRESS_FILES})
+
+# The AVX2 kernel is only called after checking the CPU supports it
+SET_SOURCE_FILES_PROPERTIES(${STRESS_SOURCE_DIR}/NvBlastExtStressSolverKernelsAVX2.cpp PROPERTIES COMPILE_FLAGS "${BLASTUNITTESTS_AVX2_COMPILE_FLAGS}")
 
 
 # Target specific compile options
@@ -122,6 +136,7 @@ TARGET_INCLUDE_DIRECTORIES(BlastUnitTests
 	PRIVATE ${BLAST_ROOT_DIR}/sdk/profiler
 	PRIVATE ${BLAST_ROOT_DIR}/sdk/lowlevel/include
 	PRIVATE ${BLAST_ROOT_DIR}/sdk/lowlevel/source
+	PRIVATE ${BLAST_ROOT_DIR}/sdk/extensions/stress/source
 	PRIVATE ${BLAST_ROOT_DIR}/sdk/extensions/assetutils/source
 	PRIVATE ${BLAST_ROOT_DIR}/sdk/extensions/assetutils/include
 	PRIVATE ${BLAST_ROOT_DIR}/sdk/extensions/serialization/include
@@ -154,7 +169,7 @@ MESSAGE("UnitTests LL: ${BLASTUNITTESTS_PLATFORM_LINKED_LIBS}")
 # Do final direct sets after the target has been defined
 TARGET_LINK_LIBRARIES(BlastUnitTests 
 
-	PRIVATE NvBlastExtShaders NvBlastExtPhysX NvBlastTk NvBlastExtSerialization NvBlastExtAssetUtils ${GOOGLETEST_LIBRARIES} 
+	PRIVATE NvBlastExtShaders NvBlastExtPhysX NvBlastExtStress NvBlastTk NvBlastExtSerialization NvBlastExtAssetUtils ${GOOGLETEST_LIBRARIES} 
 	PRIVATE ${BLASTUNITTESTS_PLATFORM_LINKED_LIBS}
 
 	PUBLIC $<$<CONFIG:debug>:${PXFOUNDATION_LIB_DEBUG}> $<$<CONFIG:debug>:${PXTASK_LIB_DEBUG}>
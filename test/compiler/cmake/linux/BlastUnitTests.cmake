@@ -23,6 +23,8 @@ SET(BLASTUNITTESTS_PLATFORM_LINKED_LIBS
     -lm
 )
 
+SET(BLASTUNITTESTS_AVX2_COMPILE_FLAGS "-mavx2")
+
 IF ("${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang")
 	#Required to link against the Google Test binaries in pacman
 	SET(BLASTUNITTESTS_PLATFORM_COMPILE_OPTIONS "-D_GLIBCXX_USE_CXX11_ABI=0")
@@ -11,6 +11,8 @@ SET(BLASTUNITTESTS_PLATFORM_INCLUDES
     PRIVATE $<$<OR:$<CONFIG:debug>,$<CONFIG:checked>,$<CONFIG:profile>>:${NVTOOLSEXT_INCLUDE_DIRS}>
 )
 
+SET(BLASTUNITTESTS_AVX2_COMPILE_FLAGS "/arch:AVX2")
+
 SET(BLASTUNITTESTS_COMPILE_DEFS
 	# Common to all configurations
 	${BLASTTESTS_SLN_COMPILE_DEFS}
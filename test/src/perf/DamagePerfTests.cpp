@@ -267,7 +267,7 @@ TEST_F(PerfTest, DISABLED_DamageRadialSimple)
 			std::cout << trial << ".. ";
 			std::cout.flush();
 		}
-		std::vector<uint32_t> history1, history2;
+		std::vector<uint32_t> history1, history2, history3, history4;
 
 		uint32_t assetCount = 4;
 		uint32_t familyCount = 4;
@@ -279,8 +279,16 @@ TEST_F(PerfTest, DISABLED_DamageRadialSimple)
 		PerfResults results1 = damageLeafSupportActors(test_info_->name(), assetCount, familyCount, damageCount, 1, history2);
 		BlastBasePerfTestStrict::reportData("DamageRadialSimple total1 ", results1.totalTime);
 		BlastBasePerfTestStrict::reportData("DamageRadialSimple create1 ", results1.createTime);
+		PerfResults results4 = damageLeafSupportActors(test_info_->name(), assetCount, familyCount, damageCount, NvBlastExtDamageAcceleratorType::BVH4, history3);
+		BlastBasePerfTestStrict::reportData("DamageRadialSimple total4 ", results4.totalTime);
+		BlastBasePerfTestStrict::reportData("DamageRadialSimple create4 ", results4.createTime);
+		PerfResults results5 = damageLeafSupportActors(test_info_->name(), assetCount, familyCount, damageCount, NvBlastExtDamageAcceleratorType::Grid, history4);
+		BlastBasePerfTestStrict::reportData("DamageRadialSimple total5 ", results5.totalTime);
+		BlastBasePerfTestStrict::reportData("DamageRadialSimple create5 ", results5.createTime);
 
 		EXPECT_TRUE(history1 == history2);
+		EXPECT_TRUE(history1 == history3);
+		EXPECT_TRUE(history1 == history4);
 	}
 	std::cout << "done." << std::endl;
 }
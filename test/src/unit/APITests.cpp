@@ -112,6 +112,86 @@ TEST_F(APITest, Basic)
 	alignedFree(asset);
 }
 
+TEST_F(APITest, BatchFracture)
+{
+	// create asset
+	const NvBlastAssetDesc& assetDesc = g_assetDescs[0];
+
+	std::vector<char> scratch((size_t)NvBlastGetRequiredScratchForCreateAsset(&assetDesc, messageLog));
+	void* amem = alignedZeroedAlloc(NvBlastGetAssetMemorySize(&assetDesc, messageLog));
+	NvBlastAsset* asset = NvBlastCreateAsset(amem, &assetDesc, scratch.data(), messageLog);
+	EXPECT_TRUE(asset != nullptr);
+
+	// create two families, each with a single actor
+	NvBlastActorDesc actorDesc;
+	actorDesc.initialBondHealths = actorDesc.initialSupportChunkHealths = nullptr;
+	actorDesc.uniformInitialBondHealth = actorDesc.uniformInitialLowerSupportChunkHealth = 1.0f;
+	NvBlastFamily* families[2];
+	NvBlastActor* actors[2];
+	for (int i = 0; i < 2; ++i)
+	{
+		void* fmem = alignedZeroedAlloc(NvBlastAssetGetFamilyMemorySize(asset, messageLog));
+		families[i] = NvBlastAssetCreateFamily(fmem, asset, messageLog);
+		scratch.resize((size_t)NvBlastFamilyGetRequiredScratchForCreateFirstActor(families[i], messageLog));
+		actors[i] = NvBlastFamilyCreateFirstActor(families[i], &actorDesc, scratch.data(), messageLog);
+		EXPECT_TRUE(actors[i] != nullptr);
+	}
+
+	NvBlastExtRadialDamageDesc damage = {
+		10.0f,					// compressive
+		{ 0.0f, 0.0f, 0.0f },	// position
+		4.0f,					// min radius - maximum damage
+		6.0f					// max radius - zero damage
+	};
+
+	NvBlastExtProgramParams programParams = { &damage, nullptr };
+
+	NvBlastDamageProgram program = {
+		NvBlastExtFalloffGraphShader,
+		nullptr
+	};
+
+	// the second entry damages the first actor again, which must not change the outcome
+	const NvBlastActorBatchDamage damages[3] = {
+		{ actors[0], program, &programParams },
+		{ actors[1], program, &programParams },
+		{ actors[0], program, &programParams }
+	};
+
+	NvBlastBondFractureData outFracture[36];
+	NvBlastFractureBuffers events = { 36, 0, outFracture, nullptr };
+
+	NvBlastActor* newActors[16];
+	NvBlastActorBatchResult results[3];
+	scratch.resize((size_t)NvBlastActorBatchGetRequiredScratch(damages, 3, messageLog));
+	const uint32_t newActorsCount = NvBlastActorBatchFracture(results, &events, newActors, 16, damages, 3, scratch.data(), messageLog, nullptr);
+
+	EXPECT_EQ(16, newActorsCount);
+	EXPECT_EQ(24, events.bondFractureCount);
+
+	EXPECT_EQ(12, results[0].events.bondFractureCount);
+	EXPECT_EQ(12, results[1].events.bondFractureCount);
+	EXPECT_EQ(0, results[2].events.bondFractureCount);
+	EXPECT_TRUE(results[1].events.bondFractures == outFracture + 12);
+
+	EXPECT_EQ(8, results[0].newActorCount);
+	EXPECT_EQ(8, results[1].newActorCount);
+	EXPECT_EQ(0, results[2].newActorCount);
+	EXPECT_TRUE(results[0].splitEvent.deletedActor == actors[0]);
+	EXPECT_TRUE(results[1].splitEvent.deletedActor == actors[1]);
+	EXPECT_TRUE(results[2].splitEvent.deletedActor == nullptr);
+	EXPECT_TRUE(results[1].splitEvent.newActors == newActors + 8);
+
+	for (uint32_t i = 0; i < newActorsCount; ++i)
+	{
+		const bool actorReleaseResult = NvBlastActorDeactivate(newActors[i], messageLog);
+		EXPECT_TRUE(actorReleaseResult);
+	}
+	alignedFree(families[0]);
+	alignedFree(families[1]);
+	alignedFree(asset);
+}
+
 TEST_F(APITest, DamageBondsCompressive)
 {
 	const size_t bondsCount = 6;
@@ -215,6 +295,164 @@ TEST_F(APITest, DamageBondsCompressive)
 	alignedFree(asset);
 }
 
+static float referenceSegmentDistance(const float p[3], const float a[3], const float b[3])
+{
+	const float v[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+	const float w[3] = { p[0] - a[0], p[1] - a[1], p[2] - a[2] };
+	const float c1 = v[0] * w[0] + v[1] * w[1] + v[2] * w[2];
+	const float c2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+	const float t = c1 <= 0.0f ? 0.0f : (c2 < c1 ? 1.0f : c1 / c2);
+	const float d[3] = { a[0] + v[0] * t - p[0], a[1] + v[1] * t - p[1], a[2] + v[2] * t - p[2] };
+	return sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+}
+
+TEST_F(APITest, DamageBondsRadialShaders)
+{
+	// Enough bonds for the shaders to evaluate them in several batches, including a partial one
+	GeneratorAsset cube;
+	NvBlastAssetDesc assetDesc;
+	generateCube(cube, assetDesc, 2, 7);
+
+	std::vector<char> scratch((size_t)NvBlastGetRequiredScratchForCreateAsset(&assetDesc, messageLog));
+	void* amem = alignedZeroedAlloc(NvBlastGetAssetMemorySize(&assetDesc, messageLog));
+	NvBlastAsset* asset = NvBlastCreateAsset(amem, &assetDesc, scratch.data(), messageLog);
+	ASSERT_TRUE(asset != nullptr);
+
+	const NvBlastSupportGraph graph = NvBlastAssetGetSupportGraph(asset, messageLog);
+	const NvBlastBond* bonds = NvBlastAssetGetBonds(asset, messageLog);
+
+	// Damage covering most, a small part and all of the cube, so that accelerated shaders take both the query and the graph walk paths
+	NvBlastExtRadialDamageDesc radial = { 1.0f, { 0.1f, 0.05f, -0.03f }, 0.2f, 0.45f };
+	NvBlastExtRadialDamageDesc radialSmall = { 1.0f, { 0.3f, -0.25f, 0.2f }, 0.05f, 0.2f };
+	NvBlastExtRadialDamageDesc radialLarge = { 1.0f, { 0.0f, 0.0f, 0.0f }, 0.5f, 2.0f };
+	NvBlastExtCapsuleRadialDamageDesc capsule = { 0.8f, { -0.4f, -0.1f, 0.02f }, { 0.35f, 0.2f, -0.05f }, 0.1f, 0.3f };
+
+	struct Case
+	{
+		NvBlastGraphShaderFunction	shader;
+		const void*					desc;
+		bool						isCapsule;
+		bool						isCutter;
+	};
+
+	const Case cases[] =
+	{
+		{ NvBlastExtFalloffGraphShader, &radial, false, false },
+		{ NvBlastExtCutterGraphShader, &radial, false, true },
+		{ NvBlastExtFalloffGraphShader, &radialSmall, false, false },
+		{ NvBlastExtFalloffGraphShader, &radialLarge, false, false },
+		{ NvBlastExtCapsuleFalloffGraphShader, &capsule, true, false }
+	};
+
+	const int acceleratorTypes[] =
+	{
+		NvBlastExtDamageAcceleratorType::None,
+		NvBlastExtDamageAcceleratorType::AABBTree,
+		NvBlastExtDamageAcceleratorType::BVH4,
+		NvBlastExtDamageAcceleratorType::Grid
+	};
+
+	for (const Case& c : cases)
+	{
+		NvBlastActorDesc actorDesc;
+		actorDesc.initialBondHealths = actorDesc.initialSupportChunkHealths = nullptr;
+		actorDesc.uniformInitialBondHealth = actorDesc.uniformInitialLowerSupportChunkHealth = 1.0f;
+		void* fmem = alignedZeroedAlloc(NvBlastAssetGetFamilyMemorySize(asset, messageLog));
+		NvBlastFamily* family = NvBlastAssetCreateFamily(fmem, asset, messageLog);
+		scratch.resize((size_t)NvBlastFamilyGetRequiredScratchForCreateFirstActor(family, messageLog));
+		NvBlastActor* actor = NvBlastFamilyCreateFirstActor(family, &actorDesc, scratch.data(), messageLog);
+		EXPECT_TRUE(actor != nullptr);
+
+		// Expected damage per bond, evaluated one bond at a time
+		std::vector<NvBlastBondFractureData> expected;
+		for (uint32_t node0 = 0; node0 < graph.nodeCount; ++node0)
+		{
+			for (uint32_t adj = graph.adjacencyPartition[node0]; adj < graph.adjacencyPartition[node0 + 1]; ++adj)
+			{
+				const uint32_t node1 = graph.adjacentNodeIndices[adj];
+				if (node0 < node1)
+				{
+					const float* p = bonds[graph.adjacentBondIndices[adj]].centroid;
+					float distance, minRadius, maxRadius, damage;
+					if (c.isCapsule)
+					{
+						distance = referenceSegmentDistance(p, capsule.position0, capsule.position1);
+						minRadius = capsule.minRadius;
+						maxRadius = capsule.maxRadius;
+						damage = capsule.damage;
+					}
+					else
+					{
+						const NvBlastExtRadialDamageDesc& r = *static_cast<const NvBlastExtRadialDamageDesc*>(c.desc);
+						const float d[3] = { r.position[0] - p[0], r.position[1] - p[1], r.position[2] - p[2] };
+						distance = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+						minRadius = r.minRadius;
+						maxRadius = r.maxRadius;
+						damage = r.damage;
+					}
+					float health = 0.0f;
+					if (distance <= maxRadius)
+					{
+						if (c.isCutter)
+						{
+							health = distance >= minRadius ? damage : 0.0f;
+						}
+						else
+						{
+							health = distance < minRadius ? damage : damage * (1.0f - (distance - minRadius) / (maxRadius - minRadius));
+						}
+					}
+					if (health > 0.0f)
+					{
+						expected.push_back({ 0, node0, node1, health });
+					}
+				}
+			}
+		}
+		EXPECT_LT(0u, expected.size());
+
+		// Every accelerator type must give the same result as walking the actor graph
+		for (int type : acceleratorTypes)
+		{
+			NvBlastExtDamageAccelerator* accelerator = NvBlastExtDamageAcceleratorCreate(asset, type);
+			EXPECT_EQ(type != NvBlastExtDamageAcceleratorType::None, accelerator != nullptr);
+
+			std::vector<NvBlastBondFractureData> outCommands(NvBlastAssetGetBondCount(asset, messageLog));
+			NvBlastFractureBuffers commands = { (uint32_t)outCommands.size(), 0, outCommands.data(), nullptr };
+			NvBlastExtProgramParams programParams = { c.desc, accelerator };
+			NvBlastDamageProgram program = { c.shader, nullptr };
+			NvBlastActorGenerateFracture(&commands, actor, program, &programParams, messageLog, nullptr);
+
+			ASSERT_EQ(expected.size(), commands.bondFractureCount);
+			EXPECT_EQ(0, commands.chunkFractureCount);
+
+			auto nodeOrder = [](const NvBlastBondFractureData& a, const NvBlastBondFractureData& b)
+			{
+				return a.nodeIndex0 != b.nodeIndex0 ? a.nodeIndex0 < b.nodeIndex0 : a.nodeIndex1 < b.nodeIndex1;
+			};
+			outCommands.resize(commands.bondFractureCount);
+			std::sort(outCommands.begin(), outCommands.end(), nodeOrder);
+			std::sort(expected.begin(), expected.end(), nodeOrder);
+			for (size_t i = 0; i < expected.size(); ++i)
+			{
+				EXPECT_EQ(expected[i].nodeIndex0, outCommands[i].nodeIndex0);
+				EXPECT_EQ(expected[i].nodeIndex1, outCommands[i].nodeIndex1);
+				EXPECT_NEAR(expected[i].health, outCommands[i].health, 1.0e-5f);
+			}
+
+			if (accelerator != nullptr)
+			{
+				accelerator->release();
+			}
+		}
+
+		EXPECT_TRUE(NvBlastActorDeactivate(actor, messageLog));
+		alignedFree(family);
+	}
+
+	alignedFree(asset);
+}
+
 TEST_F(APITest, DirectFractureKillsChunk)
 {
 	// 1--2
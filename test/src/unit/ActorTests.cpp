@@ -98,7 +98,7 @@ static bool chooseRandomGraphNodes(uint32_t* g, uint32_t count, const Nv::Blast:
 }
 
 
-static void blast(std::set<NvBlastActor*>& actorsToDamage, GeneratorAsset* testAsset, GeneratorAsset::Vec3 localPos, float minRadius, float maxRadius, float compressiveDamage)
+static void blast(std::set<NvBlastActor*>& actorsToDamage, GeneratorAsset* testAsset, GeneratorAsset::Vec3 localPos, float minRadius, float maxRadius, float compressiveDamage, uint32_t splitTaskCount = 0)
 {
 	std::vector<NvBlastChunkFractureData> chunkEvents; /* num lower-support chunks + bonds */
 	std::vector<NvBlastBondFractureData> bondEvents; /* num lower-support chunks + bonds */
@@ -144,8 +144,28 @@ static void blast(std::set<NvBlastActor*>& actorsToDamage, GeneratorAsset* testA
 			splitEvent.newActors = &newActorsBuffer.data()[totalNewActorsCount];
 			uint32_t newActorSize = (uint32_t)(newActorsBuffer.size() - totalNewActorsCount);
 
-			splitScratch.resize((size_t)NvBlastActorGetRequiredScratchForSplit(actor, nullptr));
-			const size_t newActorsCount = NvBlastActorSplit(&splitEvent, actor, newActorSize, splitScratch.data(), nullptr, nullptr);
+			size_t newActorsCount;
+			if (splitTaskCount == 0)
+			{
+				splitScratch.resize((size_t)NvBlastActorGetRequiredScratchForSplit(actor, nullptr));
+				newActorsCount = NvBlastActorSplit(&splitEvent, actor, newActorSize, splitScratch.data(), nullptr, nullptr);
+			}
+			else
+			{
+				// Execute tasks in reverse order, the result must not depend on it
+				splitScratch.resize((size_t)NvBlastActorGetRequiredScratchForSplitTasks(actor, splitTaskCount, nullptr));
+				uint32_t taskCount = NvBlastActorSplitTasksBegin(&splitEvent, actor, newActorSize, splitTaskCount, splitScratch.data(), nullptr, nullptr);
+				while (taskCount > 0)
+				{
+					EXPECT_TRUE(taskCount <= splitTaskCount);
+					for (uint32_t taskIndex = taskCount; taskIndex-- > 0;)
+					{
+						NvBlastActorSplitTaskExecute(splitScratch.data(), taskIndex);
+					}
+					taskCount = NvBlastActorSplitTasksSync(splitScratch.data());
+				}
+				newActorsCount = NvBlastActorSplitTasksEnd(splitScratch.data(), nullptr, nullptr);
+			}
 			EXPECT_TRUE(isDamaged || newActorsCount == 0);
 			totalNewActorsCount += newActorsCount;
 			removeActor = splitEvent.deletedActor != NULL;
@@ -738,7 +758,8 @@ public:
 	bool simple,
 	void (*actorTest)(const Nv::Blast::Actor&, NvBlastLog),
 	void (*postDamageTest)(std::vector<NvBlastActor*>&, NvBlastLog),
-	CubeAssetGenerator::BondFlags bondFlags = CubeAssetGenerator::BondFlags::ALL_INTERNAL_BONDS
+	CubeAssetGenerator::BondFlags bondFlags = CubeAssetGenerator::BondFlags::ALL_INTERNAL_BONDS,
+	uint32_t splitTaskCount = 0
 	)
 	{
 		const float relativeDamageRadius = simple ? 0.75f : 0.2f;
@@ -832,7 +853,7 @@ public:
 				for (uint32_t damageNum = 0; damageNum < damageCount; ++damageNum)
 				{
 					GeneratorAsset::Vec3 localPos = settings.extents*GeneratorAsset::Vec3((float)rand() / RAND_MAX - 0.5f, (float)rand() / RAND_MAX - 0.5f, (float)rand() / RAND_MAX - 0.5f);
-					blast(actors, &testAsset, localPos, relativeDamageRadius, relativeDamageRadius*1.2f, compressiveDamage);
+					blast(actors, &testAsset, localPos, relativeDamageRadius, relativeDamageRadius*1.2f, compressiveDamage, splitTaskCount);
 					if (printActorCount) std::cout << actors.size() << ".. ";
 					if (actors.size() > 0)
 					{
@@ -1083,6 +1104,14 @@ TEST_F(ActorTestStrict, DamageLeafSupportActorsTestVisibility)
 	damageLeafSupportActors(4, 4, 5, false, testActorVisibleChunks, nullptr);
 }
 
+TEST_F(ActorTestStrict, DamageLeafSupportActorsSplitTasksTestVisibility)
+{
+	typedef CubeAssetGenerator::BondFlags BF;
+	damageLeafSupportActors(4, 4, 5, false, testActorVisibleChunks, nullptr, BF::ALL_INTERNAL_BONDS, 1);
+	damageLeafSupportActors(4, 4, 5, false, testActorVisibleChunks, nullptr, BF::ALL_INTERNAL_BONDS, 4);
+	damageLeafSupportActors(4, 4, 5, false, testActorVisibleChunks, nullptr, BF::ALL_INTERNAL_BONDS | BF::Z_MINUS_WORLD_BONDS, 8);
+}
+
 TEST_F(ActorTestStrict, DamageLeafSupportActorTestBlockSerialization)
 {
 	typedef CubeAssetGenerator::BondFlags BF;
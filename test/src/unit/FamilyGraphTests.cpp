@@ -403,3 +403,43 @@ TEST_F(FamilyGraphTestStrict, Graph1FindIslandsRemoveAllEdges)
 		EXPECT_EQ(node0, graph->getIslandIds()[node0]);
 	}
 }
+
+TEST_F(FamilyGraphTestStrict, Graph1NonTreeEdgesRemoval)
+{
+	FamilyGraph* graph = buildFamilyGraph(chunkCount1, adjacentChunkPartition1, adjacentChunkIndices1);
+	graph->initialize(DEFAULT_ACTOR_INDEX, m_graph);
+
+	std::vector<char> scratch;
+	scratch.resize((size_t)FamilyGraph::findIslandsRequiredScratch(chunkCount1));
+
+	EXPECT_EQ(1, graph->findIslands(DEFAULT_ACTOR_INDEX, scratch.data(), m_graph));
+
+	// remove all edges which are not part of fast route spanning forest, they can't break the island
+	const NodeIndex* fastRoute = graph->getFastRoute();
+	uint32_t edges = graph->getEdgesCount(m_graph);
+	for (uint32_t node0 = 0; node0 < chunkCount1; node0++)
+	{
+		for (uint32_t i = adjacentChunkPartition1[node0]; i < adjacentChunkPartition1[node0 + 1]; i++)
+		{
+			const uint32_t node1 = adjacentChunkIndices1[i];
+			if (node0 < node1 && fastRoute[node0] != node1 && fastRoute[node1] != node0)
+			{
+				EXPECT_TRUE(graph->notifyEdgeRemoved(DEFAULT_ACTOR_INDEX, node0, node1, m_graph));
+				edges--;
+				EXPECT_TRUE(isInvalidIndex(graph->getFirstDirtyNodeIndices()[DEFAULT_ACTOR_INDEX]));
+			}
+		}
+	}
+	EXPECT_EQ(chunkCount1 - 1, edges);
+	EXPECT_EQ(edges, graph->getEdgesCount(m_graph));
+	EXPECT_EQ(0, graph->findIslands(DEFAULT_ACTOR_INDEX, scratch.data(), m_graph));
+
+	// only spanning tree is left, so every edge removal now splits the island
+	graph->notifyEdgeRemoved(DEFAULT_ACTOR_INDEX, 5, fastRoute[5], m_graph);
+	EXPECT_FALSE(isInvalidIndex(graph->getFirstDirtyNodeIndices()[DEFAULT_ACTOR_INDEX]));
+	EXPECT_EQ(1, graph->findIslands(DEFAULT_ACTOR_INDEX, scratch.data(), m_graph));
+
+	std::vector<IslandInfo> info;
+	getIslandsInfo(*graph, info);
+	EXPECT_EQ(2, info.size());
+}
@@ -0,0 +1,670 @@
+// This code contains NVIDIA Confidential Information and is disclosed to you
+// under a form of NVIDIA software license agreement provided separately to you.
+//
+// Notice
+// NVIDIA Corporation and its licensors retain all intellectual property and
+// proprietary rights in and to this software and related documentation and
+// any modifications thereto. Any use, reproduction, disclosure, or
+// distribution of this software and related documentation without an express
+// license agreement from NVIDIA Corporation is strictly prohibited.
+//
+// ALL NVIDIA DESIGN SPECIFICATIONS, CODE ARE PROVIDED "AS IS.". NVIDIA MAKES
+// NO WARRANTIES, EXPRESSED, IMPLIED, STATUTORY, OR OTHERWISE WITH RESPECT TO
+// THE MATERIALS, AND EXPRESSLY DISCLAIMS ALL IMPLIED WARRANTIES OF NONINFRINGEMENT,
+// MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE.
+//
+// Information and code furnished is believed to be accurate and reliable.
+// However, NVIDIA Corporation assumes no responsibility for the consequences of use of such
+// information or for any infringement of patents or other rights of third parties that may
+// result from its use. No license is granted by implication or otherwise under any patent
+// or patent rights of NVIDIA Corporation. Details are subject to change without notice.
+// This code supersedes and replaces all information previously supplied.
+// NVIDIA Corporation products are not authorized for use as critical
+// components in life support devices or systems without express written approval of
+// NVIDIA Corporation.
+//
+// Copyright (c) 2016-2018 NVIDIA Corporation. All rights reserved.
+
+
+#include "BlastBaseTest.h"
+#include "AssetGenerator.h"
+
+#include "NvBlastExtStressSolver.h"
+#include "NvBlastExtStressSolverKernels.h"
+
+#include <map>
+#include <tuple>
+#include <algorithm>
+#include <cmath>
+#include <climits>
+#include <iterator>
+
+
+using namespace Nv::Blast;
+using namespace physx;
+
+
+// ====================================================================================================================
+//													  HELPERS
+// ====================================================================================================================
+
+/**
+Bond impulses of a stress solver, keyed by the rounded positions of the bond's solver nodes, so that solvers with
+different bond orders can be compared.
+*/
+typedef std::tuple<int, int, int, int, int, int> BondKey;
+typedef std::map<BondKey, std::pair<PxVec3, PxVec3>> BondImpulses;
+
+static BondImpulses getBondImpulses(ExtStressSolver& solver, uint32_t graphNodeCount)
+{
+	std::vector<uint32_t> nodes(graphNodeCount);
+	for (uint32_t i = 0; i < graphNodeCount; ++i)
+	{
+		nodes[i] = i;
+	}
+
+	// every bond is drawn as its own line followed by its linear and angular impulse lines
+	const ExtStressSolver::DebugBuffer buffer = solver.fillDebugRender(nodes.data(), graphNodeCount, ExtStressSolver::STRESS_GRAPH_BONDS_IMPULSES);
+	EXPECT_EQ(0u, buffer.lineCount % 3);
+
+	BondImpulses impulses;
+	for (uint32_t i = 0; i + 2 < buffer.lineCount; i += 3)
+	{
+		const PxVec3& p0 = buffer.lines[i].pos0;
+		const PxVec3& p1 = buffer.lines[i].pos1;
+		const BondKey key((int)std::round(p0.x * 1000), (int)std::round(p0.y * 1000), (int)std::round(p0.z * 1000),
+						  (int)std::round(p1.x * 1000), (int)std::round(p1.y * 1000), (int)std::round(p1.z * 1000));
+		const PxVec3 linear = buffer.lines[i + 1].pos1 - buffer.lines[i + 1].pos0;
+		const PxVec3 angular = buffer.lines[i + 2].pos1 - buffer.lines[i + 2].pos0;
+		impulses[key] = std::make_pair(linear, angular);
+	}
+	return impulses;
+}
+
+static void compareBondImpulses(const BondImpulses& expected, const BondImpulses& actual, float relativeTolerance)
+{
+	EXPECT_EQ(expected.size(), actual.size());
+
+	float maxMagnitude = 0.0f;
+	for (const auto& bond : expected)
+	{
+		maxMagnitude = std::max(maxMagnitude, std::max(bond.second.first.magnitude(), bond.second.second.magnitude()));
+	}
+	EXPECT_LT(0.0f, maxMagnitude);
+
+	const float tolerance = maxMagnitude * relativeTolerance;
+	for (const auto& bond : expected)
+	{
+		const auto match = actual.find(bond.first);
+		EXPECT_TRUE(match != actual.end());
+		if (match != actual.end())
+		{
+			EXPECT_LE((bond.second.first - match->second.first).magnitude(), tolerance);
+			EXPECT_LE((bond.second.second - match->second.second).magnitude(), tolerance);
+		}
+	}
+}
+
+/**
+Net linear impulse the bonds apply to every dynamic solver node, keyed by the node's rounded position. The bottom layer
+of the wall is bonded to the world and static, it is left out: how the wall spreads its load over redundant bonds and
+down to the ground depends on the order bonds are solved in, the load every dynamic node takes does not.
+*/
+typedef std::tuple<int, int, int> NodeKey;
+typedef std::map<NodeKey, PxVec3> NodeImpulses;
+
+static NodeImpulses getDynamicNodeImpulses(const BondImpulses& bondImpulses)
+{
+	NodeImpulses impulses;
+	int bottom = INT_MAX;
+	for (const auto& bond : bondImpulses)
+	{
+		const NodeKey key0(std::get<0>(bond.first), std::get<1>(bond.first), std::get<2>(bond.first));
+		const NodeKey key1(std::get<3>(bond.first), std::get<4>(bond.first), std::get<5>(bond.first));
+		impulses.emplace(key0, PxVec3(0.0f)).first->second += bond.second.first;
+		impulses.emplace(key1, PxVec3(0.0f)).first->second -= bond.second.first;
+		bottom = std::min(bottom, std::min(std::get<1>(key0), std::get<1>(key1)));
+	}
+
+	for (auto it = impulses.begin(); it != impulses.end();)
+	{
+		it = std::get<1>(it->first) == bottom ? impulses.erase(it) : std::next(it);
+	}
+	return impulses;
+}
+
+static void compareNodeImpulses(const NodeImpulses& expected, const NodeImpulses& actual, float relativeTolerance)
+{
+	EXPECT_EQ(expected.size(), actual.size());
+
+	float maxMagnitude = 0.0f;
+	for (const auto& node : expected)
+	{
+		maxMagnitude = std::max(maxMagnitude, node.second.magnitude());
+	}
+	EXPECT_LT(0.0f, maxMagnitude);
+
+	const float tolerance = maxMagnitude * relativeTolerance;
+	for (const auto& node : expected)
+	{
+		const auto match = actual.find(node.first);
+		EXPECT_TRUE(match != actual.end());
+		if (match != actual.end())
+		{
+			EXPECT_LE((node.second - match->second).magnitude(), tolerance);
+		}
+	}
+}
+
+
+/**
+Runs the stress solver tasks one after the other, split like a thread pool would.
+*/
+class SerialStressTaskRunner : public ExtStressSolverTaskRunner
+{
+public:
+	SerialStressTaskRunner(uint32_t maxTaskCount) : m_maxTaskCount(maxTaskCount), m_runCount(0) {}
+
+	virtual uint32_t	getMaxTaskCount() const override
+	{
+		return m_maxTaskCount;
+	}
+
+	virtual void		run(Tasks& tasks, uint32_t taskCount) override
+	{
+		EXPECT_LE(taskCount, m_maxTaskCount);
+		m_runCount++;
+		for (uint32_t i = taskCount; i-- > 0;)
+		{
+			tasks.execute(i);
+		}
+	}
+
+	uint32_t			m_maxTaskCount;
+	uint32_t			m_runCount;
+};
+
+
+// ====================================================================================================================
+//													   TEST CLASS
+// ====================================================================================================================
+
+template<int FailLevel, int Verbosity>
+class StressSolverTest : public BlastBaseTest<FailLevel, Verbosity>
+{
+public:
+	StressSolverTest()
+	{
+	}
+
+	~StressSolverTest()
+	{
+		for (void* mem : m_memory)
+		{
+			alignedFree(mem);
+		}
+	}
+
+	static void messageLog(int type, const char* msg, const char* file, int line)
+	{
+		BlastBaseTest<FailLevel, Verbosity>::messageLog(type, msg, file, line);
+	}
+
+	static void alignedFree(void* mem)
+	{
+		BlastBaseTest<FailLevel, Verbosity>::alignedFree(mem);
+	}
+
+	void* alloc(size_t size)
+	{
+		void* mem = BlastBaseTest<FailLevel, Verbosity>::alignedZeroedAlloc(size);
+		m_memory.push_back(mem);
+		return mem;
+	}
+
+	/**
+	A wall of slices^3 support chunks, its bottom face bonded to the world.
+	*/
+	NvBlastAsset* buildWallAsset(uint32_t slices)
+	{
+		CubeAssetGenerator::Settings settings;
+		settings.extents = GeneratorAsset::Vec3(1, 1, 1);
+		settings.bondFlags = CubeAssetGenerator::BondFlags::ALL_INTERNAL_BONDS | CubeAssetGenerator::BondFlags::Y_MINUS_WORLD_BONDS;
+		settings.depths.push_back(CubeAssetGenerator::DepthInfo(GeneratorAsset::Vec3(1, 1, 1)));
+		settings.depths.push_back(CubeAssetGenerator::DepthInfo(GeneratorAsset::Vec3((float)slices, (float)slices, (float)slices), NvBlastChunkDesc::SupportFlag));
+
+		GeneratorAsset generatorAsset;
+		CubeAssetGenerator::generate(generatorAsset, settings);
+
+		NvBlastAssetDesc desc;
+		desc.chunkDescs = generatorAsset.solverChunks.data();
+		desc.chunkCount = (uint32_t)generatorAsset.solverChunks.size();
+		desc.bondDescs = generatorAsset.solverBonds.data();
+		desc.bondCount = (uint32_t)generatorAsset.solverBonds.size();
+
+		std::vector<char> scratch((size_t)NvBlastGetRequiredScratchForCreateAsset(&desc, messageLog));
+		NvBlastAsset* asset = NvBlastCreateAsset(alloc(NvBlastGetAssetMemorySize(&desc, messageLog)), &desc, scratch.data(), messageLog);
+		EXPECT_TRUE(asset != nullptr);
+		return asset;
+	}
+
+	NvBlastActor* instanceActor(const NvBlastAsset& asset)
+	{
+		NvBlastActorDesc actorDesc;
+		actorDesc.initialBondHealths = actorDesc.initialSupportChunkHealths = nullptr;
+		actorDesc.uniformInitialBondHealth = actorDesc.uniformInitialLowerSupportChunkHealth = 1.0f;
+		NvBlastFamily* family = NvBlastAssetCreateFamily(alloc(NvBlastAssetGetFamilyMemorySize(&asset, messageLog)), &asset, messageLog);
+		std::vector<char> scratch((size_t)NvBlastFamilyGetRequiredScratchForCreateFirstActor(family, messageLog));
+		NvBlastActor* actor = NvBlastFamilyCreateFirstActor(family, &actorDesc, scratch.data(), messageLog);
+		EXPECT_TRUE(actor != nullptr);
+		return actor;
+	}
+
+	ExtStressSolver* createSolver(NvBlastActor& actor, const ExtStressSolverSettings& settings)
+	{
+		ExtStressSolver* solver = ExtStressSolver::create(*NvBlastActorGetFamily(&actor, messageLog), settings);
+		EXPECT_TRUE(solver != nullptr);
+		solver->setAllNodesInfoFromLL();
+		solver->notifyActorCreated(actor);
+		return solver;
+	}
+
+	static void solveGravity(ExtStressSolver& solver, NvBlastActor* const* actors, uint32_t actorCount, uint32_t frameCount)
+	{
+		for (uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			for (uint32_t i = 0; i < actorCount; ++i)
+			{
+				solver.addGravityForce(*actors[i], PxVec3(0.0f, -10.0f, 0.0f));
+			}
+			solver.update();
+		}
+	}
+
+	std::vector<void*>	m_memory;
+};
+
+typedef StressSolverTest<NvBlastMessage::Error, 1> StressSolverTestAllowWarnings;
+typedef StressSolverTest<NvBlastMessage::Warning, 1> StressSolverTestStrict;
+
+
+// ====================================================================================================================
+//														TESTS
+// ====================================================================================================================
+
+TEST_F(StressSolverTestStrict, BondKernelsMatchScalar)
+{
+	// two colors of bonds over a ring of nodes, bonds of one color share no nodes, counts leave partial SIMD batches
+	const uint32_t nodeCount = 62;
+	const uint32_t colorBondCount = nodeCount / 2;
+	const uint32_t bondCount = 2 * colorBondCount;
+	const uint32_t iterationCount = 16;
+
+	std::vector<uint32_t> node0(bondCount), node1(bondCount);
+	std::vector<float> offset[3], invOffsetSqrLength(bondCount), invMass(nodeCount), invI(nodeCount), velocity[6];
+	for (uint32_t i = 0; i < colorBondCount; ++i)
+	{
+		node0[i] = 2 * i;
+		node1[i] = 2 * i + 1;
+		node0[colorBondCount + i] = 2 * i + 1;
+		node1[colorBondCount + i] = (2 * i + 2) % nodeCount;
+	}
+
+	srand(0);
+	auto random = []() { return (float)rand() / RAND_MAX; };
+	for (uint32_t c = 0; c < 3; ++c)
+	{
+		offset[c].resize(bondCount);
+		for (uint32_t i = 0; i < bondCount; ++i)
+		{
+			offset[c][i] = random() - 0.5f;
+		}
+	}
+	for (uint32_t i = 0; i < bondCount; ++i)
+	{
+		invOffsetSqrLength[i] = 1.0f / (offset[0][i] * offset[0][i] + offset[1][i] * offset[1][i] + offset[2][i] * offset[2][i]);
+	}
+	for (uint32_t i = 0; i < nodeCount; ++i)
+	{
+		// a few static nodes
+		invMass[i] = (i % 7) == 0 ? 0.0f : 0.5f + random();
+		invI[i] = (i % 7) == 0 ? 0.0f : 0.5f + random();
+	}
+	for (uint32_t c = 0; c < 6; ++c)
+	{
+		velocity[c].resize(nodeCount);
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			velocity[c][i] = random() - 0.5f;
+		}
+	}
+
+	struct Result
+	{
+		std::vector<float> impulse[6];
+		std::vector<float> velocity[6];
+	};
+
+	auto solve = [&](const ExtStressBondKernel& kernel)
+	{
+		Result result;
+		for (uint32_t c = 0; c < 6; ++c)
+		{
+			result.impulse[c].assign(bondCount, 0.0f);
+			result.velocity[c] = velocity[c];
+		}
+
+		ExtStressBondsSoA bonds;
+		bonds.node0 = node0.data();
+		bonds.node1 = node1.data();
+		bonds.offset.x = offset[0].data();
+		bonds.offset.y = offset[1].data();
+		bonds.offset.z = offset[2].data();
+		bonds.invOffsetSqrLength = invOffsetSqrLength.data();
+		bonds.impulseLinear.x = result.impulse[0].data();
+		bonds.impulseLinear.y = result.impulse[1].data();
+		bonds.impulseLinear.z = result.impulse[2].data();
+		bonds.impulseAngular.x = result.impulse[3].data();
+		bonds.impulseAngular.y = result.impulse[4].data();
+		bonds.impulseAngular.z = result.impulse[5].data();
+
+		ExtStressNodesSoA nodes;
+		nodes.velocityLinear.x = result.velocity[0].data();
+		nodes.velocityLinear.y = result.velocity[1].data();
+		nodes.velocityLinear.z = result.velocity[2].data();
+		nodes.velocityAngular.x = result.velocity[3].data();
+		nodes.velocityAngular.y = result.velocity[4].data();
+		nodes.velocityAngular.z = result.velocity[5].data();
+		nodes.invMass = invMass.data();
+		nodes.invI = invI.data();
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			kernel.solveBonds(bonds, nodes, 0, colorBondCount);
+			kernel.solveBonds(bonds, nodes, colorBondCount, colorBondCount);
+		}
+		return result;
+	};
+
+	auto compare = [&](const Result& expected, const Result& actual)
+	{
+		for (uint32_t c = 0; c < 6; ++c)
+		{
+			for (uint32_t i = 0; i < bondCount; ++i)
+			{
+				EXPECT_NEAR(expected.impulse[c][i], actual.impulse[c][i], 1e-4f * std::max(1.0f, std::abs(expected.impulse[c][i])));
+			}
+			for (uint32_t i = 0; i < nodeCount; ++i)
+			{
+				EXPECT_NEAR(expected.velocity[c][i], actual.velocity[c][i], 1e-4f * std::max(1.0f, std::abs(expected.velocity[c][i])));
+			}
+		}
+	};
+
+	const ExtStressBondKernel scalarKernel = getStressBondKernelScalar();
+	EXPECT_EQ(1u, scalarKernel.width);
+	const Result scalarResult = solve(scalarKernel);
+
+	ExtStressBondKernel kernel;
+	if (getStressBondKernelSSE2(kernel))
+	{
+		EXPECT_EQ(4u, kernel.width);
+		compare(scalarResult, solve(kernel));
+	}
+
+	// the AVX2 kernel may only run if the CPU supports it, which the selected kernel tells
+	const ExtStressBondKernel selectedKernel = getStressBondKernel();
+	if (selectedKernel.width == 8)
+	{
+		EXPECT_TRUE(getStressBondKernelAVX2(kernel));
+		EXPECT_EQ(8u, kernel.width);
+		compare(scalarResult, solve(kernel));
+	}
+	compare(scalarResult, solve(selectedKernel));
+}
+
+TEST_F(StressSolverTestStrict, ColoredSolveMatchesSequential)
+{
+	// wide enough for the colors of the unreduced graph to be split in tasks
+	const NvBlastAsset* asset = buildWallAsset(10);
+	const uint32_t graphNodeCount = NvBlastAssetGetSupportGraph(asset, messageLog).nodeCount;
+
+	for (uint32_t graphReductionLevel : { 0u, 1u })
+	{
+		ExtStressSolverSettings settings;
+		settings.graphReductionLevel = graphReductionLevel;
+		settings.bondIterationsPerFrame = 100000;
+
+		// sequential iteration over the bonds with the scalar kernel
+		NvBlastActor* actor = instanceActor(*asset);
+		ExtStressSolver* sequential = createSolver(*actor, settings);
+		solveGravity(*sequential, &actor, 1, 30);
+		const BondImpulses expected = getBondImpulses(*sequential, graphNodeCount);
+		sequential->release();
+
+		// color by color with the widest kernel, on the calling thread then in tasks
+		settings.graphColoring = true;
+		actor = instanceActor(*asset);
+		ExtStressSolver* colored = createSolver(*actor, settings);
+		solveGravity(*colored, &actor, 1, 30);
+		const BondImpulses coloredImpulses = getBondImpulses(*colored, graphNodeCount);
+		colored->release();
+		compareNodeImpulses(getDynamicNodeImpulses(expected), getDynamicNodeImpulses(coloredImpulses), 0.01f);
+
+		SerialStressTaskRunner taskRunner(5);
+		actor = instanceActor(*asset);
+		ExtStressSolver* parallel = createSolver(*actor, settings);
+		parallel->setTaskRunner(&taskRunner);
+		solveGravity(*parallel, &actor, 1, 30);
+		if (graphReductionLevel == 0)
+		{
+			EXPECT_LT(0u, taskRunner.m_runCount);
+		}
+
+		// the colored result does not depend on the tasks, bond by bond
+		const BondImpulses parallelImpulses = getBondImpulses(*parallel, graphNodeCount);
+		parallel->release();
+		compareBondImpulses(coloredImpulses, parallelImpulses, 0.0f);
+	}
+}
+
+TEST_F(StressSolverTestStrict, LatchedSolveMatchesUpdate)
+{
+	const NvBlastAsset* asset = buildWallAsset(6);
+
+	// soft bonds, so that gravity overstresses some of them
+	ExtStressSolverSettings settings;
+	settings.hardness = 0.01f;
+
+	NvBlastActor* actor = instanceActor(*asset);
+	ExtStressSolver* solver = createSolver(*actor, settings);
+	NvBlastActor* latchedActor = instanceActor(*asset);
+	ExtStressSolver* latchedSolver = createSolver(*latchedActor, settings);
+
+	uint32_t overstressedFrameCount = 0;
+	for (uint32_t frame = 0; frame < 10; ++frame)
+	{
+		solveGravity(*solver, &actor, 1, 1);
+		NvBlastFractureBuffers commands;
+		solver->generateFractureCommands(commands);
+
+		latchedSolver->addGravityForce(*latchedActor, PxVec3(0.0f, -10.0f, 0.0f));
+		latchedSolver->latch();
+		NvBlastFractureBuffers latchedCommands;
+		EXPECT_FALSE(latchedSolver->acquireFractureCommands(latchedCommands));
+		latchedSolver->solveLatched();
+		EXPECT_TRUE(latchedSolver->acquireFractureCommands(latchedCommands));
+
+		EXPECT_EQ(0u, latchedCommands.chunkFractureCount);
+		ASSERT_EQ(commands.bondFractureCount, latchedCommands.bondFractureCount);
+		for (uint32_t i = 0; i < commands.bondFractureCount; ++i)
+		{
+			EXPECT_EQ(commands.bondFractures[i].nodeIndex0, latchedCommands.bondFractures[i].nodeIndex0);
+			EXPECT_EQ(commands.bondFractures[i].nodeIndex1, latchedCommands.bondFractures[i].nodeIndex1);
+			EXPECT_EQ(commands.bondFractures[i].health, latchedCommands.bondFractures[i].health);
+		}
+		EXPECT_EQ(solver->getStressErrorLinear(), latchedSolver->getStressErrorLinear());
+		EXPECT_EQ(solver->getStressErrorAngular(), latchedSolver->getStressErrorAngular());
+		overstressedFrameCount += commands.bondFractureCount > 0 ? 1 : 0;
+
+		// the commands are acquired once
+		EXPECT_FALSE(latchedSolver->acquireFractureCommands(latchedCommands));
+	}
+	EXPECT_LT(0u, overstressedFrameCount);
+
+	solver->release();
+	latchedSolver->release();
+}
+
+TEST_F(StressSolverTestStrict, IncrementalRebuildMatchesFullRebuild)
+{
+	const NvBlastAsset* asset = buildWallAsset(6);
+	const NvBlastSupportGraph graph = NvBlastAssetGetSupportGraph(asset, messageLog);
+
+	// break the bonds between the two upper layers of the wall and those of one column
+	std::vector<NvBlastBondFractureData> bondFractures;
+	const NvBlastChunk* chunks = NvBlastAssetGetChunks(asset, messageLog);
+	const NvBlastBond* bonds = NvBlastAssetGetBonds(asset, messageLog);
+	for (uint32_t node0 = 0; node0 < graph.nodeCount; ++node0)
+	{
+		for (uint32_t j = graph.adjacencyPartition[node0]; j < graph.adjacencyPartition[node0 + 1]; ++j)
+		{
+			const uint32_t node1 = graph.adjacentNodeIndices[j];
+			const uint32_t chunk0 = graph.chunkIndices[node0];
+			const uint32_t chunk1 = graph.chunkIndices[node1];
+			if (node0 > node1 || chunk0 >= NvBlastAssetGetChunkCount(asset, messageLog) || chunk1 >= NvBlastAssetGetChunkCount(asset, messageLog))
+			{
+				continue;
+			}
+			const float* centroid0 = chunks[chunk0].centroid;
+			const float* centroid1 = chunks[chunk1].centroid;
+			const float* bondCentroid = bonds[graph.adjacentBondIndices[j]].centroid;
+			const bool layerSplit = (centroid0[1] - bondCentroid[1]) * (centroid1[1] - bondCentroid[1]) < 0.0f && bondCentroid[1] > 0.1f;
+			const bool columnSplit = (centroid0[0] - bondCentroid[0]) * (centroid1[0] - bondCentroid[0]) < 0.0f && std::abs(bondCentroid[0]) < 0.1f;
+			if (layerSplit || columnSplit)
+			{
+				NvBlastBondFractureData fracture = { 0, node0, node1, 2.0f };
+				bondFractures.push_back(fracture);
+			}
+		}
+	}
+	ASSERT_LT(0u, bondFractures.size());
+
+	for (uint32_t graphReductionLevel : { 0u, 1u })
+	{
+		ExtStressSolverSettings settings;
+		settings.graphReductionLevel = graphReductionLevel;
+		settings.bondIterationsPerFrame = 100000;
+
+		BondImpulses impulses[2];
+		for (uint32_t incremental = 0; incremental < 2; ++incremental)
+		{
+			NvBlastActor* actor = instanceActor(*asset);
+			ExtStressSolver* solver = createSolver(*actor, settings);
+			solveGravity(*solver, &actor, 1, 2);
+
+			// fracture and split, the incremental solver is told about the broken bonds
+			std::vector<NvBlastBondFractureData> appliedBondFractures(bondFractures.size());
+			NvBlastFractureBuffers commands = { (uint32_t)bondFractures.size(), 0, bondFractures.data(), nullptr };
+			NvBlastFractureBuffers events = { (uint32_t)appliedBondFractures.size(), 0, appliedBondFractures.data(), nullptr };
+			NvBlastActorApplyFracture(&events, actor, &commands, messageLog, nullptr);
+			EXPECT_EQ(bondFractures.size(), events.bondFractureCount);
+			if (incremental != 0)
+			{
+				solver->notifyFractures(events);
+			}
+
+			std::vector<NvBlastActor*> newActors(NvBlastActorGetMaxActorCountForSplit(actor, messageLog));
+			std::vector<char> splitScratch((size_t)NvBlastActorGetRequiredScratchForSplit(actor, messageLog));
+			NvBlastActorSplitEvent splitEvent = { nullptr, newActors.data() };
+			solver->notifyActorDestroyed(*actor);
+			const uint32_t newActorCount = NvBlastActorSplit(&splitEvent, actor, (uint32_t)newActors.size(), splitScratch.data(), messageLog, nullptr);
+			EXPECT_LT(1u, newActorCount);
+			for (uint32_t i = 0; i < newActorCount; ++i)
+			{
+				solver->notifyActorCreated(*newActors[i]);
+			}
+
+			solveGravity(*solver, newActors.data(), newActorCount, 30);
+			impulses[incremental] = getBondImpulses(*solver, graph.nodeCount);
+			solver->release();
+		}
+
+		compareBondImpulses(impulses[0], impulses[1], 0.01f);
+	}
+}
+
+TEST_F(StressSolverTestStrict, IncrementalRebuildHandlesChunkFractures)
+{
+	const NvBlastAsset* asset = buildWallAsset(6);
+	const NvBlastSupportGraph graph = NvBlastAssetGetSupportGraph(asset, messageLog);
+
+	// fracture the support chunks of the middle columns of the wall's upper half, their bonds go without bond fracture events
+	std::vector<NvBlastChunkFractureData> chunkFractures;
+	const NvBlastChunk* chunks = NvBlastAssetGetChunks(asset, messageLog);
+	const uint32_t chunkCount = NvBlastAssetGetChunkCount(asset, messageLog);
+	for (uint32_t node = 0; node < graph.nodeCount; ++node)
+	{
+		const uint32_t chunkIndex = graph.chunkIndices[node];
+		if (chunkIndex < chunkCount && std::abs(chunks[chunkIndex].centroid[0]) < 0.1f && std::abs(chunks[chunkIndex].centroid[2]) < 0.1f && chunks[chunkIndex].centroid[1] > 0.0f)
+		{
+			NvBlastChunkFractureData fracture = { 0, chunkIndex, 2.0f };
+			chunkFractures.push_back(fracture);
+		}
+	}
+	ASSERT_LT(0u, chunkFractures.size());
+
+	for (uint32_t graphReductionLevel : { 0u, 1u })
+	{
+		ExtStressSolverSettings settings;
+		settings.graphReductionLevel = graphReductionLevel;
+		settings.bondIterationsPerFrame = 100000;
+
+		BondImpulses impulses[2];
+		uint32_t bondCounts[2];
+		for (uint32_t incremental = 0; incremental < 2; ++incremental)
+		{
+			NvBlastActor* actor = instanceActor(*asset);
+			ExtStressSolver* solver = createSolver(*actor, settings);
+			solveGravity(*solver, &actor, 1, 2);
+
+			// the incremental solver was told about fractures before, it no longer sweeps the graph for broken bonds
+			if (incremental != 0)
+			{
+				const NvBlastFractureBuffers noFractures = { 0, 0, nullptr, nullptr };
+				solver->notifyFractures(noFractures);
+			}
+
+			std::vector<NvBlastBondFractureData> appliedBondFractures(graph.adjacencyPartition[graph.nodeCount]);
+			std::vector<NvBlastChunkFractureData> appliedChunkFractures(chunkCount);
+			NvBlastFractureBuffers commands = { 0, (uint32_t)chunkFractures.size(), nullptr, chunkFractures.data() };
+			NvBlastFractureBuffers events = { (uint32_t)appliedBondFractures.size(), (uint32_t)appliedChunkFractures.size(), appliedBondFractures.data(), appliedChunkFractures.data() };
+			NvBlastActorApplyFracture(&events, actor, &commands, messageLog, nullptr);
+			EXPECT_EQ(0u, events.bondFractureCount);
+			EXPECT_LE(chunkFractures.size(), events.chunkFractureCount);
+			if (incremental != 0)
+			{
+				solver->notifyFractures(events);
+			}
+
+			std::vector<NvBlastActor*> newActors(NvBlastActorGetMaxActorCountForSplit(actor, messageLog));
+			std::vector<char> splitScratch((size_t)NvBlastActorGetRequiredScratchForSplit(actor, messageLog));
+			NvBlastActorSplitEvent splitEvent = { nullptr, newActors.data() };
+			solver->notifyActorDestroyed(*actor);
+			const uint32_t newActorCount = NvBlastActorSplit(&splitEvent, actor, (uint32_t)newActors.size(), splitScratch.data(), messageLog, nullptr);
+			EXPECT_LT(1u, newActorCount);
+			for (uint32_t i = 0; i < newActorCount; ++i)
+			{
+				solver->notifyActorCreated(*newActors[i]);
+			}
+
+			solveGravity(*solver, newActors.data(), newActorCount, 30);
+			impulses[incremental] = getBondImpulses(*solver, graph.nodeCount);
+			bondCounts[incremental] = solver->getBondCount();
+			solver->release();
+		}
+
+		EXPECT_EQ(bondCounts[0], bondCounts[1]);
+		compareBondImpulses(impulses[0], impulses[1], 0.01f);
+	}
+}
@@ -32,6 +32,7 @@
 #include "NvBlastTkEvent.h"
 
 #include <map>
+#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //													ExtSync Tests
@@ -130,7 +131,7 @@ protected:
 class Server : public Base
 {
 public:
-	Server(TkTestStrict* test, std::vector<ExtSyncEvent*>& syncBuffer) : Base(test), m_syncBuffer(syncBuffer) {}
+	Server(TkTestStrict* test, std::vector<ExtSyncEvent*>& syncBuffer, std::vector<char>* syncStream = nullptr) : Base(test), m_syncBuffer(syncBuffer), m_syncStream(syncStream) {}
 
 protected:
 	virtual void impl() override
@@ -138,6 +139,16 @@ protected:
 		// create sync ext
 		ExtSync* sync = ExtSync::create();
 
+		// write to a byte stream instead of sync events
+		if (m_syncStream)
+		{
+			m_syncStream->resize(1 << 16);
+			ExtSyncStreamDesc streamDesc;
+			streamDesc.stream = m_syncStream->data();
+			streamDesc.capacity = static_cast<uint32_t>(m_syncStream->size());
+			sync->setSyncStream(streamDesc);
+		}
+
 		// add sync as listener to family #1
 		families[1]->addListener(*sync);
 
@@ -189,7 +200,18 @@ protected:
 		EXPECT_EQ(families[0]->getActorCount(), 5);
 		EXPECT_EQ(families[1]->getActorCount(), 1);
 
+		// take sync stream from sync, along with bond healths
+		if (m_syncStream)
+		{
+			sync->syncBondHealths(*families[0]);
+			sync->syncBondHealths(*families[1]);
+			EXPECT_EQ(5, sync->getSyncBufferSize());
+			m_syncStream->resize(sync->getSyncStreamSize());
+			sync->releaseSyncBuffer();
+		}
+
 		// take sync buffer from sync
+		else
 		{
 			const ExtSyncEvent*const* buffer;
 			uint32_t size;
@@ -214,13 +236,14 @@ protected:
 
 private:
 	std::vector<ExtSyncEvent*>& m_syncBuffer;
+	std::vector<char>*			m_syncStream;
 };
 
 
 class Client : public Base, public TkEventListener
 {
 public:
-	Client(TkTestStrict* test, std::vector<ExtSyncEvent*>& syncBuffer) : Base(test), m_syncBuffer(syncBuffer) {}
+	Client(TkTestStrict* test, std::vector<ExtSyncEvent*>& syncBuffer, const std::vector<char>* syncStream = nullptr) : Base(test), m_syncBuffer(syncBuffer), m_syncStream(syncStream) {}
 
 protected:
 
@@ -245,7 +268,20 @@ protected:
 		}
 
 		// apply sync buffer
-		sync->applySyncBuffer(*NvBlastTkFrameworkGet(), (const Nv::Blast::ExtSyncEvent**)m_syncBuffer.data(), static_cast<uint32_t>(m_syncBuffer.size()), m_group);
+		if (m_syncStream)
+		{
+			EXPECT_TRUE(sync->readSyncStream(m_syncStream->data(), static_cast<uint32_t>(m_syncStream->size())));
+			const ExtSyncEvent*const* buffer;
+			uint32_t size;
+			sync->acquireSyncBuffer(buffer, size);
+			EXPECT_EQ(5, size);
+			sync->applySyncBuffer(*NvBlastTkFrameworkGet(), const_cast<const ExtSyncEvent**>(buffer), size, m_group);
+			sync->releaseSyncBuffer();
+		}
+		else
+		{
+			sync->applySyncBuffer(*NvBlastTkFrameworkGet(), (const Nv::Blast::ExtSyncEvent**)m_syncBuffer.data(), static_cast<uint32_t>(m_syncBuffer.size()), m_group);
+		}
 
 		// check map
 		for (auto& family : families)
@@ -311,6 +347,7 @@ protected:
 private:
 	std::map<TkFamily*, std::set<uint32_t>> m_actorsPerFamily;
 	std::vector<ExtSyncEvent*>& m_syncBuffer;
+	const std::vector<char>*	m_syncStream;
 };
 
 TEST_F(TkTestStrict, SyncTest1)
@@ -342,3 +379,285 @@ TEST_F(TkTestStrict, SyncTest1)
 
 	this->releaseFramework();
 }
+
+
+TEST_F(TkTestStrict, SyncStreamTest)
+{
+	this->createFramework();
+
+	std::vector<ExtSyncEvent*> syncBuffer;
+	std::vector<char> syncStream;
+
+	std::stringstream serverFinalState;
+	{
+		Server s(this, syncBuffer, &syncStream);
+		s.run(serverFinalState);
+	}
+	EXPECT_TRUE(syncBuffer.empty());
+	EXPECT_TRUE(syncStream.size() > 0);
+
+	std::stringstream clientFinalState;
+	{
+		Client c(this, syncBuffer, &syncStream);
+		c.run(clientFinalState);
+	}
+
+	EXPECT_EQ(serverFinalState.str(), clientFinalState.str());
+
+	this->releaseFramework();
+}
+
+
+/**
+Damages one bond of the family's first actor without breaking it.  Returns the bond index.
+*/
+static uint32_t damageOneBond(TkFamily& family, float damage)
+{
+	const NvBlastSupportGraph graph = family.getAsset()->getGraph();
+	NvBlastBondFractureData bondFracture = { 0, 0, graph.adjacentNodeIndices[0], damage };
+	const NvBlastFractureBuffers commands = { 1, 0, &bondFracture, nullptr };
+	family.applyFracture(&commands);
+	return graph.adjacentBondIndices[0];
+}
+
+
+TEST_F(TkTestStrict, SyncStreamBondHealthDeltas)
+{
+	this->createFramework();
+	this->createTestAssets();
+
+	TkActorDesc adesc(testAssets[0]);
+	TkActor* actor = NvBlastTkFrameworkGet()->createActor(adesc);
+	TkFamily& family = actor->getFamily();
+	const uint32_t bondCount = testAssets[0]->getBondCount();
+
+	std::vector<char> syncStream(1 << 16);
+	ExtSyncStreamDesc streamDesc;
+	streamDesc.stream = syncStream.data();
+	streamDesc.capacity = static_cast<uint32_t>(syncStream.size());
+	ExtSync* sync = ExtSync::create();
+	sync->setSyncStream(streamDesc);
+
+	// keyframe, then nothing while no bond changes
+	sync->syncBondHealths(family);
+	const uint32_t keyframeSize = sync->getSyncStreamSize();
+	sync->syncBondHealths(family);
+	EXPECT_EQ(1, sync->getSyncBufferSize());
+	EXPECT_EQ(keyframeSize, sync->getSyncStreamSize());
+
+	// delta with the damaged bond only
+	const uint32_t damagedBond = damageOneBond(family, 0.25f);
+	sync->syncBondHealths(family);
+	EXPECT_EQ(2, sync->getSyncBufferSize());
+	syncStream.resize(sync->getSyncStreamSize());
+	sync->release();
+
+	ExtSync* client = ExtSync::create();
+	EXPECT_TRUE(client->readSyncStream(syncStream.data(), static_cast<uint32_t>(syncStream.size())));
+	const ExtSyncEvent*const* buffer;
+	uint32_t size;
+	client->acquireSyncBuffer(buffer, size);
+	EXPECT_EQ(2, size);
+	if (size == 2)
+	{
+		const ExtSyncEventBondHealths* keyframe = buffer[0]->getEvent<ExtSyncEventBondHealths>();
+		EXPECT_EQ(ExtSyncEventType::BondHealths, keyframe->type);
+		EXPECT_TRUE(keyframe->keyframe);
+		EXPECT_EQ(bondCount, keyframe->data.size());
+		for (uint32_t i = 0; i < keyframe->data.size(); ++i)
+		{
+			EXPECT_EQ(i, keyframe->data[i].bondIndex);
+			EXPECT_EQ(1.0f, keyframe->data[i].health);
+		}
+
+		// quantized healths are rounded up
+		const ExtSyncEventBondHealths* delta = buffer[1]->getEvent<ExtSyncEventBondHealths>();
+		EXPECT_EQ(ExtSyncEventType::BondHealths, delta->type);
+		EXPECT_FALSE(delta->keyframe);
+		EXPECT_EQ(1, delta->data.size());
+		if (delta->data.size() == 1)
+		{
+			EXPECT_EQ(damagedBond, delta->data[0].bondIndex);
+			EXPECT_LE(0.75f, delta->data[0].health);
+			EXPECT_GE(0.75f + 1.0f / 255, delta->data[0].health);
+		}
+	}
+	client->release();
+
+	family.release();
+	this->releaseTestAssets();
+	this->releaseFramework();
+}
+
+
+TEST_F(TkTestStrict, SyncStreamBondHealthsAboveMax)
+{
+	this->createFramework();
+	this->createTestAssets();
+
+	TkActorDesc adesc(testAssets[0]);
+	adesc.uniformInitialBondHealth = 4.0f;
+	TkActor* actor = NvBlastTkFrameworkGet()->createActor(adesc);
+	TkFamily& family = actor->getFamily();
+	const uint32_t damagedBond = damageOneBond(family, 1.0f);
+
+	// healths above maxBondHealth are not clamped
+	std::vector<char> syncStream(1 << 16);
+	ExtSyncStreamDesc streamDesc;
+	streamDesc.stream = syncStream.data();
+	streamDesc.capacity = static_cast<uint32_t>(syncStream.size());
+	streamDesc.maxBondHealth = 1.0f;
+	ExtSync* sync = ExtSync::create();
+	sync->setSyncStream(streamDesc);
+	sync->syncBondHealths(family);
+	syncStream.resize(sync->getSyncStreamSize());
+	sync->release();
+
+	ExtSync* client = ExtSync::create();
+	EXPECT_TRUE(client->readSyncStream(syncStream.data(), static_cast<uint32_t>(syncStream.size())));
+	const ExtSyncEvent*const* buffer;
+	uint32_t size;
+	client->acquireSyncBuffer(buffer, size);
+	EXPECT_EQ(1, size);
+	if (size == 1)
+	{
+		const ExtSyncEventBondHealths* keyframe = buffer[0]->getEvent<ExtSyncEventBondHealths>();
+		EXPECT_EQ(testAssets[0]->getBondCount(), keyframe->data.size());
+		for (const ExtSyncEventBondHealths::BondData& data : keyframe->data)
+		{
+			const float health = data.bondIndex == damagedBond ? 3.0f : 4.0f;
+			EXPECT_LE(health, data.health);
+			EXPECT_GE(health + 4.0f / 255, data.health);
+		}
+	}
+	client->release();
+
+	family.release();
+	this->releaseTestAssets();
+	this->releaseFramework();
+}
+
+
+TEST_F(TkTestAllowWarnings, SyncStreamCapacityExceeded)
+{
+	this->createFramework();
+	this->createTestAssets();
+
+	TkActorDesc adesc(testAssets[0]);
+	TkActor* actor = NvBlastTkFrameworkGet()->createActor(adesc);
+	TkFamily& family = actor->getFamily();
+
+	// the size of a keyframe record
+	std::vector<char> syncStream(1 << 16);
+	ExtSyncStreamDesc streamDesc;
+	streamDesc.stream = syncStream.data();
+	streamDesc.capacity = static_cast<uint32_t>(syncStream.size());
+	ExtSync* sync = ExtSync::create();
+	sync->setSyncStream(streamDesc);
+	sync->syncBondHealths(family);
+	const uint32_t keyframeSize = sync->getSyncStreamSize();
+	EXPECT_LT(0u, keyframeSize);
+
+	// room for one and a half keyframes, the second keyframe is dropped and nothing is written past the capacity
+	const uint32_t capacity = keyframeSize + keyframeSize / 2;
+	const char guard = 0x5A;
+	syncStream.assign(capacity + 64, guard);
+	streamDesc.stream = syncStream.data();
+	streamDesc.capacity = capacity;
+	sync->setSyncStream(streamDesc);
+	sync->syncBondHealths(family, 1);
+	sync->syncBondHealths(family, 1);
+	EXPECT_EQ(1, sync->getSyncBufferSize());
+	EXPECT_EQ(keyframeSize, sync->getSyncStreamSize());
+	EXPECT_TRUE(std::all_of(syncStream.begin() + capacity, syncStream.end(), [guard](char c) { return c == guard; }));
+
+	ExtSync* client = ExtSync::create();
+	EXPECT_TRUE(client->readSyncStream(syncStream.data(), sync->getSyncStreamSize()));
+	const ExtSyncEvent*const* buffer;
+	uint32_t size;
+	client->acquireSyncBuffer(buffer, size);
+	EXPECT_EQ(1, size);
+	client->release();
+
+	// the stream restarts empty once released
+	sync->releaseSyncBuffer();
+	sync->syncBondHealths(family, 1);
+	EXPECT_EQ(1, sync->getSyncBufferSize());
+	EXPECT_EQ(keyframeSize, sync->getSyncStreamSize());
+	sync->release();
+
+	family.release();
+	this->releaseTestAssets();
+	this->releaseFramework();
+}
+
+
+typedef TkBaseTest<-1, 0> TkTestAllowErrorsSilently;
+
+TEST_F(TkTestAllowErrorsSilently, SyncStreamMalformed)
+{
+	this->createFramework();
+	this->createTestAssets();
+
+	TkActorDesc adesc(testAssets[0]);
+	TkActor* actor = NvBlastTkFrameworkGet()->createActor(adesc);
+	TkFamily& family = actor->getFamily();
+
+	// a keyframe, a fracture and a delta record, remembering where each of them ends
+	std::vector<char> syncStream(1 << 16);
+	ExtSyncStreamDesc streamDesc;
+	streamDesc.stream = syncStream.data();
+	streamDesc.capacity = static_cast<uint32_t>(syncStream.size());
+	ExtSync* sync = ExtSync::create();
+	sync->setSyncStream(streamDesc);
+	family.addListener(*sync);
+	std::vector<uint32_t> recordEnds(1, 0);
+	sync->syncBondHealths(family);
+	recordEnds.push_back(sync->getSyncStreamSize());
+	damageOneBond(family, 0.25f);
+	recordEnds.push_back(sync->getSyncStreamSize());
+	sync->syncBondHealths(family);
+	recordEnds.push_back(sync->getSyncStreamSize());
+	EXPECT_EQ(3, sync->getSyncBufferSize());
+	syncStream.resize(sync->getSyncStreamSize());
+	family.removeListener(*sync);
+	sync->release();
+
+	ExtSync* client = ExtSync::create();
+
+	// a stream cut within a record is malformed, the copy is sized to catch reads past its end
+	for (uint32_t size = 0; size <= syncStream.size(); ++size)
+	{
+		const std::vector<char> truncated(syncStream.begin(), syncStream.begin() + size);
+		const bool isRecordEnd = std::find(recordEnds.begin(), recordEnds.end(), size) != recordEnds.end();
+		EXPECT_EQ(isRecordEnd, client->readSyncStream(truncated.data(), size));
+		client->releaseSyncBuffer();
+	}
+
+	// unknown event type
+	std::vector<char> corrupt = syncStream;
+	corrupt[0] = static_cast<char>(ExtSyncEventType::Count);
+	EXPECT_FALSE(client->readSyncStream(corrupt.data(), static_cast<uint32_t>(corrupt.size())));
+	client->releaseSyncBuffer();
+
+	// bond count larger than the stream
+	corrupt.assign(1, static_cast<char>(ExtSyncEventType::BondHealths));
+	corrupt.insert(corrupt.end(), sizeof(NvBlastID) + 1 + sizeof(float), 0);
+	const char hugeCount[] = { '\xFF', '\xFF', '\xFF', '\xFF', '\x0F' };
+	corrupt.insert(corrupt.end(), hugeCount, hugeCount + sizeof(hugeCount));
+	EXPECT_FALSE(client->readSyncStream(corrupt.data(), static_cast<uint32_t>(corrupt.size())));
+	client->releaseSyncBuffer();
+
+	// varint longer than 64 bits
+	corrupt.assign(1, static_cast<char>(ExtSyncEventType::Physics));
+	corrupt.insert(corrupt.end(), sizeof(NvBlastID), 0);
+	corrupt.insert(corrupt.end(), 16, '\x80');
+	EXPECT_FALSE(client->readSyncStream(corrupt.data(), static_cast<uint32_t>(corrupt.size())));
+	client->releaseSyncBuffer();
+
+	client->release();
+
+	family.release();
+	this->releaseTestAssets();
+	this->releaseFramework();
+}
@@ -1605,3 +1605,785 @@ TEST_F(TkTestAllowWarnings, GroupNoWorkers)
 	releaseFramework();
 }
 
+TEST_F(TkTestStrict, GroupTaskRunner)
+{
+	class ThreadTaskRunner : public TkGroupTaskRunner
+	{
+	public:
+		ThreadTaskRunner(uint32_t threadCount) : m_threadCount(threadCount) {}
+
+		virtual uint32_t getMaxTaskCount() const override
+		{
+			return m_threadCount;
+		}
+
+		virtual void run(Tasks& tasks, uint32_t taskCount) override
+		{
+			std::vector<std::thread> threads;
+			for (uint32_t i = 1; i < taskCount; i++)
+			{
+				threads.push_back(std::thread([&tasks, i] { tasks.execute(i); }));
+			}
+			tasks.execute(0);
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+	private:
+		uint32_t m_threadCount;
+	} taskRunner(4);
+
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* smallAsset = createCubeAsset(2, 2);
+	TkAsset* largeAsset = createCubeAsset(3, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* serialGroup = fwk->createGroup(gdesc);
+	TkGroup* runnerGroup = fwk->createGroup(gdesc);
+
+	// small actors are damaged first, the large ones last
+	const uint32_t actorCount = 8;
+	std::vector<TkActor*> serialActors, runnerActors;
+	std::vector<TkFamily*> serialFamilies, runnerFamilies;
+	for (uint32_t i = 0; i < actorCount; i++)
+	{
+		TkActorDesc actorDesc(i < actorCount / 2 ? smallAsset : largeAsset);
+		serialActors.push_back(fwk->createActor(actorDesc));
+		runnerActors.push_back(fwk->createActor(actorDesc));
+		serialFamilies.push_back(&serialActors.back()->getFamily());
+		runnerFamilies.push_back(&runnerActors.back()->getFamily());
+		serialGroup->addActor(*serialActors.back());
+		runnerGroup->addActor(*runnerActors.back());
+	}
+
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+	for (uint32_t i = 0; i < actorCount; i++)
+	{
+		serialActors[i]->damage(getFalloffProgram(), &radialDamageParams);
+		runnerActors[i]->damage(getFalloffProgram(), &radialDamageParams);
+	}
+
+	// jobs are ordered by decreasing cost
+	const uint32_t jobCount = serialGroup->startProcess();
+	EXPECT_EQ(actorCount, jobCount);
+	for (uint32_t i = 1; i < jobCount; i++)
+	{
+		EXPECT_GE(serialGroup->getJobCost(i - 1), serialGroup->getJobCost(i));
+	}
+	EXPECT_GT(serialGroup->getJobCost(0), serialGroup->getJobCost(jobCount - 1));
+	EXPECT_EQ(0, serialGroup->getJobCost(jobCount));
+
+	TkGroupWorker* worker = serialGroup->acquireWorker();
+	for (uint32_t i = 0; i < jobCount; i++)
+	{
+		worker->process(i);
+	}
+	serialGroup->returnWorker(worker);
+	EXPECT_TRUE(serialGroup->endProcess());
+
+	// the task runner processes the same work on its threads
+	EXPECT_EQ(actorCount, runnerGroup->process(taskRunner));
+	EXPECT_EQ(4, runnerGroup->getWorkerCount());
+	EXPECT_FALSE(runnerGroup->endProcess());
+
+	for (uint32_t i = 0; i < actorCount; i++)
+	{
+		EXPECT_LT(1, serialFamilies[i]->getActorCount());
+		EXPECT_EQ(serialFamilies[i]->getActorCount(), runnerFamilies[i]->getActorCount());
+	}
+	EXPECT_EQ(serialGroup->getActorCount(), runnerGroup->getActorCount());
+
+	serialGroup->release();
+	runnerGroup->release();
+
+	releaseFramework();
+}
+
+TEST_F(TkTestStrict, DamageCoalescing)
+{
+	class EventCounter : public TkEventListener
+	{
+	public:
+		EventCounter() :fracCommands(0), fracEvents(0) {}
+
+		void receive(const TkEvent* events, uint32_t eventCount)
+		{
+			for (uint32_t i = 0; i < eventCount; i++)
+			{
+				const TkEvent& event = events[i];
+				switch (event.type)
+				{
+				case TkFractureCommands::EVENT_TYPE:
+					fracCommands++;
+					break;
+				case TkFractureEvents::EVENT_TYPE:
+					fracEvents++;
+					break;
+				default:
+					break;
+				}
+			}
+		}
+
+		uint32_t fracCommands, fracEvents;
+	} listener, coalescedListener;
+
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+	TkGroup* coalescingGroup = fwk->createGroup(gdesc);
+	EXPECT_FALSE(coalescingGroup->getDamageCoalescing());
+	coalescingGroup->setDamageCoalescing(true);
+	EXPECT_TRUE(coalescingGroup->getDamageCoalescing());
+
+	TkActorDesc actorDesc(cubeAsset);
+	TkActor* actor = fwk->createActor(actorDesc);
+	TkActor* coalescedActor = fwk->createActor(actorDesc);
+	TkFamily& family = actor->getFamily();
+	TkFamily& coalescedFamily = coalescedActor->getFamily();
+	family.addListener(listener);
+	coalescedFamily.addListener(coalescedListener);
+	group->addActor(*actor);
+	coalescingGroup->addActor(*coalescedActor);
+
+	// several hits, only their sum breaks the bonds
+	const uint32_t damageCount = 4;
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0, 10.0f, 10.0f, 0.3f);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+	for (uint32_t i = 0; i < damageCount; i++)
+	{
+		actor->damage(getFalloffProgram(), &radialDamageParams);
+		coalescedActor->damage(getFalloffProgram(), &radialDamageParams);
+	}
+
+	group->process();
+	coalescingGroup->process();
+
+	EXPECT_EQ(damageCount, listener.fracCommands);
+	EXPECT_EQ(damageCount, listener.fracEvents);
+	EXPECT_EQ(1, coalescedListener.fracCommands);
+	EXPECT_EQ(1, coalescedListener.fracEvents);
+
+	EXPECT_LT(1, family.getActorCount());
+	EXPECT_EQ(family.getActorCount(), coalescedFamily.getActorCount());
+
+	group->release();
+	coalescingGroup->release();
+
+	releaseFramework();
+}
+
+
+TEST_F(TkTestStrict, SubmitDamageConcurrently)
+{
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+
+	TkActorDesc actorDesc(cubeAsset);
+	TkActor* actor = fwk->createActor(actorDesc);
+	TkActor* referenceActor = fwk->createActor(actorDesc);
+	TkActor* busyActor = fwk->createActor(actorDesc);
+	TkFamily& family = actor->getFamily();
+	TkFamily& referenceFamily = referenceActor->getFamily();
+	TkFamily& busyFamily = busyActor->getFamily();
+	group->addActor(*actor);
+	group->addActor(*referenceActor);
+	group->addActor(*busyActor);
+
+	const uint32_t threadCount = 4;
+	const uint32_t damagePerThread = 8;
+	const NvBlastDamageProgram program = getFalloffProgram();
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0, 10.0f, 10.0f, 0.1f);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+	NvBlastExtRadialDamageDesc busyDamage = getRadialDamageDesc(0, 0, 0);
+	NvBlastExtProgramParams busyDamageParams = { &busyDamage, nullptr };
+
+	// submit damage from several threads while the group is processing jobs
+	busyActor->damage(program, &busyDamageParams);
+	const uint32_t jobCount = group->startProcess();
+	ASSERT_LT(0u, jobCount);
+	std::vector<std::thread> threads;
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		threads.push_back(std::thread([&]
+		{
+			for (uint32_t j = 0; j < damagePerThread; j++)
+			{
+				group->submitDamage(*actor, program, &radialDamageParams);
+			}
+		}));
+	}
+	TkGroupWorker* worker = group->acquireWorker();
+	for (uint32_t i = 0; i < jobCount; i++)
+	{
+		worker->process(i);
+	}
+	group->returnWorker(worker);
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	group->endProcess();
+
+	// the submitted damage is queued at the next startProcess
+	EXPECT_LT(1, busyFamily.getActorCount());
+	EXPECT_EQ(1, family.getActorCount());
+
+	for (uint32_t i = 0; i < threadCount * damagePerThread; i++)
+	{
+		referenceActor->damage(program, &radialDamageParams);
+	}
+
+	group->process();
+
+	EXPECT_LT(1, family.getActorCount());
+	EXPECT_EQ(referenceFamily.getActorCount(), family.getActorCount());
+
+	group->release();
+
+	releaseFramework();
+}
+
+TEST_F(TkTestStrict, GroupMemoryPooling)
+{
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0, 10.0f, 10.0f, 0.3f);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+
+	// every cycle reports more fracture data than the group preallocates
+	TkGroupMemoryStats stats[3];
+	for (uint32_t cycle = 0; cycle < 3; cycle++)
+	{
+		TkActorDesc actorDesc(cubeAsset);
+		TkActor* actor = fwk->createActor(actorDesc);
+		TkFamily& family = actor->getFamily();
+		group->addActor(*actor);
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			actor->damage(getFalloffProgram(), &radialDamageParams);
+		}
+
+		group->process();
+		group->getMemoryStats(stats[cycle]);
+
+		EXPECT_LT(1, family.getActorCount());
+		EXPECT_EQ(family.getActorCount(), stats[cycle].newActorCount);
+
+		family.release();
+	}
+
+	EXPECT_LT(0, stats[0].arenaAllocationCount);
+	EXPECT_LT(0, stats[0].arenaSize);
+	EXPECT_EQ(0, stats[2].arenaAllocationCount);
+	EXPECT_EQ(stats[0].arenaSize, stats[2].arenaSize);
+	EXPECT_LT(0, stats[2].arenaUsedSize);
+
+	group->release();
+
+	releaseFramework();
+}
+
+TEST_F(TkTestStrict, EventDataPoolRecycling)
+{
+	class FractureListener : public TkEventListener
+	{
+	public:
+		void receive(const TkEvent* events, uint32_t eventCount)
+		{
+			for (uint32_t i = 0; i < eventCount; i++)
+			{
+				const TkEvent& event = events[i];
+				if (event.type == TkEvent::FractureEvent)
+				{
+					const TkFractureEvents* fractureEvents = event.getPayload<TkFractureEvents>();
+					const NvBlastFractureBuffers& buffers = fractureEvents->buffers;
+					bondFractures.back().insert(bondFractures.back().end(), buffers.bondFractures, buffers.bondFractures + buffers.bondFractureCount);
+				}
+			}
+		}
+
+		std::vector<std::vector<NvBlastBondFractureData>> bondFractures;	// per cycle
+	} listener, limitedListener;
+
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+	TkGroup* limitedGroup = fwk->createGroup(gdesc);
+	EXPECT_EQ(0, group->getEventDataPoolLimit());
+	limitedGroup->setEventDataPoolLimit(1);
+	EXPECT_EQ(1, limitedGroup->getEventDataPoolLimit());
+
+	TkActorDesc actorDesc(cubeAsset);
+	TkActor* actor = fwk->createActor(actorDesc);
+	TkActor* limitedActor = fwk->createActor(actorDesc);
+	TkFamily& family = actor->getFamily();
+	family.addListener(listener);
+	limitedActor->getFamily().addListener(limitedListener);
+	group->addActor(*actor);
+	limitedGroup->addActor(*limitedActor);
+
+	// every cycle damages all bonds without breaking any, reporting the same amount of payload
+	const uint32_t cycleCount = 8;
+	const float damage = 0.05f;
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0, 10.0f, 10.0f, damage);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+
+	TkGroupMemoryStats stats[cycleCount];
+	auto processCycle = [&](uint32_t cycle)
+	{
+		listener.bondFractures.emplace_back();
+		limitedListener.bondFractures.emplace_back();
+		actor->damage(getFalloffProgram(), &radialDamageParams);
+		limitedActor->damage(getFalloffProgram(), &radialDamageParams);
+
+		group->process();
+		limitedGroup->process();
+
+		// payloads written to recycled pages, and to pages allocated anew under the limit, report the remaining health
+		const std::vector<NvBlastBondFractureData>& bondFractures = listener.bondFractures.back();
+		const std::vector<NvBlastBondFractureData>& limitedBondFractures = limitedListener.bondFractures.back();
+		EXPECT_LT(0, bondFractures.size());
+		ASSERT_EQ(bondFractures.size(), limitedBondFractures.size());
+		for (uint32_t i = 0; i < bondFractures.size(); i++)
+		{
+			EXPECT_EQ(bondFractures[i].nodeIndex0, limitedBondFractures[i].nodeIndex0);
+			EXPECT_EQ(bondFractures[i].nodeIndex1, limitedBondFractures[i].nodeIndex1);
+			EXPECT_EQ(bondFractures[i].health, limitedBondFractures[i].health);
+			EXPECT_NEAR(1.0f - damage * (cycle + 1), bondFractures[i].health, 1e-4f);
+		}
+		EXPECT_EQ(1, family.getActorCount());
+
+		TkGroupMemoryStats limitedStats;
+		limitedGroup->getMemoryStats(limitedStats);
+		EXPECT_LE(limitedStats.eventDataPoolSize, limitedGroup->getEventDataPoolLimit());
+	};
+
+	for (uint32_t cycle = 0; cycle < cycleCount; cycle++)
+	{
+		processCycle(cycle);
+		group->getMemoryStats(stats[cycle]);
+	}
+
+	// without limit, the payload pages of the first cycle are kept and serve all later cycles
+	EXPECT_LT(0, stats[0].eventDataPoolSize);
+	for (uint32_t cycle = 1; cycle < cycleCount; cycle++)
+	{
+		EXPECT_EQ(stats[0].eventDataPoolSize, stats[cycle].eventDataPoolSize);
+	}
+
+	// a limit fitting the pooled pages keeps them, a lower one frees them
+	TkGroupMemoryStats limitStats;
+	group->setEventDataPoolLimit(stats[0].eventDataPoolSize);
+	processCycle(cycleCount);
+	group->getMemoryStats(limitStats);
+	EXPECT_EQ(stats[0].eventDataPoolSize, limitStats.eventDataPoolSize);
+
+	group->setEventDataPoolLimit(1);
+	processCycle(cycleCount + 1);
+	group->getMemoryStats(limitStats);
+	EXPECT_EQ(0, limitStats.eventDataPoolSize);
+
+	group->release();
+	limitedGroup->release();
+
+	releaseFramework();
+}
+
+TEST_F(TkTestStrict, JointUpdateEventBatching)
+{
+	class JointListener : public TkEventListener
+	{
+	public:
+		JointListener() : jointUpdateEvents(0), batchEvents(0) {}
+
+		void receive(const TkEvent* events, uint32_t eventCount)
+		{
+			for (uint32_t i = 0; i < eventCount; i++)
+			{
+				const TkEvent& event = events[i];
+				switch (event.type)
+				{
+				case TkJointUpdateEvent::EVENT_TYPE:
+					jointUpdateEvents++;
+					break;
+				case TkJointUpdateBatchEvent::EVENT_TYPE:
+				{
+					const TkJointUpdateBatchEvent* batch = event.getPayload<TkJointUpdateBatchEvent>();
+					for (uint32_t j = 0; j < batch->jointUpdateCount; j++)
+					{
+						EXPECT_EQ(TkJointUpdateEvent::Changed, batch->jointUpdates[j].subtype);
+						updatedJoints.push_back(batch->jointUpdates[j].joint);
+					}
+					batchEvents++;
+				}
+				break;
+				default:
+					break;
+				}
+			}
+		}
+
+		uint32_t jointUpdateEvents, batchEvents;
+		std::vector<TkJoint*> updatedJoints;
+	} listener;
+
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+	EXPECT_FALSE(group->getJointUpdateEventBatching());
+	group->setJointUpdateEventBatching(true);
+	EXPECT_TRUE(group->getJointUpdateEventBatching());
+
+	TkActorDesc actorDesc(cubeAsset);
+	TkActor* actor0 = fwk->createActor(actorDesc);
+	TkActor* actor1 = fwk->createActor(actorDesc);
+	actor0->getFamily().addListener(listener);
+	actor1->getFamily().addListener(listener);
+	group->addActor(*actor0);
+	group->addActor(*actor1);
+
+	// join every support chunk of one family with the same chunk of the other, both ends of every joint split
+	const NvBlastSupportGraph graph = cubeAsset->getGraph();
+	std::vector<TkJoint*> joints;
+	for (uint32_t i = 0; i < graph.nodeCount; i++)
+	{
+		TkJointDesc jointDesc;
+		jointDesc.families[0] = &actor0->getFamily();
+		jointDesc.families[1] = &actor1->getFamily();
+		jointDesc.chunkIndices[0] = jointDesc.chunkIndices[1] = graph.chunkIndices[i];
+		jointDesc.attachPositions[0] = jointDesc.attachPositions[1] = PxVec3(0.0f);
+		joints.push_back(fwk->createJoint(jointDesc));
+	}
+
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+	actor0->damage(getFalloffProgram(), &radialDamageParams);
+	actor1->damage(getFalloffProgram(), &radialDamageParams);
+
+	group->process();
+
+	// every joint is updated and reported once, in a single batch
+	EXPECT_EQ(0, listener.jointUpdateEvents);
+	EXPECT_EQ(1, listener.batchEvents);
+	std::sort(listener.updatedJoints.begin(), listener.updatedJoints.end());
+	std::sort(joints.begin(), joints.end());
+	EXPECT_EQ(joints, listener.updatedJoints);
+
+	for (TkJoint* joint : joints)
+	{
+		const TkJointData data = joint->getData();
+		EXPECT_TRUE(data.actors[0] != nullptr && data.actors[1] != nullptr);
+	}
+
+	group->release();
+
+	releaseFramework();
+}
+
+
+TEST_F(TkTestStrict, SplitChildData)
+{
+	class SplitListener : public TkEventListener
+	{
+	public:
+		SplitListener() : splitEvents(0), checkedChildren(0) {}
+
+		void receive(const TkEvent* events, uint32_t eventCount)
+		{
+			for (uint32_t i = 0; i < eventCount; i++)
+			{
+				const TkEvent& event = events[i];
+				if (event.type != TkSplitEvent::EVENT_TYPE)
+				{
+					continue;
+				}
+
+				const TkSplitEvent* split = event.getPayload<TkSplitEvent>();
+				const TkSplitChildData& data = split->childData;
+				ASSERT_TRUE(data.childIndices != nullptr);
+				EXPECT_EQ(0, data.visibleChunkOffsets[0]);
+				EXPECT_EQ(0, data.graphNodeOffsets[0]);
+
+				for (uint32_t c = 0; c < split->numChildren; c++)
+				{
+					const TkActor* child = split->children[c];
+					EXPECT_EQ(child->getIndex(), data.childIndices[c]);
+
+					std::vector<uint32_t> visibleChunks(child->getVisibleChunkCount());
+					child->getVisibleChunkIndices(visibleChunks.data(), (uint32_t)visibleChunks.size());
+					std::vector<uint32_t> flatVisibleChunks(data.visibleChunkIndices + data.visibleChunkOffsets[c], data.visibleChunkIndices + data.visibleChunkOffsets[c + 1]);
+					EXPECT_EQ(visibleChunks, flatVisibleChunks);
+
+					std::vector<uint32_t> graphNodes(child->getGraphNodeCount());
+					if (!graphNodes.empty())
+					{
+						child->getGraphNodeIndices(graphNodes.data(), (uint32_t)graphNodes.size());
+					}
+					std::vector<uint32_t> flatGraphNodes(data.graphNodeIndices + data.graphNodeOffsets[c], data.graphNodeIndices + data.graphNodeOffsets[c + 1]);
+					EXPECT_EQ(graphNodes, flatGraphNodes);
+
+					checkedChildren++;
+				}
+				splitEvents++;
+			}
+		}
+
+		uint32_t splitEvents, checkedChildren;
+	} listener;
+
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+	EXPECT_FALSE(group->getSplitChildData());
+	group->setSplitChildData(true);
+	EXPECT_TRUE(group->getSplitChildData());
+
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+
+	// The first split of a cycle fills a worker block sized to it, the second one needs another block.
+	// The next cycle runs from the single block those are merged into.
+	const uint32_t actorCount = 2;
+	uint32_t expectedSplitEvents = 0, expectedChildren = 0;
+	for (uint32_t cycle = 0; cycle < 2; cycle++)
+	{
+		std::vector<TkFamily*> families;
+		for (uint32_t i = 0; i < actorCount; i++)
+		{
+			TkActorDesc actorDesc(cubeAsset);
+			TkActor* actor = fwk->createActor(actorDesc);
+			families.push_back(&actor->getFamily());
+			actor->getFamily().addListener(listener);
+			group->addActor(*actor);
+			actor->damage(getFalloffProgram(), &radialDamageParams);
+		}
+
+		group->process();
+
+		for (TkFamily* family : families)
+		{
+			EXPECT_LT(1, family->getActorCount());
+			expectedChildren += family->getActorCount();
+		}
+		expectedSplitEvents += actorCount;
+		EXPECT_EQ(expectedSplitEvents, listener.splitEvents);
+		EXPECT_EQ(expectedChildren, listener.checkedChildren);
+	}
+
+	group->release();
+
+	releaseFramework();
+}
+
+
+TEST_F(TkTestStrict, ListenerTypeMask)
+{
+	class TypeListener : public TkEventListener
+	{
+	public:
+		TypeListener() : calls(0) {}
+
+		void receive(const TkEvent* events, uint32_t eventCount)
+		{
+			EXPECT_LT(0, eventCount);
+			received.insert(received.end(), events, events + eventCount);
+			calls++;
+		}
+
+		uint32_t calls;
+		std::vector<TkEvent> received;
+	};
+
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	TkAsset* cubeAsset = createCubeAsset(2, 2);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 1;
+	TkGroup* group = fwk->createGroup(gdesc);
+
+	TkActorDesc actorDesc(cubeAsset);
+	TkActor* actor = fwk->createActor(actorDesc);
+	TkFamily& family = actor->getFamily();
+	group->addActor(*actor);
+
+	TypeListener allListener, splitListener, fractureListener, splitAndFractureEventListener, removedListener;
+	family.addListener(allListener);
+	family.addListener(splitListener, TkEvent::SplitBit);
+	family.addListener(fractureListener, TkEvent::FractureCommandBit | TkEvent::FractureEventBit);
+	family.addListener(splitAndFractureEventListener, TkEvent::SplitBit | TkEvent::FractureEventBit);
+	family.addListener(removedListener, TkEvent::SplitBit);
+	family.removeListener(removedListener);
+
+	NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0);
+	NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+	actor->damage(getFalloffProgram(), &radialDamageParams);
+
+	group->process();
+
+	// the listeners receive the events of their types, grouped by type in type order
+	auto expectTypes = [&](const TypeListener& listener, uint32_t typeMask)
+	{
+		std::vector<TkEvent> expected;
+		for (uint32_t type = 0; type < TkEvent::TypeCount; type++)
+		{
+			for (const TkEvent& event : allListener.received)
+			{
+				if (event.type == type && (typeMask & (1 << type)))
+				{
+					expected.push_back(event);
+				}
+			}
+		}
+		ASSERT_EQ(expected.size(), listener.received.size());
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			EXPECT_EQ(expected[i].type, listener.received[i].type);
+			EXPECT_EQ(expected[i].payload, listener.received[i].payload);
+		}
+	};
+
+	EXPECT_EQ(1, allListener.calls);
+	EXPECT_EQ((size_t)3, allListener.received.size());
+	expectTypes(splitListener, TkEvent::SplitBit);
+	expectTypes(fractureListener, TkEvent::FractureCommandBit | TkEvent::FractureEventBit);
+	expectTypes(splitAndFractureEventListener, TkEvent::SplitBit | TkEvent::FractureEventBit);
+
+	// adjacent types are received in one call, types separated by other events in one call each
+	EXPECT_EQ(1, splitListener.calls);
+	EXPECT_EQ(1, fractureListener.calls);
+	EXPECT_EQ(2, splitAndFractureEventListener.calls);
+	EXPECT_EQ(0, removedListener.calls);
+
+	group->release();
+
+	releaseFramework();
+}
+
+TEST_F(TkTestStrict, GroupPhaseTimers)
+{
+	createFramework();
+	TkFramework* fwk = NvBlastTkFrameworkGet();
+
+	EXPECT_EQ((uint32_t)0, TkGroupStats::getSizeBucket(0));
+	EXPECT_EQ((uint32_t)0, TkGroupStats::getSizeBucket(3));
+	EXPECT_EQ((uint32_t)1, TkGroupStats::getSizeBucket(4));
+	EXPECT_EQ((uint32_t)2, TkGroupStats::getSizeBucket(16));
+	EXPECT_EQ((uint32_t)TkGroupStats::SizeBucketCount - 1, TkGroupStats::getSizeBucket(0xFFFFFFFF));
+
+	TkAsset* cubeAsset = createCubeAsset(4, 2);
+	TkActorDesc cubeDesc(cubeAsset);
+
+	TkGroupDesc gdesc;
+	gdesc.workerCount = 2;
+	TkGroup* group = fwk->createGroup(gdesc);
+	group->setPhaseTimers(true);
+	EXPECT_TRUE(group->getPhaseTimers());
+
+	const uint32_t actorCount = 4;
+	for (uint32_t i = 0; i < actorCount; i++)
+	{
+		TkActor* actor = fwk->createActor(cubeDesc);
+		group->addActor(*actor);
+
+		NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0);
+		NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+		actor->damage(getFalloffProgram(), &radialDamageParams);
+	}
+
+	group->process();
+
+	TkGroupStats gstats;
+	group->getStats(gstats);
+
+	// the phases are timed in all builds
+	EXPECT_EQ(actorCount, gstats.processedActorsCount);
+	const int64_t lowLevelTime = gstats.timers.material + gstats.timers.fracture + gstats.timers.island + gstats.timers.partition + gstats.timers.visibility;
+	EXPECT_LT(0, lowLevelTime);
+	EXPECT_LE(lowLevelTime + gstats.eventFill + gstats.splitMemory, gstats.workerTime);
+
+	// the per worker and per size stats add up to the totals
+	ASSERT_EQ(group->getWorkerCount(), gstats.workerCount);
+	TkGroupPhaseStats workerSum, bucketSum;
+	memset(&workerSum, 0, sizeof(TkGroupPhaseStats));
+	memset(&bucketSum, 0, sizeof(TkGroupPhaseStats));
+	for (uint32_t i = 0; i < gstats.workerCount; i++)
+	{
+		workerSum.timers.island += gstats.workers[i].timers.island;
+		workerSum.total += gstats.workers[i].total;
+		workerSum.actorCount += gstats.workers[i].actorCount;
+	}
+	for (uint32_t i = 0; i < TkGroupStats::SizeBucketCount; i++)
+	{
+		bucketSum.timers.island += gstats.sizeBuckets[i].timers.island;
+		bucketSum.actorCount += gstats.sizeBuckets[i].actorCount;
+	}
+	EXPECT_EQ(gstats.timers.island, workerSum.timers.island);
+	EXPECT_EQ(gstats.workerTime, workerSum.total);
+	EXPECT_EQ(actorCount, workerSum.actorCount);
+	EXPECT_EQ(gstats.timers.island, bucketSum.timers.island);
+	EXPECT_EQ(actorCount, bucketSum.actorCount);
+	EXPECT_EQ(actorCount, gstats.sizeBuckets[TkGroupStats::getSizeBucket(cubeAsset->getGraph().nodeCount)].actorCount);
+
+	// disabled timers keep the stats of the last timed processing
+	group->setPhaseTimers(false);
+	TkActor* actors[64];
+	const uint32_t count = group->getActors(actors, 64);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		NvBlastExtRadialDamageDesc radialDamage = getRadialDamageDesc(0, 0, 0);
+		NvBlastExtProgramParams radialDamageParams = { &radialDamage, nullptr };
+		actors[i]->damage(getFalloffProgram(), &radialDamageParams);
+	}
+	group->process();
+
+	TkGroupStats lastStats;
+	group->getStats(lastStats);
+	EXPECT_EQ(0, memcmp(&gstats, &lastStats, sizeof(TkGroupStats)));
+
+	group->release();
+
+	releaseFramework();
+}